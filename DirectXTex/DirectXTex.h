@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <vector>
 
 #if !defined(__d3d11_h__) && !defined(__d3d11_x_h__) && !defined(__d3d12_h__) && !defined(__d3d12_x_h__)
@@ -283,6 +284,7 @@ namespace DirectX
         void __cdecl Release();
 
         bool __cdecl OverrideFormat(_In_ DXGI_FORMAT f);
+        bool __cdecl OverrideAlphaMode(_In_ TEX_ALPHA_MODE mode);
 
         const TexMetadata& __cdecl GetMetadata() const { return m_metadata; }
         const Image* __cdecl GetImage(_In_ size_t mip, _In_ size_t item, _In_ size_t slice) const;
@@ -303,6 +305,47 @@ namespace DirectX
         uint8_t*    m_memory;
     };
 
+    //---------------------------------------------------------------------------------
+    // Read-only image container whose images point directly into a memory-mapped file
+    class MappedImage
+    {
+    public:
+        MappedImage() noexcept
+            : m_nimages(0), m_size(0), m_metadata{}, m_image(nullptr), m_view(nullptr), m_pixels(nullptr) {}
+        MappedImage(MappedImage&& moveFrom) noexcept
+            : m_nimages(0), m_size(0), m_metadata{}, m_image(nullptr), m_view(nullptr), m_pixels(nullptr) { *this = std::move(moveFrom); }
+        ~MappedImage() { Release(); }
+
+        MappedImage& __cdecl operator= (MappedImage&& moveFrom) noexcept;
+
+        MappedImage(const MappedImage&) = delete;
+        MappedImage& operator=(const MappedImage&) = delete;
+
+        void __cdecl Release();
+
+        const TexMetadata& __cdecl GetMetadata() const { return m_metadata; }
+        const Image* __cdecl GetImage(_In_ size_t mip, _In_ size_t item, _In_ size_t slice) const;
+
+        const Image* __cdecl GetImages() const { return m_image; }
+        size_t __cdecl GetImageCount() const { return m_nimages; }
+
+        const uint8_t* __cdecl GetPixels() const { return m_pixels; }
+        size_t __cdecl GetPixelsSize() const { return m_size; }
+
+    private:
+        size_t      m_nimages;
+        size_t      m_size;
+        TexMetadata m_metadata;
+        Image*      m_image;
+        void*       m_view;
+        uint8_t*    m_pixels;
+
+        friend HRESULT __cdecl LoadFromDDSFileMapped(
+            _In_z_ const wchar_t* szFile,
+            _In_ DWORD flags,
+            _Out_opt_ TexMetadata* metadata, _Out_ MappedImage& image);
+    };
+
     //---------------------------------------------------------------------------------
     // Memory blob (allocated buffer pointer is always 16-byte aligned)
     class Blob
@@ -343,6 +386,25 @@ namespace DirectX
         _In_z_ const wchar_t* szFile,
         _In_ DWORD flags,
         _Out_opt_ TexMetadata* metadata, _Out_ ScratchImage& image);
+    HRESULT __cdecl LoadFromDDSFileRange(
+        _In_z_ const wchar_t* szFile,
+        _In_ DWORD flags,
+        _In_ size_t firstMip, _In_ size_t mipCount,
+        _In_ size_t firstItem, _In_ size_t itemCount,
+        _Out_opt_ TexMetadata* metadata, _Out_ ScratchImage& image);
+        // Reads only the requested mip levels and array items (a count of '0' means all remaining); the result and
+        // metadata describe the subset, and a cubemap subset that does not cover whole cubes loads as a 2D array
+        // Volume textures have a single item, so only the mip range applies to them
+        // With DDS_FLAGS_BAD_DXTN_TAILS, a BC range starting below 4x4 returns HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED)
+
+    HRESULT __cdecl LoadFromDDSFileMapped(
+        _In_z_ const wchar_t* szFile,
+        _In_ DWORD flags,
+        _Out_opt_ TexMetadata* metadata, _Out_ MappedImage& image);
+        // Maps the file copy-on-write instead of reading it, so no pixel data is copied up front; the image
+        // pixels are not 16-byte aligned and writes through them are private to the process
+        // Files that need legacy expansion, DDS_FLAGS_LEGACY_DWORD, or DDS_FLAGS_BAD_DXTN_TAILS return
+        // HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED); use LoadFromDDSFile for those
 
     HRESULT __cdecl SaveToDDSMemory(
         _In_ const Image& image,
@@ -428,7 +490,9 @@ namespace DirectX
     HRESULT __cdecl FlipRotate(
         _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
         _In_ DWORD flags, _Out_ ScratchImage& result);
+    HRESULT __cdecl FlipRotate(_In_ const Image& srcImage, _In_ DWORD flags, _In_ const Image& destImage);
         // Flip and/or rotate image
+        // The Image overload writes into caller-owned memory; srcImage and destImage may alias for flips and TEX_FR_ROTATE180
 
     enum TEX_FILTER_FLAGS
     {
@@ -469,6 +533,11 @@ namespace DirectX
         TEX_FILTER_TRIANGLE         = 0x500000,
             // Filtering mode to use for any required image resizing
 
+        TEX_FILTER_LANCZOS3         = 0x600000,
+        TEX_FILTER_MITCHELL         = 0x700000,
+            // Windowed-sinc (3 lobes) and Mitchell-Netravali (B = C = 1/3) filters, only supported by Resize
+            // (combining them with TEX_FILTER_FORCE_WIC returns HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED))
+
         TEX_FILTER_SRGB_IN          = 0x1000000,
         TEX_FILTER_SRGB_OUT         = 0x2000000,
         TEX_FILTER_SRGB             = (TEX_FILTER_SRGB_IN | TEX_FILTER_SRGB_OUT),
@@ -476,11 +545,21 @@ namespace DirectX
             // if the input format type is IsSRGB(), then SRGB_IN is on by default
             // if the output format type is IsSRGB(), then SRGB_OUT is on by default
 
+        TEX_FILTER_NATIVE_FANT      = 0x4000000,
+            // Where the WIC Fant scaler would be used (default or Fant filter), use a native area-averaging implementation
+            // instead, which handles every format directly and honors TEX_FILTER_PARALLEL. It follows the WIC scaler's
+            // semantics (alpha-weighted color unless TEX_FILTER_SEPARATE_ALPHA) but is not guaranteed to match it exactly
+
         TEX_FILTER_FORCE_NON_WIC    = 0x10000000,
             // Forces use of the non-WIC path when both are an option
 
         TEX_FILTER_FORCE_WIC        = 0x20000000,
             // Forces use of the WIC path even when logic would have picked a non-WIC path when both are an option
+            // (this also overrides TEX_FILTER_NATIVE_FANT)
+
+        TEX_FILTER_PARALLEL         = 0x40000000,
+            // Resize or generate mipmaps using multiple threads (row bands, images, and volume slices) when the non-WIC path or
+            // TEX_FILTER_NATIVE_FANT is used (requires OpenMP)
     };
 
     HRESULT __cdecl Resize(
@@ -493,6 +572,16 @@ namespace DirectX
         // Resize the image to width x height. Defaults to Fant filtering.
         // Note for a complex resize, the result will always have mipLevels == 1
 
+    HRESULT __cdecl ResizeTiled(
+        _In_ DXGI_FORMAT format, _In_ size_t srcWidth, _In_ size_t srcHeight,
+        _In_ size_t width, _In_ size_t height, _In_ DWORD filter,
+        _In_ std::function<HRESULT __cdecl(size_t y, _In_ const Image& rows)> readRows,
+        _In_ std::function<HRESULT __cdecl(size_t y, _In_ const Image& rows)> writeRows,
+        _In_ size_t bandRows = 0);
+        // Resize an image that is never fully in memory: readRows must fill 'rows' with the source rows starting at y,
+        // and writeRows receives the destination rows starting at y in top-down order. Memory use depends on the widths,
+        // the filter support, and bandRows (defaults to 64), but not on the heights. Only supports the non-WIC filters.
+
     const float TEX_THRESHOLD_DEFAULT = 0.5f;
         // Default value for alpha threshold used when converting to 1-bit alpha
 
@@ -502,7 +591,13 @@ namespace DirectX
     HRESULT __cdecl Convert(
         _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
         _In_ DXGI_FORMAT format, _In_ DWORD filter, _In_ float threshold, _Out_ ScratchImage& result);
+    HRESULT __cdecl Convert(
+        _In_ const Image& srcImage, _In_ DWORD filter, _In_ float threshold, _In_ const Image& destImage);
+    HRESULT __cdecl Convert(_Inout_ ScratchImage& image, _In_ DXGI_FORMAT format, _In_ DWORD filter, _In_ float threshold);
         // Convert the image to a new format
+        // The Image overload converts into caller-owned memory using destImage.format, and may operate in-place if the bits-per-pixel match
+        // The ScratchImage overload converts all images in-place, which requires the new format to have the same bits-per-pixel
+        // If it fails after conversion has started, the format is unchanged but the pixel contents are undefined
 
     HRESULT __cdecl ConvertToSinglePlane(_In_ const Image& srcImage, _Out_ ScratchImage& image);
     HRESULT __cdecl ConvertToSinglePlane(
@@ -510,6 +605,36 @@ namespace DirectX
         _Out_ ScratchImage& image);
         // Converts the image from a planar format to an equivalent non-planar format
 
+    enum TEX_YUV_FLAGS
+    {
+        TEX_YUV_BT601               = 0,
+            // ITU-R BT.601 (standard definition) matrix, which is the one used by Convert for YUV formats
+
+        TEX_YUV_BT709               = 0x1,
+            // ITU-R BT.709 (high definition) matrix
+
+        TEX_YUV_BT2020              = 0x2,
+            // ITU-R BT.2020 (ultra high definition) non-constant luminance matrix
+    };
+
+    HRESULT __cdecl ConvertFromYUV(
+        _In_ const Image& srcImage, _In_ DXGI_FORMAT format, _In_ DWORD yuvFlags, _In_ DWORD filter, _In_ float threshold,
+        _Out_ ScratchImage& image);
+    HRESULT __cdecl ConvertFromYUV(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DXGI_FORMAT format, _In_ DWORD yuvFlags, _In_ DWORD filter, _In_ float threshold, _Out_ ScratchImage& result);
+        // Converts NV12, P010, P016, YUY2, Y210, or Y216 video images using the selected matrix
+        // Planar formats are read directly rather than being expanded with ConvertToSinglePlane first
+
+    HRESULT __cdecl ConvertToYUV(
+        _In_ const Image& srcImage, _In_ DXGI_FORMAT format, _In_ DWORD yuvFlags, _In_ DWORD filter,
+        _Out_ ScratchImage& image);
+    HRESULT __cdecl ConvertToYUV(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DXGI_FORMAT format, _In_ DWORD yuvFlags, _In_ DWORD filter, _Out_ ScratchImage& result);
+        // Converts to NV12, P010, P016, YUY2, Y210, or Y216 using the selected matrix
+        // Chroma is averaged over each 2x1 (4:2:2) or 2x2 (4:2:0) block of pixels
+
     HRESULT __cdecl GenerateMipMaps(
         _In_ const Image& baseImage, _In_ DWORD filter, _In_ size_t levels,
         _Inout_ ScratchImage& mipChain, _In_ bool allow1D = false);
@@ -528,6 +653,13 @@ namespace DirectX
         // levels of '0' indicates a full mipchain, otherwise is generates that number of total levels (including the source base image)
         // Defaults to Fant filtering which is equivalent to a box filter
 
+    HRESULT __cdecl ScaleMipMapsAlphaForCoverage(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata, _In_ size_t item,
+        _In_ float alphaReference, _Inout_ ScratchImage& mipChain);
+        // srcImages are the miplevels of one 1D/2D item, written to the same item of mipChain (which must already be
+        // initialized with metadata) with the alpha of each level below the top scaled so that the fraction of texels
+        // passing an alpha test against alphaReference matches the top level
+
     enum TEX_PMALPHA_FLAGS
     {
         TEX_PMALPHA_DEFAULT         = 0,
@@ -549,7 +681,10 @@ namespace DirectX
     HRESULT __cdecl PremultiplyAlpha(
         _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
         _In_ DWORD flags, _Out_ ScratchImage& result);
+    HRESULT __cdecl PremultiplyAlpha(_In_ const Image& srcImage, _In_ DWORD flags, _In_ const Image& destImage);
+    HRESULT __cdecl PremultiplyAlpha(_Inout_ ScratchImage& image, _In_ DWORD flags);
         // Converts to/from a premultiplied alpha version of the texture
+        // The Image and in-place ScratchImage overloads avoid allocating a new output (srcImage and destImage may alias)
 
     enum TEX_COMPRESS_FLAGS
     {
@@ -591,6 +726,17 @@ namespace DirectX
         _In_ DXGI_FORMAT format, _In_ DWORD compress, _In_ float threshold, _Out_ ScratchImage& cImages);
         // Note that threshold is only used by BC1. TEX_THRESHOLD_DEFAULT is a typical value to use
 
+    HRESULT __cdecl GenerateMipMapsAndCompress(
+        _In_ const Image& baseImage, _In_ DWORD filter, _In_ size_t levels,
+        _In_ DXGI_FORMAT format, _In_ DWORD compress, _In_ float threshold, _Out_ ScratchImage& cImage);
+    HRESULT __cdecl GenerateMipMapsAndCompress(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DWORD filter, _In_ size_t levels,
+        _In_ DXGI_FORMAT format, _In_ DWORD compress, _In_ float threshold, _Out_ ScratchImage& cImages);
+        // Equivalent to GenerateMipMaps followed by Compress for 1D/2D textures (levels of 0 for a full chain), but each
+        // level is encoded while the next one is filtered and is freed right after, so no uncompressed chain is kept
+        // Filtering always runs on the calling thread, so WIC-based filters need COM initialized there as for GenerateMipMaps
+
 #if defined(__d3d11_h__) || defined(__d3d11_x_h__)
     HRESULT __cdecl Compress(
         _In_ ID3D11Device* pDevice, _In_ const Image& srcImage, _In_ DXGI_FORMAT format, _In_ DWORD compress,
@@ -606,6 +752,69 @@ namespace DirectX
         _In_reads_(nimages) const Image* cImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
         _In_ DXGI_FORMAT format, _Out_ ScratchImage& images);
 
+    //---------------------------------------------------------------------------------
+    // Fused image operation pipeline
+
+    enum TEX_PIPELINE_FLAGS
+    {
+        TEX_PIPELINE_DEFAULT        = 0,
+
+        TEX_PIPELINE_PARALLEL       = 0x10000000,
+            // Process is free to use multithreading to improve performance (by default it does not use multithreading)
+    };
+
+    class ImagePipeline
+    {
+    public:
+        ImagePipeline() noexcept;
+        ImagePipeline(ImagePipeline&& moveFrom) noexcept;
+        ImagePipeline& __cdecl operator= (ImagePipeline&& moveFrom) noexcept;
+
+        ImagePipeline(const ImagePipeline&) = delete;
+        ImagePipeline& operator=(const ImagePipeline&) = delete;
+
+        ~ImagePipeline();
+
+        HRESULT __cdecl SetInput(_In_ DWORD filter);
+            // sRGB decode options for the source image (TEX_FILTER_SRGB_IN, defaults to IsSRGB() of the source)
+
+        HRESULT __cdecl AddPremultiplyAlpha(_In_ DWORD flags = TEX_PMALPHA_DEFAULT);
+            // Converts to/from premultiplied alpha (only TEX_PMALPHA_REVERSE is used, the pipeline always operates in linear space)
+
+        HRESULT __cdecl AddSwizzle(_In_ uint32_t e0, _In_ uint32_t e1, _In_ uint32_t e2, _In_ uint32_t e3);
+            // Channel swizzle using XM_SWIZZLE_X, XM_SWIZZLE_Y, XM_SWIZZLE_Z, or XM_SWIZZLE_W for each element
+
+        HRESULT __cdecl AddColorTransform(_In_ const XMMATRIX& transform);
+            // RGB color rotation (i.e. XMVector3Transform), alpha is unchanged
+
+        HRESULT __cdecl AddTransform(
+            _In_ std::function<void __cdecl(_Out_writes_(width) XMVECTOR* outPixels,
+            _In_reads_(width) const XMVECTOR* inPixels, size_t width, size_t y)> pixelFunc);
+            // User-supplied operation on linear RGBA scanlines
+
+        HRESULT __cdecl AddResize(_In_ size_t width, _In_ size_t height, _In_ DWORD filter);
+            // Only one resize per pipeline. Supports POINT, LINEAR, CUBIC, and BOX (for exact 2:1 reductions) filtering
+
+        HRESULT __cdecl SetOutput(_In_ DXGI_FORMAT format, _In_ DWORD filter = TEX_FILTER_DEFAULT, _In_ float threshold = TEX_THRESHOLD_DEFAULT);
+            // Encode target format, defaults to the source format. Supports TEX_FILTER_SRGB_OUT, TEX_FILTER_DITHER*, and Convert's channel flags
+
+        void __cdecl Reset();
+
+        HRESULT __cdecl Process(_In_ const Image& srcImage, _Out_ ScratchImage& image, _In_ DWORD flags = TEX_PIPELINE_DEFAULT) const;
+        HRESULT __cdecl Process(
+            _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+            _Out_ ScratchImage& result, _In_ DWORD flags = TEX_PIPELINE_DEFAULT) const;
+            // Runs all operations in cache-sized row bands writing directly into the single output allocation
+            // Note that if the pipeline contains a resize, the result will always have mipLevels == 1
+
+    private:
+        struct Impl;
+
+        std::unique_ptr<Impl> pImpl;
+
+        HRESULT __cdecl CreateImpl();
+    };
+
     //---------------------------------------------------------------------------------
     // Normal map operations
 
@@ -640,6 +849,72 @@ namespace DirectX
         _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
         _In_ DWORD flags, _In_ float amplitude, _In_ DXGI_FORMAT format, _Out_ ScratchImage& normalMaps);
 
+    //---------------------------------------------------------------------------------
+    // Cubemap and image based lighting operations
+
+    HRESULT __cdecl FixCubeMapEdges(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DWORD filter, _In_ size_t levels, _Out_ ScratchImage& result);
+        // Stretches every face of every level of a cubemap (or cubemap array) so its edge texels lie on the cube edges,
+        // sampling across face edges, for hardware without seamless cubemap filtering (CPU version of LegacyCubeMapEdgeFixer)
+        // If more levels are requested than the source has (levels of '0' for a full chain), the missing mips are first
+        // generated with a tent filter that reads across face edges (the filter mode is not used for them);
+        // TEX_FILTER_SRGB* and TEX_FILTER_PARALLEL (faces and levels) are also honored
+
+    HRESULT __cdecl EquirectToCubeMap(
+        _In_ const Image& srcImage, _In_ DWORD filter, _In_ size_t size, _Out_ ScratchImage& result);
+    HRESULT __cdecl CubeMapToEquirect(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DWORD filter, _In_ size_t width, _In_ size_t height, _Out_ ScratchImage& result);
+        // Converts between a cubemap and an equirectangular (latitude-longitude) panorama, whose center looks down +Z
+        // with +Y at the top; only the first cube of an array is projected, and the result keeps the source format
+        // A size of '0' keeps the same texel density (faces of width / 4, or a panorama of 4 * face width by half that)
+        // TEX_FILTER_POINT samples the nearest texel, other filter modes sample bilinearly after reducing a source
+        // with more detail than the result (the panorama with Resize, the cubemap with its mips)
+        // TEX_FILTER_SRGB* and TEX_FILTER_PARALLEL (rows) are also honored
+
+    HRESULT __cdecl PrefilterSpecularCubeMap(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DWORD filter, _In_ size_t sampleCount, _In_ size_t levels, _Out_ ScratchImage& result);
+        // GGX prefiltered specular environment map for image based lighting (CPU version of IBLCompute::GenerateSpecularMap)
+        // Level n of the result is the source convolved for roughness n / (levels - 1) using sampleCount importance samples,
+        // which read from the source mip chain (generated with the filter mode when incomplete) to match their solid angle
+        // TEX_FILTER_SRGB* and TEX_FILTER_PARALLEL (face rows) are also honored
+
+    HRESULT __cdecl ProjectCubeMapToSH(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ size_t cube, _In_ DWORD filter, _In_ size_t order, _Out_writes_(order * order) XMFLOAT3* coefficients);
+        // Projects the top level of a cube (of a cubemap array) onto real spherical harmonics of order 1 to 3, weighting
+        // each texel by its solid angle; coefficients are RGB radiance ordered (l, m) = (0, 0), (1, -1), (1, 0), (1, 1), (2, -2)...
+        // TEX_FILTER_SRGB_IN and TEX_FILTER_PARALLEL are honored
+
+    HRESULT __cdecl GenerateIrradianceCubeMap(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DWORD filter, _In_ size_t order, _In_ size_t size, _Out_ ScratchImage& result);
+        // Diffuse irradiance environment map (divided by pi) evaluated from an SH projection of order 1 to 3, as a fast
+        // alternative to the per-texel convolution of IBLSampler's PS_DiffuseCubeMap; size of '0' keeps the source size
+        // Output has a single level in the source format; TEX_FILTER_SRGB* and TEX_FILTER_PARALLEL are honored
+
+    enum BRDF_LUT_FLAGS
+    {
+        BRDF_LUT_DEFAULT        = 0,
+            // Schlick-Beckmann geometry term (Shaders/BRDF/schlick.hlsl)
+
+        BRDF_LUT_SMITH          = 0x1,
+            // Smith GGX geometry term (Shaders/BRDF/smith.hlsl)
+
+        BRDF_LUT_PARALLEL       = 0x10000000,
+            // Rows are computed using multithreading
+    };
+
+    HRESULT __cdecl GenerateBRDFLookupTable(
+        _In_ size_t width, _In_ size_t height, _In_ size_t sampleCount, _In_ DWORD flags, _In_ DXGI_FORMAT format,
+        _In_opt_z_ const wchar_t* cacheDirectory, _Out_ ScratchImage& result);
+        // Split-sum environment BRDF table: x is N.V and y is roughness (texel centers in (0, 1)), red is the scale and
+        // green the bias applied to F0, integrated over sampleCount GGX importance samples; format is R16G16_FLOAT or
+        // R32G32_FLOAT. With a cache directory the table is reused from (or saved to) a DDS file named after the size,
+        // sample count, model and format, so repeated bakes compute it only once
+
     //---------------------------------------------------------------------------------
     // Misc image operations
 
@@ -658,6 +933,18 @@ namespace DirectX
         _In_ const Image& srcImage, _In_ const Rect& srcRect, _In_ const Image& dstImage,
         _In_ DWORD filter, _In_ size_t xOffset, _In_ size_t yOffset);
 
+    HRESULT __cdecl UpdateMipMaps(
+        _In_reads_(nimages) const Image* images, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ size_t item, _In_ const Rect& dirtyRect, _In_ DWORD filter,
+        _Out_writes_opt_(metadata.mipLevels) Rect* levelRects = nullptr,
+        _Out_writes_opt_(metadata.mipLevels) Rect* blockRects = nullptr);
+        // Regenerates in place only the texels of mips 1...n of a 1D/2D item affected by a change to dirtyRect of mip 0,
+        // using the filter's support and wrap/mirror flags (same filters and defaults as GenerateMipMaps, non-WIC only).
+        // WIC and TEX_FILTER_NATIVE_FANT rebuild every level from mip 0 so they return ERROR_NOT_SUPPORTED; for
+        // WIC-supported formats the chain must be built with TEX_FILTER_FORCE_NON_WIC and an explicit box/linear filter.
+        // Optionally returns the updated rectangle of every level, and the same rectangles in 4x4 block units for
+        // recompressing just those BC blocks
+
     enum CMSE_FLAGS
     {
         CMSE_DEFAULT                = 0,
@@ -696,6 +983,12 @@ namespace DirectX
         _In_ std::function<void __cdecl(_Out_writes_(width) XMVECTOR* outPixels,
         _In_reads_(width) const XMVECTOR* inPixels, size_t width, size_t y)> pixelFunc,
         ScratchImage& result);
+    HRESULT __cdecl TransformImage(
+        _In_ const Image& image,
+        _In_ std::function<void __cdecl(_Out_writes_(width) XMVECTOR* outPixels,
+        _In_reads_(width) const XMVECTOR* inPixels, size_t width, size_t y)> pixelFunc,
+        _In_ const Image& destImage);
+        // The Image overload writes into caller-owned memory of the same format and size (image and destImage may alias)
 
     //---------------------------------------------------------------------------------
     // WIC utility code
@@ -20,6 +20,13 @@
 
 using namespace DirectX;
 
+namespace DirectX
+{
+    extern bool _CalculateMipLevels(_In_ size_t width, _In_ size_t height, _Inout_ size_t& mipLevels);
+    extern HRESULT _SelectMipFilter(_In_ const TexMetadata& metadata, _In_ DWORD filter, _Out_ DWORD& mipFilter);
+    extern HRESULT _GenerateMipLevel(_In_ const Image& baseImage, _In_ const Image& srcImage, _In_ DWORD mipFilter, _Out_ ScratchImage& nextLevel);
+}
+
 namespace
 {
     inline DWORD GetBCFlags(_In_ DWORD compress)
@@ -717,6 +724,176 @@ HRESULT DirectX::Compress(
 }
 
 
+//-------------------------------------------------------------------------------------
+// Mipmap generation with compression
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::GenerateMipMapsAndCompress(
+    const Image& baseImage,
+    DWORD filter,
+    size_t levels,
+    DXGI_FORMAT format,
+    DWORD compress,
+    float threshold,
+    ScratchImage& cImage)
+{
+    TexMetadata mdata = {};
+    mdata.width = baseImage.width;
+    mdata.height = baseImage.height;
+    mdata.depth = mdata.arraySize = mdata.mipLevels = 1;
+    mdata.format = baseImage.format;
+    mdata.dimension = TEX_DIMENSION_TEXTURE2D;
+
+    return GenerateMipMapsAndCompress(&baseImage, 1, mdata, filter, levels, format, compress, threshold, cImage);
+}
+
+_Use_decl_annotations_
+HRESULT DirectX::GenerateMipMapsAndCompress(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DWORD filter,
+    size_t levels,
+    DXGI_FORMAT format,
+    DWORD compress,
+    float threshold,
+    ScratchImage& cImages)
+{
+    if (!srcImages || !nimages)
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format) || !IsCompressed(format))
+        return E_INVALIDARG;
+
+    if (metadata.IsVolumemap()
+        || IsTypeless(format)
+        || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+#ifndef _OPENMP
+    if (compress & TEX_COMPRESS_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    if (!_CalculateMipLevels(metadata.width, metadata.height, levels))
+        return E_INVALIDARG;
+
+    // Resolve the filter once for the whole chain, exactly as GenerateMipMaps would
+    DWORD mipFilter = 0;
+    HRESULT hr = _SelectMipFilter(metadata, filter, mipFilter);
+    if (FAILED(hr))
+        return hr;
+
+    cImages.Release();
+
+    TexMetadata mdata2 = metadata;
+    mdata2.format = format;
+    mdata2.mipLevels = levels;
+    hr = cImages.Initialize(mdata2);
+    if (FAILED(hr))
+        return hr;
+
+    const DWORD bcflags = GetBCFlags(compress);
+    const DWORD srgb = GetSRGBFlags(compress);
+
+    for (size_t item = 0; item < metadata.arraySize; ++item)
+    {
+        size_t index = metadata.ComputeIndex(0, item, 0);
+        if (index >= nimages)
+        {
+            cImages.Release();
+            return E_FAIL;
+        }
+
+        const Image& base = srcImages[index];
+        if (!base.pixels)
+        {
+            cImages.Release();
+            return E_POINTER;
+        }
+
+        if (base.format != metadata.format || base.width != metadata.width || base.height != metadata.height)
+        {
+            // All base images must be the same format, width, and height
+            cImages.Release();
+            return E_FAIL;
+        }
+
+        // Only the level being encoded and the one being filtered from it are kept uncompressed
+        ScratchImage current;
+        const Image* level = &base;
+
+        for (size_t mip = 0; mip < levels; ++mip)
+        {
+            const Image* dest = cImages.GetImage(mip, item, 0);
+            if (!dest || dest->width != level->width || dest->height != level->height)
+            {
+                cImages.Release();
+                return E_FAIL;
+            }
+
+            const bool more = (mip + 1) < levels;
+
+            HRESULT hrCompress = S_OK;
+            HRESULT hrNext = S_OK;
+            ScratchImage next;
+
+#ifdef _OPENMP
+            if (compress & TEX_COMPRESS_PARALLEL)
+            {
+                // The encoder is already using every core, so run the two steps back to back
+                hrCompress = CompressBC_Parallel(*level, *dest, bcflags, srgb, threshold);
+                if (SUCCEEDED(hrCompress) && more)
+                    hrNext = _GenerateMipLevel(base, *level, mipFilter, next);
+            }
+            else if (more)
+            {
+                // Encode this level while the next one is filtered. The filtering stays on the calling thread
+                // (thread 0 of the team) since the WIC path needs the caller's COM initialization
+#pragma omp parallel num_threads(2)
+                {
+                    const int thread = omp_get_thread_num();
+                    const bool single = (omp_get_num_threads() < 2);
+
+                    if (thread == 0)
+                        hrNext = _GenerateMipLevel(base, *level, mipFilter, next);
+
+                    if (thread == 1 || single)
+                        hrCompress = CompressBC(*level, *dest, bcflags, srgb, threshold);
+                }
+            }
+            else
+#endif // _OPENMP
+            {
+                hrCompress = CompressBC(*level, *dest, bcflags, srgb, threshold);
+                if (SUCCEEDED(hrCompress) && more)
+                    hrNext = _GenerateMipLevel(base, *level, mipFilter, next);
+            }
+
+            if (FAILED(hrCompress) || FAILED(hrNext))
+            {
+                cImages.Release();
+                return FAILED(hrCompress) ? hrCompress : hrNext;
+            }
+
+            if (more)
+            {
+                // This level is encoded, so release it and continue from the one just filtered
+                current = std::move(next);
+                level = current.GetImage(0, 0, 0);
+                if (!level)
+                {
+                    cImages.Release();
+                    return E_POINTER;
+                }
+            }
+        }
+    }
+
+    return S_OK;
+}
+
+
 //-------------------------------------------------------------------------------------
 // Decompression
 //-------------------------------------------------------------------------------------
@@ -192,6 +192,229 @@ namespace
     const XMVECTORF32 g_HalfMin   = { { { -65504.f, -65504.f, -65504.f, -65504.f } } };
     const XMVECTORF32 g_HalfMax   = { { { 65504.f, 65504.f, 65504.f, 65504.f } } };
     const XMVECTORF32 g_8BitBias  = { { { 0.5f / 255.f, 0.5f / 255.f, 0.5f / 255.f, 0.5f / 255.f } } };
+
+    //-------------------------------------------------------------------------------------
+    // Batch packing/unpacking of DXGI_FORMAT_R9G9B9E5_SHAREDEXP and DXGI_FORMAT_R11G11B10_FLOAT
+    //
+    // Four pixels are transposed into SoA form and converted together. The integer steps
+    // of the scalar XMLoadFloat3SE/XMStoreFloat3SE and XMLoadFloat3PK/XMStoreFloat3PK are
+    // done with vector integer ops, and bit shifts use exact float<->int conversions. The
+    // results match the scalar functions, including round-to-nearest-even.
+    //-------------------------------------------------------------------------------------
+    const XMVECTORF32 g_MaxFloat9E5     = { { { float(0x1FF << 7), float(0x1FF << 7), float(0x1FF << 7), float(0x1FF << 7) } } };
+    const XMVECTORF32 g_MinFloat9E5     = { { { 1.f / (1 << 16), 1.f / (1 << 16), 1.f / (1 << 16), 1.f / (1 << 16) } } };
+    const XMVECTORF32 g_Bias9E5         = { { { 103.f, 103.f, 103.f, 103.f } } };
+    const XMVECTORU32 g_Round9E5        = { { { 0x4000, 0x4000, 0x4000, 0x4000 } } };
+    const XMVECTORU32 g_FloatExpMask    = { { { 0x7F800000, 0x7F800000, 0x7F800000, 0x7F800000 } } };
+    const XMVECTORU32 g_ScaleBias9E5    = { { { 0x83000000, 0x83000000, 0x83000000, 0x83000000 } } };
+    const XMVECTORU32 g_ExpBias9E5      = { { { 0x6Fu << 27, 0x6Fu << 27, 0x6Fu << 27, 0x6Fu << 27 } } };
+    const XMVECTORU32 g_Mask9E5R        = { { { 0x000001FF, 0x000001FF, 0x000001FF, 0x000001FF } } };
+    const XMVECTORU32 g_Mask9E5G        = { { { 0x0003FE00, 0x0003FE00, 0x0003FE00, 0x0003FE00 } } };
+    const XMVECTORU32 g_Mask9E5B        = { { { 0x07FC0000, 0x07FC0000, 0x07FC0000, 0x07FC0000 } } };
+    const XMVECTORU32 g_Mask9E5E        = { { { 0xF8000000, 0xF8000000, 0xF8000000, 0xF8000000 } } };
+
+    const XMVECTORU32 g_MaskPK11R       = { { { 0x000007FF, 0x000007FF, 0x000007FF, 0x000007FF } } };
+    const XMVECTORU32 g_MaskPK11G       = { { { 0x003FF800, 0x003FF800, 0x003FF800, 0x003FF800 } } };
+    const XMVECTORU32 g_MaskPK10B       = { { { 0xFFC00000, 0xFFC00000, 0xFFC00000, 0xFFC00000 } } };
+    const XMVECTORU32 g_SpecialPK       = { { { 0x0F800000, 0x0F800000, 0x0F800000, 0x0F800000 } } };
+    const XMVECTORU32 g_RebiasDownPK    = { { { 0x07800000, 0x07800000, 0x07800000, 0x07800000 } } }; // 2^-112
+    const XMVECTORU32 g_RebiasUpPK      = { { { 0x77800000, 0x77800000, 0x77800000, 0x77800000 } } }; // 2^112
+    const XMVECTORU32 g_Scale37PK       = { { { 0x52000000, 0x52000000, 0x52000000, 0x52000000 } } }; // 2^37
+    const XMVECTORU32 g_MinNormalPK     = { { { 0x38800000, 0x38800000, 0x38800000, 0x38800000 } } }; // 2^-14
+
+    // Converts four values to the 6e5 (mantissaBits = 6) or 5e5 (mantissaBits = 5) float codes
+    // returned as exact integers in float form. NaN and infinity must be handled by the caller.
+    template<uint32_t mantissaBits>
+    inline XMVECTOR XM_CALLCONV PackFloatPK(FXMVECTOR V)
+    {
+        const uint32_t shift = 23 - mantissaBits;
+        const XMVECTOR lsbMask = XMVectorReplicateInt(1u << shift);
+        const XMVECTOR roundBias = XMVectorReplicateInt((1u << (shift - 1)) - 1);
+        const XMVECTOR codeMask = XMVectorReplicateInt(((1u << (mantissaBits + 5)) - 1) << shift);
+        const XMVECTOR maxValue = XMVectorReplicateInt((mantissaBits == 6) ? 0x477E0000 : 0x477C0000);
+        const XMVECTOR minValue = XMVectorReplicateInt((mantissaBits == 6) ? 0x35800000 : 0x36000000);
+        const XMVECTOR denormScale = XMVectorReplicateInt((127 - shift) << 23);
+
+        // Negative values clamp to zero, large values to the largest finite code
+        XMVECTOR x = XMVectorMin(XMVectorMax(V, g_XMZero), maxValue);
+
+        // Normalized: rebias the exponent from 127 to 15 and round the bits below the mantissa
+        XMVECTOR bits = XMVectorMultiply(x, g_RebiasDownPK);
+        XMVECTOR lsb = XMVectorEqualInt(XMVectorAndInt(bits, lsbMask), lsbMask);
+        bits = XMVectorSubtractInt(XMVectorAddInt(bits, roundBias), lsb);
+        XMVECTOR normal = XMConvertVectorUIntToFloat(XMVectorAndInt(bits, codeMask), shift);
+
+        // Denormalized: truncate to the scalar's fixed-point position, then round
+        XMVECTOR denormal = XMVectorTruncate(XMVectorMultiply(x, g_Scale37PK));
+        denormal = XMVectorRound(XMVectorMultiply(denormal, denormScale));
+
+        XMVECTOR code = XMVectorSelect(normal, denormal, XMVectorLess(x, g_MinNormalPK));
+        return XMVectorSelect(code, g_XMZero, XMVectorLess(x, minValue));
+    }
+
+    // Converts four 6e5 or 5e5 codes (already shifted so the exponent is at bit 23) to float
+    inline XMVECTOR XM_CALLCONV UnpackFloatPK(FXMVECTOR bits)
+    {
+        XMVECTOR special = XMVectorEqualInt(XMVectorAndInt(bits, g_SpecialPK), g_SpecialPK);
+        XMVECTOR v = XMVectorMultiply(bits, g_RebiasUpPK);
+        return XMVectorSelect(v, XMVectorOrInt(bits, g_XMInfinity), special);
+    }
+
+    void StoreFloat3PKBatch(
+        _Out_writes_(count) XMFLOAT3PK* pDestination,
+        _In_reads_(count) const XMVECTOR* pSource,
+        size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            XMMATRIX m = XMMatrixTranspose(XMMATRIX(pSource[i], pSource[i + 1], pSource[i + 2], pSource[i + 3]));
+
+            XMVECTOR special = XMVectorOrInt(XMVectorIsNaN(m.r[0]), XMVectorIsInfinite(m.r[0]));
+            special = XMVectorOrInt(special, XMVectorOrInt(XMVectorIsNaN(m.r[1]), XMVectorIsInfinite(m.r[1])));
+            special = XMVectorOrInt(special, XMVectorOrInt(XMVectorIsNaN(m.r[2]), XMVectorIsInfinite(m.r[2])));
+            if (!XMVector4EqualInt(special, g_XMZero))
+            {
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    XMStoreFloat3PK(&pDestination[i + j], pSource[i + j]);
+                }
+                continue;
+            }
+
+            XMVECTOR v = XMConvertVectorFloatToUInt(PackFloatPK<6>(m.r[0]), 0);
+            v = XMVectorOrInt(v, XMConvertVectorFloatToUInt(PackFloatPK<6>(m.r[1]), 11));
+            v = XMVectorOrInt(v, XMConvertVectorFloatToUInt(PackFloatPK<5>(m.r[2]), 22));
+            XMStoreInt4(&pDestination[i].v, v);
+        }
+
+        for (; i < count; ++i)
+        {
+            XMStoreFloat3PK(&pDestination[i], pSource[i]);
+        }
+    }
+
+    void LoadFloat3PKBatch(
+        _Out_writes_(count) XMVECTOR* pDestination,
+        _In_reads_(count) const XMFLOAT3PK* pSource,
+        size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            XMVECTOR v = XMLoadInt4(&pSource[i].v);
+
+            XMVECTOR r = XMConvertVectorUIntToFloat(XMVectorAndInt(v, g_MaskPK11R), 0);
+            XMVECTOR g = XMConvertVectorUIntToFloat(XMVectorAndInt(v, g_MaskPK11G), 11);
+            XMVECTOR b = XMConvertVectorUIntToFloat(XMVectorAndInt(v, g_MaskPK10B), 22);
+
+            r = UnpackFloatPK(XMConvertVectorFloatToUInt(r, 17));
+            g = UnpackFloatPK(XMConvertVectorFloatToUInt(g, 17));
+            b = UnpackFloatPK(XMConvertVectorFloatToUInt(b, 18));
+
+            XMMATRIX m = XMMatrixTranspose(XMMATRIX(r, g, b, g_XMOne));
+            pDestination[i] = m.r[0];
+            pDestination[i + 1] = m.r[1];
+            pDestination[i + 2] = m.r[2];
+            pDestination[i + 3] = m.r[3];
+        }
+
+        for (; i < count; ++i)
+        {
+            pDestination[i] = XMVectorSelect(g_XMIdentityR3, XMLoadFloat3PK(&pSource[i]), g_XMSelect1110);
+        }
+    }
+
+    void StoreFloat3SEBatch(
+        _Out_writes_(count) XMFLOAT3SE* pDestination,
+        _In_reads_(count) const XMVECTOR* pSource,
+        size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            XMMATRIX m = XMMatrixTranspose(XMMATRIX(pSource[i], pSource[i + 1], pSource[i + 2], pSource[i + 3]));
+
+            // Negative and NaN clamp to zero, large values to the largest finite value
+            XMVECTOR r = XMVectorMin(XMVectorSelect(g_XMZero, m.r[0], XMVectorGreaterOrEqual(m.r[0], g_XMZero)), g_MaxFloat9E5);
+            XMVECTOR g = XMVectorMin(XMVectorSelect(g_XMZero, m.r[1], XMVectorGreaterOrEqual(m.r[1], g_XMZero)), g_MaxFloat9E5);
+            XMVECTOR b = XMVectorMin(XMVectorSelect(g_XMZero, m.r[2], XMVectorGreaterOrEqual(m.r[2], g_XMZero)), g_MaxFloat9E5);
+
+            XMVECTOR maxColor = XMVectorMax(XMVectorMax(XMVectorMax(r, g), b), g_MinFloat9E5);
+
+            // Round up leaving 9 bits in fraction (including assumed 1)
+            XMVECTOR expBits = XMVectorAndInt(XMVectorAddInt(maxColor, g_Round9E5), g_FloatExpMask);
+            XMVECTOR scaleR = XMVectorSubtractInt(g_ScaleBias9E5, expBits);
+
+            // Values are non-negative here, so truncating after adding 0.5 rounds ties away from zero like the
+            // lroundf in the scalar path (XMVectorRound would round ties to even)
+            r = XMVectorTruncate(XMVectorAdd(XMVectorMultiply(r, scaleR), g_XMOneHalf));
+            g = XMVectorTruncate(XMVectorAdd(XMVectorMultiply(g, scaleR), g_XMOneHalf));
+            b = XMVectorTruncate(XMVectorAdd(XMVectorMultiply(b, scaleR), g_XMOneHalf));
+
+            // Move the exponent from bit 23 to bit 27 and remove the bias
+            XMVECTOR e = XMVectorAddInt(expBits, expBits);
+            e = XMVectorAddInt(e, e);
+            e = XMVectorAddInt(e, e);
+            e = XMVectorAddInt(e, e);
+            e = XMVectorSubtractInt(e, g_ExpBias9E5);
+
+            XMVECTOR v = XMVectorOrInt(XMConvertVectorFloatToUInt(r, 0), XMConvertVectorFloatToUInt(g, 9));
+            v = XMVectorOrInt(v, XMConvertVectorFloatToUInt(b, 18));
+            v = XMVectorOrInt(v, e);
+            XMStoreInt4(&pDestination[i].v, v);
+
+#ifdef _DEBUG
+            // The encoding of a pixel must not depend on whether it lands in a batch or in the scalar tail
+            for (size_t j = 0; j < 4; ++j)
+            {
+                XMFLOAT3SE check;
+                StoreFloat3SE(&check, pSource[i + j]);
+                assert(check.v == pDestination[i + j].v);
+            }
+#endif
+        }
+
+        for (; i < count; ++i)
+        {
+            StoreFloat3SE(&pDestination[i], pSource[i]);
+        }
+    }
+
+    void LoadFloat3SEBatch(
+        _Out_writes_(count) XMVECTOR* pDestination,
+        _In_reads_(count) const XMFLOAT3SE* pSource,
+        size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            XMVECTOR v = XMLoadInt4(&pSource[i].v);
+
+            XMVECTOR r = XMConvertVectorUIntToFloat(XMVectorAndInt(v, g_Mask9E5R), 0);
+            XMVECTOR g = XMConvertVectorUIntToFloat(XMVectorAndInt(v, g_Mask9E5G), 9);
+            XMVECTOR b = XMConvertVectorUIntToFloat(XMVectorAndInt(v, g_Mask9E5B), 18);
+
+            // Scale is 2^(e - 15 - 9), built directly as float bits
+            XMVECTOR e = XMConvertVectorUIntToFloat(XMVectorAndInt(v, g_Mask9E5E), 27);
+            XMVECTOR scale = XMConvertVectorFloatToInt(XMVectorAdd(e, g_Bias9E5), 23);
+
+            r = XMVectorMultiply(r, scale);
+            g = XMVectorMultiply(g, scale);
+            b = XMVectorMultiply(b, scale);
+
+            XMMATRIX m = XMMatrixTranspose(XMMATRIX(r, g, b, g_XMOne));
+            pDestination[i] = m.r[0];
+            pDestination[i + 1] = m.r[1];
+            pDestination[i + 2] = m.r[2];
+            pDestination[i + 3] = m.r[3];
+        }
+
+        for (; i < count; ++i)
+        {
+            pDestination[i] = XMVectorSelect(g_XMIdentityR3, XMLoadFloat3SE(&pSource[i]), g_XMSelect1110);
+        }
+    }
 }
 
 //-------------------------------------------------------------------------------------
@@ -883,7 +1106,13 @@ _Use_decl_annotations_ bool DirectX::_LoadScanline(
         LOAD_SCANLINE(XMUDEC4, XMLoadUDec4);
 
     case DXGI_FORMAT_R11G11B10_FLOAT:
-        LOAD_SCANLINE3(XMFLOAT3PK, XMLoadFloat3PK, g_XMIdentityR3);
+        if (size >= sizeof(XMFLOAT3PK))
+        {
+            size_t n = std::min<size_t>(size / sizeof(XMFLOAT3PK), count);
+            LoadFloat3PKBatch(dPtr, static_cast<const XMFLOAT3PK*>(pSource), n);
+            return true;
+        }
+        return false;
 
     case DXGI_FORMAT_R8G8B8A8_UNORM:
     case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
@@ -1166,7 +1395,13 @@ _Use_decl_annotations_ bool DirectX::_LoadScanline(
         return false;
 
     case DXGI_FORMAT_R9G9B9E5_SHAREDEXP:
-        LOAD_SCANLINE3(XMFLOAT3SE, XMLoadFloat3SE, g_XMIdentityR3)
+        if (size >= sizeof(XMFLOAT3SE))
+        {
+            size_t n = std::min<size_t>(size / sizeof(XMFLOAT3SE), count);
+            LoadFloat3SEBatch(dPtr, static_cast<const XMFLOAT3SE*>(pSource), n);
+            return true;
+        }
+        return false;
 
     case DXGI_FORMAT_R8G8_B8G8_UNORM:
         if (size >= sizeof(XMUBYTEN4))
@@ -1709,7 +1944,13 @@ bool DirectX::_StoreScanline(
         STORE_SCANLINE(XMUDEC4, XMStoreUDec4);
 
     case DXGI_FORMAT_R11G11B10_FLOAT:
-        STORE_SCANLINE(XMFLOAT3PK, XMStoreFloat3PK);
+        if (size >= sizeof(XMFLOAT3PK))
+        {
+            size_t n = std::min<size_t>(size / sizeof(XMFLOAT3PK), count);
+            StoreFloat3PKBatch(static_cast<XMFLOAT3PK*>(pDestination), sPtr, n);
+            return true;
+        }
+        return false;
 
     case DXGI_FORMAT_R8G8B8A8_UNORM:
     case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
@@ -2010,7 +2251,13 @@ bool DirectX::_StoreScanline(
         return false;
 
     case DXGI_FORMAT_R9G9B9E5_SHAREDEXP:
-        STORE_SCANLINE(XMFLOAT3SE, StoreFloat3SE)
+        if (size >= sizeof(XMFLOAT3SE))
+        {
+            size_t n = std::min<size_t>(size / sizeof(XMFLOAT3SE), count);
+            StoreFloat3SEBatch(static_cast<XMFLOAT3SE*>(pDestination), sPtr, n);
+            return true;
+        }
+        return false;
 
     case DXGI_FORMAT_R8G8_B8G8_UNORM:
         if (size >= sizeof(XMUBYTEN4))
@@ -4348,6 +4595,39 @@ bool DirectX::_StoreScanlineDither(
 
 namespace
 {
+    //-------------------------------------------------------------------------------------
+    // Selection logic for using the integer UNORM bit-depth reduction kernels
+    //-------------------------------------------------------------------------------------
+    bool UseIntegerConversion(_In_ DWORD filter, _In_ DXGI_FORMAT sformat, _In_ DXGI_FORMAT tformat)
+    {
+        if (filter & (TEX_FILTER_DITHER | TEX_FILTER_DITHER_DIFFUSION | TEX_FILTER_SRGB))
+            return false;
+
+        switch (sformat)
+        {
+        case DXGI_FORMAT_R8G8B8A8_UNORM:
+        case DXGI_FORMAT_B8G8R8A8_UNORM:
+        case DXGI_FORMAT_B8G8R8X8_UNORM:
+            switch (tformat)
+            {
+            case DXGI_FORMAT_B5G6R5_UNORM:
+            case DXGI_FORMAT_B5G5R5A1_UNORM:
+            case DXGI_FORMAT_B4G4R4A4_UNORM:
+                return true;
+
+            default:
+                return false;
+            }
+
+        case DXGI_FORMAT_R16G16B16A16_UNORM:
+            return (tformat == DXGI_FORMAT_R8G8B8A8_UNORM || tformat == DXGI_FORMAT_B8G8R8A8_UNORM);
+
+        default:
+            return false;
+        }
+    }
+
+
     //-------------------------------------------------------------------------------------
     // Selection logic for using WIC vs. our own routines
     //-------------------------------------------------------------------------------------
@@ -4379,6 +4659,12 @@ namespace
             return true;
         }
 
+        if (UseIntegerConversion(filter, sformat, tformat))
+        {
+            // Our integer kernels are exact and avoid the WIC setup cost
+            return false;
+        }
+
         if (filter & TEX_FILTER_SEPARATE_ALPHA)
         {
             // Alpha is not premultiplied, so use non-WIC code paths
@@ -4559,6 +4845,126 @@ namespace
     }
 
 
+    //-------------------------------------------------------------------------------------
+    // Integer conversion for UNORM bit-depth reductions
+    //
+    // These produce the same results as the XMVECTOR path (_LoadScanline, _StoreScanline)
+    // for the supported format pairs: the scaled values never fall exactly halfway between
+    // two codes, so exact integer rounding matches the float rounding.
+    //-------------------------------------------------------------------------------------
+    inline uint32_t Requantize8(uint32_t v, uint32_t maxValue)
+    {
+        return (v * maxValue + 127) / 255;
+    }
+
+    inline uint32_t Requantize16To8(uint32_t v)
+    {
+        return (v * 255 + 32767) / 65535;
+    }
+
+    HRESULT ConvertUsingInteger(
+        _In_ const Image& srcImage,
+        _In_ const Image& destImage,
+        _In_ float threshold)
+    {
+        assert(srcImage.width == destImage.width);
+        assert(srcImage.height == destImage.height);
+
+        const uint8_t *pSrc = srcImage.pixels;
+        uint8_t *pDest = destImage.pixels;
+        if (!pSrc || !pDest)
+            return E_POINTER;
+
+        const size_t width = srcImage.width;
+
+        if (srcImage.format == DXGI_FORMAT_R16G16B16A16_UNORM)
+        {
+            if ((width * sizeof(XMUSHORTN4)) > srcImage.rowPitch || (width * sizeof(uint32_t)) > destImage.rowPitch)
+                return E_FAIL;
+
+            const bool bgr = (destImage.format == DXGI_FORMAT_B8G8R8A8_UNORM);
+
+            for (size_t h = 0; h < srcImage.height; ++h)
+            {
+                const uint16_t * __restrict sPtr = reinterpret_cast<const uint16_t*>(pSrc);
+                uint32_t * __restrict dPtr = reinterpret_cast<uint32_t*>(pDest);
+
+                for (size_t x = 0; x < width; ++x, sPtr += 4)
+                {
+                    uint32_t r = Requantize16To8(sPtr[0]);
+                    uint32_t g = Requantize16To8(sPtr[1]);
+                    uint32_t b = Requantize16To8(sPtr[2]);
+                    uint32_t a = Requantize16To8(sPtr[3]);
+
+                    *(dPtr++) = (bgr ? (b | (r << 16)) : (r | (b << 16))) | (g << 8) | (a << 24);
+                }
+
+                pSrc += srcImage.rowPitch;
+                pDest += destImage.rowPitch;
+            }
+
+            return S_OK;
+        }
+
+        if ((width * sizeof(uint32_t)) > srcImage.rowPitch || (width * sizeof(uint16_t)) > destImage.rowPitch)
+            return E_FAIL;
+
+        // The 1-bit alpha test is done on the same float value _LoadScanline produces
+        uint32_t alphaRef = 256;
+        for (uint32_t a = 0; a < 256; ++a)
+        {
+            XMUBYTEN4 p(0, 0, 0, static_cast<uint8_t>(a));
+            if (XMVectorGetW(XMLoadUByteN4(&p)) > threshold)
+            {
+                alphaRef = a;
+                break;
+            }
+        }
+
+        const bool bgr = (srcImage.format != DXGI_FORMAT_R8G8B8A8_UNORM);
+        const bool opaque = (srcImage.format == DXGI_FORMAT_B8G8R8X8_UNORM);
+
+        for (size_t h = 0; h < srcImage.height; ++h)
+        {
+            const uint32_t * __restrict sPtr = reinterpret_cast<const uint32_t*>(pSrc);
+            uint16_t * __restrict dPtr = reinterpret_cast<uint16_t*>(pDest);
+
+            for (size_t x = 0; x < width; ++x)
+            {
+                uint32_t t = *(sPtr++);
+
+                uint32_t r = bgr ? ((t >> 16) & 0xFF) : (t & 0xFF);
+                uint32_t g = (t >> 8) & 0xFF;
+                uint32_t b = bgr ? (t & 0xFF) : ((t >> 16) & 0xFF);
+                uint32_t a = opaque ? 255 : (t >> 24);
+
+                switch (destImage.format)
+                {
+                case DXGI_FORMAT_B5G6R5_UNORM:
+                    *(dPtr++) = static_cast<uint16_t>(Requantize8(b, 31) | (Requantize8(g, 63) << 5) | (Requantize8(r, 31) << 11));
+                    break;
+
+                case DXGI_FORMAT_B5G5R5A1_UNORM:
+                    *(dPtr++) = static_cast<uint16_t>(Requantize8(b, 31) | (Requantize8(g, 31) << 5) | (Requantize8(r, 31) << 10)
+                        | ((a >= alphaRef) ? 0x8000 : 0));
+                    break;
+
+                default:
+                    assert(destImage.format == DXGI_FORMAT_B4G4R4A4_UNORM);
+                    *(dPtr++) = static_cast<uint16_t>(Requantize8(b, 15) | (Requantize8(g, 15) << 4) | (Requantize8(r, 15) << 8)
+                        | (Requantize8(a, 15) << 12));
+                    break;
+                }
+            }
+
+            pSrc += srcImage.rowPitch;
+            pDest += destImage.rowPitch;
+        }
+
+        return S_OK;
+    }
+
+
     //-------------------------------------------------------------------------------------
     // Convert the source image (not using WIC)
     //-------------------------------------------------------------------------------------
@@ -4577,6 +4983,11 @@ namespace
         if (!pSrc || !pDest)
             return E_POINTER;
 
+        if (UseIntegerConversion(filter, srcImage.format, destImage.format))
+        {
+            return ConvertUsingInteger(srcImage, destImage, threshold);
+        }
+
         size_t width = srcImage.width;
 
         if (filter & TEX_FILTER_DITHER_DIFFUSION)
@@ -5020,6 +5431,134 @@ HRESULT DirectX::Convert(
 }
 
 
+//-------------------------------------------------------------------------------------
+// Convert image into a caller-provided destination
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::Convert(
+    const Image& srcImage,
+    DWORD filter,
+    float threshold,
+    const Image& destImage)
+{
+    if ((srcImage.format == destImage.format) || !IsValid(destImage.format))
+        return E_INVALIDARG;
+
+    if (!srcImage.pixels || !destImage.pixels)
+        return E_POINTER;
+
+    if (IsCompressed(srcImage.format) || IsCompressed(destImage.format)
+        || IsPlanar(srcImage.format) || IsPlanar(destImage.format)
+        || IsPalettized(srcImage.format) || IsPalettized(destImage.format)
+        || IsTypeless(srcImage.format) || IsTypeless(destImage.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if ((srcImage.width > UINT32_MAX) || (srcImage.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    if (srcImage.width != destImage.width || srcImage.height != destImage.height)
+        return E_INVALIDARG;
+
+    if (srcImage.pixels == destImage.pixels)
+    {
+        // Each scanline is fully loaded before it is stored, so in-place only requires matching rows
+        if (srcImage.rowPitch != destImage.rowPitch)
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+        return ConvertCustom(srcImage, filter, destImage, threshold, 0);
+    }
+
+    WICPixelFormatGUID pfGUID, targetGUID;
+    if (UseWICConversion(filter, srcImage.format, destImage.format, pfGUID, targetGUID))
+    {
+        return ConvertUsingWIC(srcImage, pfGUID, targetGUID, filter, threshold, destImage);
+    }
+    else
+    {
+        return ConvertCustom(srcImage, filter, destImage, threshold, 0);
+    }
+}
+
+
+//-------------------------------------------------------------------------------------
+// Convert image (in-place)
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::Convert(
+    ScratchImage& image,
+    DXGI_FORMAT format,
+    DWORD filter,
+    float threshold)
+{
+    const TexMetadata& metadata = image.GetMetadata();
+
+    if (!image.GetImages() || (metadata.format == format) || !IsValid(format))
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format) || IsCompressed(format)
+        || IsPlanar(metadata.format) || IsPlanar(format)
+        || IsPalettized(metadata.format) || IsPalettized(format)
+        || IsTypeless(metadata.format) || IsTypeless(format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if ((metadata.width > UINT32_MAX) || (metadata.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    if (BitsPerPixel(metadata.format) != BitsPerPixel(format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    // Validate every image before touching any pixels, so layout mismatches fail without modifying the data
+    const Image* images = image.GetImages();
+    const size_t nimages = image.GetImageCount();
+    for (size_t index = 0; index < nimages; ++index)
+    {
+        const Image& img = images[index];
+
+        size_t rowPitch, slicePitch;
+        ComputePitch(format, img.width, img.height, rowPitch, slicePitch, CP_FLAGS_NONE);
+        if (img.rowPitch != rowPitch || img.slicePitch != slicePitch)
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    for (size_t index = 0; index < nimages; ++index)
+    {
+        const Image& src = images[index];
+
+        Image dst = src;
+        dst.format = format;
+
+        // Volume slices are stored contiguously per mip level, so the slice index is the z used for ordered dithering
+        size_t z = 0;
+        if (metadata.dimension == TEX_DIMENSION_TEXTURE3D)
+        {
+            size_t base = 0;
+            size_t d = metadata.depth;
+            for (size_t level = 0; level < metadata.mipLevels; ++level)
+            {
+                if (index < base + d)
+                {
+                    z = index - base;
+                    break;
+                }
+
+                base += d;
+                if (d > 1)
+                    d >>= 1;
+            }
+        }
+
+        HRESULT hr = ConvertCustom(src, filter, dst, threshold, z);
+        if (FAILED(hr))
+            return hr;
+    }
+
+    if (!image.OverrideFormat(format))
+        return E_FAIL;
+
+    return S_OK;
+}
+
+
 //-------------------------------------------------------------------------------------
 // Convert image from planar to single plane (image)
 //-------------------------------------------------------------------------------------
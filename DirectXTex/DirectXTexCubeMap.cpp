@@ -0,0 +1,969 @@
+//-------------------------------------------------------------------------------------
+// DirectXTexCubeMap.cpp
+//  
+// DirectX Texture Library - Cubemap operations
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248926
+//-------------------------------------------------------------------------------------
+
+#include "DirectXTexp.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#pragma warning(disable : 4616 6993)
+#endif
+
+using namespace DirectX;
+
+namespace DirectX
+{
+    extern bool _CalculateMipLevels(_In_ size_t width, _In_ size_t height, _Inout_ size_t& mipLevels);
+}
+
+namespace
+{
+    //--- Edge fixup ---
+    // Resamples a face so that its edge texel centers lie exactly on the cube edges, using bilinear filtering across
+    // face edges (the legacy stretch used for hardware without seamless cubemap filtering)
+    HRESULT StretchCubeFace(_In_reads_(6) const Image* const* faces, size_t face, const Image& destImage)
+    {
+        const size_t size = faces[0]->width;
+        if (destImage.width != size || destImage.height != size)
+            return E_FAIL;
+
+        if (size <= 1)
+        {
+            // The single texel of each face is replaced by the average of all six faces
+            XMVECTOR sum = g_XMZero;
+            for (size_t f = 0; f < 6; ++f)
+            {
+                sum = XMVectorAdd(sum, _LoadCubeTexel(*faces[f], 0, 0));
+            }
+
+            XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(destImage.pixels), XMVectorScale(sum, 1.f / 6.f));
+            return S_OK;
+        }
+
+        const float scale = float(size) / float(size - 1);
+
+        uint8_t* pDest = destImage.pixels;
+        for (size_t y = 0; y < size; ++y, pDest += destImage.rowPitch)
+        {
+            const float t = float(y) * scale - 0.5f;
+            const float ty = floorf(t);
+            const ptrdiff_t y0 = static_cast<ptrdiff_t>(ty);
+            const float fy = t - ty;
+
+            auto dptr = reinterpret_cast<XMFLOAT4*>(pDest);
+            for (size_t x = 0; x < size; ++x, ++dptr)
+            {
+                const float s = float(x) * scale - 0.5f;
+                const float sx = floorf(s);
+                const ptrdiff_t x0 = static_cast<ptrdiff_t>(sx);
+                const float fx = s - sx;
+
+                XMVECTOR c0 = XMVectorLerp(_FetchCubeTexelSeamless(faces, face, x0, y0, size), _FetchCubeTexelSeamless(faces, face, x0 + 1, y0, size), fx);
+                XMVECTOR c1 = XMVectorLerp(_FetchCubeTexelSeamless(faces, face, x0, y0 + 1, size), _FetchCubeTexelSeamless(faces, face, x0 + 1, y0 + 1, size), fx);
+
+                XMStoreFloat4(dptr, XMVectorLerp(c0, c1, fy));
+            }
+        }
+
+        return S_OK;
+    }
+
+    HRESULT StretchCubeFaceLevel(const ScratchImage& source, size_t cube, size_t face, size_t level, const ScratchImage& dest)
+    {
+        const Image* faces[6] = {};
+        for (size_t f = 0; f < 6; ++f)
+        {
+            faces[f] = source.GetImage(level, cube * 6 + f, 0);
+            if (!faces[f] || faces[f]->format != DXGI_FORMAT_R32G32B32A32_FLOAT)
+                return E_POINTER;
+        }
+
+        const Image* destImage = dest.GetImage(level, cube * 6 + face, 0);
+        if (!destImage)
+            return E_POINTER;
+
+        return StretchCubeFace(faces, face, *destImage);
+    }
+
+    //--- Mip generation across face edges ---
+    // Builds a level from the previous one with a tent filter two source texels wide each way (2:1, wider for odd
+    // sizes), reading the adjacent faces past an edge so mips stay continuous across the seams. The support never
+    // extends more than one texel beyond a face, which is what _FetchCubeTexelSeamless resolves.
+    struct CubeMipTaps
+    {
+        ptrdiff_t first;
+        size_t count;
+        float weight[6];
+    };
+
+    void ComputeCubeMipTaps(size_t size, size_t dsize, _Out_writes_(dsize) CubeMipTaps* taps)
+    {
+        const float ratio = float(size) / float(dsize);
+
+        for (size_t x = 0; x < dsize; ++x)
+        {
+            const float center = (float(x) + 0.5f) * ratio - 0.5f;
+
+            CubeMipTaps& t = taps[x];
+            t.first = static_cast<ptrdiff_t>(floorf(center - ratio)) + 1;
+            t.count = 0;
+
+            float total = 0.f;
+            for (ptrdiff_t i = t.first; float(i) < center + ratio && t.count < 6; ++i)
+            {
+                const float w = 1.f - fabsf(float(i) - center) / ratio;
+                t.weight[t.count++] = w;
+                total += w;
+            }
+
+            for (size_t k = 0; k < t.count; ++k)
+            {
+                t.weight[k] /= total;
+            }
+        }
+    }
+
+    HRESULT DownsampleCubeFace(_In_reads_(6) const Image* const* faces, size_t face, const Image& destImage)
+    {
+        const size_t size = faces[0]->width;
+        const size_t dsize = destImage.width;
+        if (size <= 1 || destImage.height != dsize || dsize != (size >> 1))
+            return E_FAIL;
+
+        std::unique_ptr<CubeMipTaps[]> taps(new (std::nothrow) CubeMipTaps[dsize]);
+        if (!taps)
+            return E_OUTOFMEMORY;
+
+        // Faces are square, so the same taps serve rows and columns
+        ComputeCubeMipTaps(size, dsize, taps.get());
+
+        const ptrdiff_t n = static_cast<ptrdiff_t>(size);
+
+        uint8_t* pDest = destImage.pixels;
+        for (size_t y = 0; y < dsize; ++y, pDest += destImage.rowPitch)
+        {
+            const CubeMipTaps& ty = taps[y];
+
+            auto dptr = reinterpret_cast<XMFLOAT4*>(pDest);
+            for (size_t x = 0; x < dsize; ++x, ++dptr)
+            {
+                const CubeMipTaps& tx = taps[x];
+
+                XMVECTOR sum = g_XMZero;
+                for (size_t j = 0; j < ty.count; ++j)
+                {
+                    const ptrdiff_t sy = ty.first + ptrdiff_t(j);
+
+                    XMVECTOR row = g_XMZero;
+                    for (size_t i = 0; i < tx.count; ++i)
+                    {
+                        const ptrdiff_t sx = tx.first + ptrdiff_t(i);
+
+                        XMVECTOR c = (sx >= 0 && sy >= 0 && sx < n && sy < n)
+                            ? _LoadCubeTexel(*faces[face], size_t(sx), size_t(sy))
+                            : _FetchCubeTexelSeamless(faces, face, sx, sy, size);
+                        row = XMVectorMultiplyAdd(c, XMVectorReplicate(tx.weight[i]), row);
+                    }
+
+                    sum = XMVectorMultiplyAdd(row, XMVectorReplicate(ty.weight[j]), sum);
+                }
+
+                XMStoreFloat4(dptr, sum);
+            }
+        }
+
+        return S_OK;
+    }
+
+    HRESULT DownsampleCubeFaceLevel(const ScratchImage& chain, size_t cube, size_t face, size_t level)
+    {
+        const Image* faces[6] = {};
+        for (size_t f = 0; f < 6; ++f)
+        {
+            faces[f] = chain.GetImage(level - 1, cube * 6 + f, 0);
+            if (!faces[f] || faces[f]->format != DXGI_FORMAT_R32G32B32A32_FLOAT)
+                return E_POINTER;
+        }
+
+        const Image* destImage = chain.GetImage(level, cube * 6 + face, 0);
+        if (!destImage)
+            return E_POINTER;
+
+        return DownsampleCubeFace(faces, face, *destImage);
+    }
+
+    // Fills levels [firstLevel, mipLevels) of a R32G32B32A32_FLOAT cube chain, each from the level above it
+    HRESULT GenerateCubeMipsSeamless(const ScratchImage& chain, size_t firstLevel, DWORD filter)
+    {
+        const size_t faceCount = chain.GetMetadata().arraySize;
+
+        for (size_t level = firstLevel; level < chain.GetMetadata().mipLevels; ++level)
+        {
+            if (filter & TEX_FILTER_PARALLEL)
+            {
+#ifdef _OPENMP
+                if (faceCount > INT32_MAX)
+                    return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+                bool fail = false;
+
+#pragma omp parallel for
+                for (int item = 0; item < static_cast<int>(faceCount); ++item)
+                {
+                    HRESULT hr = DownsampleCubeFaceLevel(chain, size_t(item) / 6, size_t(item) % 6, level);
+                    if (FAILED(hr))
+                        fail = true;
+                }
+
+                if (fail)
+                    return E_FAIL;
+#endif
+            }
+            else
+            {
+                for (size_t item = 0; item < faceCount; ++item)
+                {
+                    HRESULT hr = DownsampleCubeFaceLevel(chain, item / 6, item % 6, level);
+                    if (FAILED(hr))
+                        return hr;
+                }
+            }
+        }
+
+        return S_OK;
+    }
+
+    //--- Equirectangular projection ---
+    // Panorama coordinates in texels: longitude 0 (the center column) looks down +Z with +X to the right, and the top
+    // row is +Y, so s = (0.5 + atan2(x, z) / 2pi) * width and t = (0.5 - asin(y) / pi) * height
+    const size_t c_ProjectionMinBandRows = 16;
+
+    // The four side faces are the +Z face rotated about Y, and -Y is +Y flipped vertically, so two tables of panorama
+    // coordinates cover all six faces
+    HRESULT CreateEquirectTables(
+        size_t size,
+        size_t width,
+        size_t height,
+        std::unique_ptr<XMFLOAT2[]>& sideTable,
+        std::unique_ptr<XMFLOAT2[]>& poleTable)
+    {
+        sideTable.reset(new (std::nothrow) XMFLOAT2[size * size]);
+        poleTable.reset(new (std::nothrow) XMFLOAT2[size * size]);
+        if (!sideTable || !poleTable)
+            return E_OUTOFMEMORY;
+
+        const float scale = 2.f / float(size);
+        const float sScale = float(width) / XM_2PI;
+        const float tScale = float(height) / XM_PI;
+
+        for (size_t y = 0; y < size; ++y)
+        {
+            const float v = 1.f - (float(y) + 0.5f) * scale;
+
+            for (size_t x = 0; x < size; ++x)
+            {
+                const float u = (float(x) + 0.5f) * scale - 1.f;
+
+                // +Z face, direction (u, v, 1)
+                sideTable[y * size + x] = XMFLOAT2(
+                    float(width) * 0.5f + atan2f(u, 1.f) * sScale,
+                    float(height) * 0.5f - atan2f(v, sqrtf(u * u + 1.f)) * tScale);
+
+                // +Y face, direction (u, 1, -v)
+                poleTable[y * size + x] = XMFLOAT2(
+                    float(width) * 0.5f + atan2f(u, -v) * sScale,
+                    float(height) * 0.5f - atan2f(1.f, sqrtf(u * u + v * v)) * tScale);
+            }
+        }
+
+        return S_OK;
+    }
+
+    // Sample of an R32G32B32A32_FLOAT panorama at texel coordinates, wrapping horizontally and clamping vertically
+    XMVECTOR SampleEquirect(const Image& image, float s, float t, bool point)
+    {
+        const ptrdiff_t w = static_cast<ptrdiff_t>(image.width);
+        const ptrdiff_t h = static_cast<ptrdiff_t>(image.height);
+
+        if (point)
+        {
+            const ptrdiff_t x = ((static_cast<ptrdiff_t>(floorf(s)) % w) + w) % w;
+            const ptrdiff_t y = std::min<ptrdiff_t>(std::max<ptrdiff_t>(static_cast<ptrdiff_t>(floorf(t)), 0), h - 1);
+            return _LoadCubeTexel(image, size_t(x), size_t(y));
+        }
+
+        s -= 0.5f;
+        t -= 0.5f;
+
+        const float sx = floorf(s);
+        const float ty = floorf(t);
+        const float fx = s - sx;
+        const float fy = t - ty;
+
+        const ptrdiff_t x0 = ((static_cast<ptrdiff_t>(sx) % w) + w) % w;
+        const ptrdiff_t x1 = (x0 + 1) % w;
+        const ptrdiff_t y0 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(static_cast<ptrdiff_t>(ty), 0), h - 1);
+        const ptrdiff_t y1 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(static_cast<ptrdiff_t>(ty) + 1, 0), h - 1);
+
+        XMVECTOR c0 = XMVectorLerp(_LoadCubeTexel(image, size_t(x0), size_t(y0)), _LoadCubeTexel(image, size_t(x1), size_t(y0)), fx);
+        XMVECTOR c1 = XMVectorLerp(_LoadCubeTexel(image, size_t(x0), size_t(y1)), _LoadCubeTexel(image, size_t(x1), size_t(y1)), fx);
+        return XMVectorLerp(c0, c1, fy);
+    }
+
+    // Writes cube rows [rowStart, rowEnd), where row r is row (r % size) of face (r / size)
+    HRESULT EquirectToCubeRows(
+        const Image& panorama,
+        _In_reads_(size * size) const XMFLOAT2* sideTable,
+        _In_reads_(size * size) const XMFLOAT2* poleTable,
+        size_t size,
+        size_t rowStart,
+        size_t rowEnd,
+        DWORD filter,
+        const ScratchImage& result)
+    {
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * size, 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        const bool point = (filter & TEX_FILTER_MASK) == TEX_FILTER_POINT;
+
+        for (size_t row = rowStart; row < rowEnd; ++row)
+        {
+            const size_t face = row / size;
+            const size_t y = row % size;
+
+            const Image* destImage = result.GetImage(0, face, 0);
+            if (!destImage)
+                return E_POINTER;
+
+            if (face == 2 || face == 3)
+            {
+                // -Y uses the +Y entry mirrored vertically, with the latitude negated
+                const XMFLOAT2* entry = poleTable + ((face == 2) ? y : (size - 1 - y)) * size;
+                for (size_t x = 0; x < size; ++x, ++entry)
+                {
+                    const float t = (face == 2) ? entry->y : float(panorama.height) - entry->y;
+                    scanline[x] = SampleEquirect(panorama, entry->x, t, point);
+                }
+            }
+            else
+            {
+                // Longitude of the side faces relative to +Z, as a fraction of the panorama width
+                static const float s_faceLongitude[6] = { 0.25f, 0.75f, 0.f, 0.f, 0.f, 0.5f };
+
+                const float offset = s_faceLongitude[face] * float(panorama.width);
+
+                const XMFLOAT2* entry = sideTable + y * size;
+                for (size_t x = 0; x < size; ++x, ++entry)
+                {
+                    scanline[x] = SampleEquirect(panorama, entry->x + offset, entry->y, point);
+                }
+            }
+
+            if (!_StoreScanlineLinear(destImage->pixels + destImage->rowPitch * y, destImage->rowPitch, destImage->format,
+                scanline.get(), size, filter))
+                return E_FAIL;
+        }
+
+        return S_OK;
+    }
+
+    // Writes panorama rows [yStart, yEnd) from a cube chain, using per column and per row direction tables
+    HRESULT CubeToEquirectRows(
+        _In_reads_(levels * 6) const Image* const* levelFaces,
+        size_t levels,
+        float lod,
+        _In_reads_(destImage.width) const XMFLOAT2* longitudes,
+        _In_reads_(destImage.height) const XMFLOAT2* latitudes,
+        size_t yStart,
+        size_t yEnd,
+        DWORD filter,
+        const Image& destImage)
+    {
+        const size_t width = destImage.width;
+
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * width, 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        const bool point = (filter & TEX_FILTER_MASK) == TEX_FILTER_POINT;
+        const size_t size = levelFaces[0]->width;
+
+        for (size_t y = yStart; y < yEnd; ++y)
+        {
+            // x, y of a latitude entry are its sine and cosine
+            const XMFLOAT2 lat = latitudes[y];
+
+            for (size_t x = 0; x < width; ++x)
+            {
+                const XMVECTOR dir = XMVectorSet(lat.y * longitudes[x].x, lat.x, lat.y * longitudes[x].y, 0.f);
+
+                if (point)
+                {
+                    float u, v;
+                    const size_t face = _CubeFaceFromDirection(dir, u, v);
+
+                    const size_t tx = std::min<size_t>(static_cast<size_t>(std::max(0.f, (u + 1.f) * 0.5f * float(size))), size - 1);
+                    const size_t ty = std::min<size_t>(static_cast<size_t>(std::max(0.f, (1.f - v) * 0.5f * float(size))), size - 1);
+                    scanline[x] = _LoadCubeTexel(*levelFaces[face], tx, ty);
+                }
+                else
+                {
+                    scanline[x] = _SampleCubeTrilinear(levelFaces, levels, dir, lod);
+                }
+            }
+
+            if (!_StoreScanlineLinear(destImage.pixels + destImage.rowPitch * y, destImage.rowPitch, destImage.format,
+                scanline.get(), width, filter))
+                return E_FAIL;
+        }
+
+        return S_OK;
+    }
+}
+
+
+//-------------------------------------------------------------------------------------
+// Texel of a face where x and/or y may be one texel beyond the edge, in which case the edge texel of the adjacent
+// face is used, and beyond a corner the average of the three texels meeting there (as seamless cube filtering does)
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+XMVECTOR DirectX::_FetchCubeTexelSeamless(const Image* const* faces, size_t face, ptrdiff_t x, ptrdiff_t y, size_t size)
+{
+    const ptrdiff_t n = static_cast<ptrdiff_t>(size);
+    const bool outX = (x < 0 || x >= n);
+    const bool outY = (y < 0 || y >= n);
+
+    if (!outX && !outY)
+        return _LoadCubeTexel(*faces[face], size_t(x), size_t(y));
+
+    const ptrdiff_t cx = std::min<ptrdiff_t>(std::max<ptrdiff_t>(x, 0), n - 1);
+    const ptrdiff_t cy = std::min<ptrdiff_t>(std::max<ptrdiff_t>(y, 0), n - 1);
+
+    if (outX && outY)
+    {
+        XMVECTOR sum = _LoadCubeTexel(*faces[face], size_t(cx), size_t(cy));
+        sum = XMVectorAdd(sum, _FetchCubeTexelSeamless(faces, face, x, cy, size));
+        sum = XMVectorAdd(sum, _FetchCubeTexelSeamless(faces, face, cx, y, size));
+        return XMVectorScale(sum, 1.f / 3.f);
+    }
+
+    // The texel center beyond the edge projects onto the edge texel of the adjacent face
+    const float scale = 2.f / float(size);
+    const float u = (float(x) + 0.5f) * scale - 1.f;
+    const float v = 1.f - (float(y) + 0.5f) * scale;
+
+    float fu, fv;
+    const size_t nface = _CubeFaceFromDirection(_CubeFaceDirection(face, u, v), fu, fv);
+
+    const ptrdiff_t nx = static_cast<ptrdiff_t>(floorf((fu + 1.f) * 0.5f * float(size)));
+    const ptrdiff_t ny = static_cast<ptrdiff_t>(floorf((1.f - fv) * 0.5f * float(size)));
+
+    return _LoadCubeTexel(*faces[nface],
+        size_t(std::min<ptrdiff_t>(std::max<ptrdiff_t>(nx, 0), n - 1)),
+        size_t(std::min<ptrdiff_t>(std::max<ptrdiff_t>(ny, 0), n - 1)));
+}
+
+
+//-------------------------------------------------------------------------------------
+// Bilinear sample of one level (six R32G32B32A32_FLOAT faces), filtering seamlessly
+// across face edges
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+XMVECTOR XM_CALLCONV DirectX::_SampleCubeBilinear(const Image* const* faces, FXMVECTOR dir)
+{
+    const size_t size = faces[0]->width;
+
+    float u, v;
+    const size_t face = _CubeFaceFromDirection(dir, u, v);
+
+    const float s = (u + 1.f) * 0.5f * float(size) - 0.5f;
+    const float t = (1.f - v) * 0.5f * float(size) - 0.5f;
+
+    const float sx = floorf(s);
+    const float ty = floorf(t);
+    const float fx = s - sx;
+    const float fy = t - ty;
+
+    const ptrdiff_t x0 = static_cast<ptrdiff_t>(sx);
+    const ptrdiff_t y0 = static_cast<ptrdiff_t>(ty);
+
+    XMVECTOR c00, c10, c01, c11;
+    if (x0 >= 0 && y0 >= 0 && size_t(x0 + 1) < size && size_t(y0 + 1) < size)
+    {
+        const Image& image = *faces[face];
+        c00 = _LoadCubeTexel(image, size_t(x0), size_t(y0));
+        c10 = _LoadCubeTexel(image, size_t(x0 + 1), size_t(y0));
+        c01 = _LoadCubeTexel(image, size_t(x0), size_t(y0 + 1));
+        c11 = _LoadCubeTexel(image, size_t(x0 + 1), size_t(y0 + 1));
+    }
+    else
+    {
+        c00 = _FetchCubeTexelSeamless(faces, face, x0, y0, size);
+        c10 = _FetchCubeTexelSeamless(faces, face, x0 + 1, y0, size);
+        c01 = _FetchCubeTexelSeamless(faces, face, x0, y0 + 1, size);
+        c11 = _FetchCubeTexelSeamless(faces, face, x0 + 1, y0 + 1, size);
+    }
+
+    return XMVectorLerp(XMVectorLerp(c00, c10, fx), XMVectorLerp(c01, c11, fx), fy);
+}
+
+
+//-------------------------------------------------------------------------------------
+// Trilinear sample of a chain, where levelFaces holds the six faces of each level
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+XMVECTOR XM_CALLCONV DirectX::_SampleCubeTrilinear(const Image* const* levelFaces, size_t levels, FXMVECTOR dir, float lod)
+{
+    const size_t level = std::min<size_t>(static_cast<size_t>(std::max(lod, 0.f)), levels - 1);
+    const float frac = lod - float(level);
+
+    XMVECTOR c0 = _SampleCubeBilinear(levelFaces + level * 6, dir);
+    if (frac <= 0.f || (level + 1) >= levels)
+        return c0;
+
+    XMVECTOR c1 = _SampleCubeBilinear(levelFaces + (level + 1) * 6, dir);
+    return XMVectorLerp(c0, c1, frac);
+}
+
+
+//-------------------------------------------------------------------------------------
+// Copies a cubemap chain into R32G32B32A32_FLOAT (linear color space for sRGB), generating
+// missing levels from the top level
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::_ConvertCubeMapToR32G32B32A32(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DWORD filter,
+    size_t levels,
+    ScratchImage& work)
+{
+    if (!srcImages || !nimages || !metadata.IsCubemap())
+        return E_INVALIDARG;
+
+    HRESULT hr;
+    if (metadata.format != DXGI_FORMAT_R32G32B32A32_FLOAT)
+    {
+        hr = Convert(srcImages, nimages, metadata, DXGI_FORMAT_R32G32B32A32_FLOAT, filter & TEX_FILTER_SRGB_IN, TEX_THRESHOLD_DEFAULT, work);
+        if (FAILED(hr))
+            return hr;
+    }
+    else
+    {
+        TexMetadata mdata = metadata;
+        mdata.mipLevels = std::min<size_t>(metadata.mipLevels, levels);
+        hr = work.Initialize(mdata);
+        if (FAILED(hr))
+            return hr;
+
+        for (size_t item = 0; item < mdata.arraySize; ++item)
+        {
+            for (size_t level = 0; level < mdata.mipLevels; ++level)
+            {
+                size_t index = metadata.ComputeIndex(level, item, 0);
+                if (index >= nimages)
+                    return E_FAIL;
+
+                hr = CopyRectangle(srcImages[index], Rect(0, 0, srcImages[index].width, srcImages[index].height),
+                    *work.GetImage(level, item, 0), TEX_FILTER_DEFAULT, 0, 0);
+                if (FAILED(hr))
+                    return hr;
+            }
+        }
+    }
+
+    if (levels > work.GetMetadata().mipLevels)
+    {
+        ScratchImage mips;
+        hr = GenerateMipMaps(work.GetImages(), work.GetImageCount(), work.GetMetadata(),
+            filter & (TEX_FILTER_MASK | TEX_FILTER_PARALLEL), levels, mips);
+        if (FAILED(hr))
+            return hr;
+
+        std::swap(work, mips);
+    }
+
+    return S_OK;
+}
+
+
+//=====================================================================================
+// Entry-points
+//=====================================================================================
+
+//-------------------------------------------------------------------------------------
+// Fix cubemap edges for hardware without seamless cubemap filtering
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::FixCubeMapEdges(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DWORD filter,
+    size_t levels,
+    ScratchImage& result)
+{
+    if (!srcImages || !nimages || !IsValid(metadata.format))
+        return E_INVALIDARG;
+
+    if (!metadata.IsCubemap() || metadata.dimension != TEX_DIMENSION_TEXTURE2D
+        || (metadata.arraySize % 6) != 0 || metadata.width != metadata.height)
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format) || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (!_CalculateMipLevels(metadata.width, metadata.height, levels))
+        return E_INVALIDARG;
+
+#ifndef _OPENMP
+    if (filter & TEX_FILTER_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    // Working copy of the chain in floating-point (linear color space for sRGB)
+    ScratchImage work;
+    HRESULT hr = _ConvertCubeMapToR32G32B32A32(srcImages, nimages, metadata, filter,
+        std::min<size_t>(levels, metadata.mipLevels), work);
+    if (FAILED(hr))
+        return hr;
+
+    TexMetadata mdata = work.GetMetadata();
+    mdata.mipLevels = levels;
+
+    if (levels > work.GetMetadata().mipLevels)
+    {
+        // Missing levels are filtered across face edges rather than per face, since plain per-face mips would put
+        // back the seams this function removes
+        ScratchImage chain;
+        hr = chain.Initialize(mdata);
+        if (FAILED(hr))
+            return hr;
+
+        for (size_t item = 0; item < mdata.arraySize; ++item)
+        {
+            for (size_t level = 0; level < work.GetMetadata().mipLevels; ++level)
+            {
+                const Image* src = work.GetImage(level, item, 0);
+                const Image* dest = chain.GetImage(level, item, 0);
+                if (!src || !dest || src->slicePitch != dest->slicePitch)
+                    return E_POINTER;
+
+                memcpy_s(dest->pixels, dest->slicePitch, src->pixels, src->slicePitch);
+            }
+        }
+
+        hr = GenerateCubeMipsSeamless(chain, work.GetMetadata().mipLevels, filter);
+        if (FAILED(hr))
+            return hr;
+
+        std::swap(work, chain);
+    }
+
+    ScratchImage fixed;
+    hr = fixed.Initialize(mdata);
+    if (FAILED(hr))
+        return hr;
+
+    const size_t cubes = mdata.arraySize / 6;
+    const size_t jobs = cubes * 6 * levels;
+
+    if (filter & TEX_FILTER_PARALLEL)
+    {
+#ifdef _OPENMP
+        if (jobs > INT32_MAX)
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+        bool fail = false;
+
+#pragma omp parallel for schedule(dynamic)
+        for (int job = 0; job < static_cast<int>(jobs); ++job)
+        {
+            // Largest levels first, so the small ones fill in at the end
+            const size_t level = size_t(job) / (cubes * 6);
+            const size_t cube = (size_t(job) % (cubes * 6)) / 6;
+            const size_t face = size_t(job) % 6;
+
+            HRESULT hrJob = StretchCubeFaceLevel(work, cube, face, level, fixed);
+            if (FAILED(hrJob))
+                fail = true;
+        }
+
+        if (fail)
+            return E_FAIL;
+#endif
+    }
+    else
+    {
+        for (size_t job = 0; job < jobs; ++job)
+        {
+            hr = StretchCubeFaceLevel(work, (job % (cubes * 6)) / 6, job % 6, job / (cubes * 6), fixed);
+            if (FAILED(hr))
+                return hr;
+        }
+    }
+
+    work.Release();
+
+    if (metadata.format == DXGI_FORMAT_R32G32B32A32_FLOAT)
+    {
+        std::swap(result, fixed);
+        return S_OK;
+    }
+
+    return Convert(fixed.GetImages(), fixed.GetImageCount(), fixed.GetMetadata(), metadata.format,
+        filter & TEX_FILTER_SRGB_OUT, TEX_THRESHOLD_DEFAULT, result);
+}
+
+
+//-------------------------------------------------------------------------------------
+// Cubemap from an equirectangular (latitude-longitude) panorama
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::EquirectToCubeMap(
+    const Image& srcImage,
+    DWORD filter,
+    size_t size,
+    ScratchImage& result)
+{
+    if (!srcImage.pixels || srcImage.width < 2 || !srcImage.height || !IsValid(srcImage.format))
+        return E_INVALIDARG;
+
+    if (IsCompressed(srcImage.format) || IsTypeless(srcImage.format) || IsPlanar(srcImage.format) || IsPalettized(srcImage.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+#ifndef _OPENMP
+    if (filter & TEX_FILTER_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    if (!size)
+        size = std::max<size_t>(1, srcImage.width / 4);
+
+    if (size > UINT32_MAX)
+        return E_INVALIDARG;
+
+    // Working copy of the panorama in floating-point (linear color space for sRGB)
+    ScratchImage panorama;
+    HRESULT hr = (srcImage.format == DXGI_FORMAT_R32G32B32A32_FLOAT)
+        ? panorama.InitializeFromImage(srcImage)
+        : Convert(srcImage, DXGI_FORMAT_R32G32B32A32_FLOAT, filter & TEX_FILTER_SRGB_IN, TEX_THRESHOLD_DEFAULT, panorama);
+    if (FAILED(hr))
+        return hr;
+
+    // A panorama with more detail than the faces hold is first reduced with the filter mode, so bilinear taps don't alias
+    if ((filter & TEX_FILTER_MASK) != TEX_FILTER_POINT && srcImage.width > size * 4)
+    {
+        ScratchImage reduced;
+        hr = Resize(*panorama.GetImage(0, 0, 0), size * 4, std::min<size_t>(srcImage.height, size * 2),
+            (filter & (TEX_FILTER_MASK | TEX_FILTER_PARALLEL | TEX_FILTER_SEPARATE_ALPHA)) | TEX_FILTER_WRAP_U, reduced);
+        if (FAILED(hr))
+            return hr;
+
+        std::swap(panorama, reduced);
+    }
+
+    std::unique_ptr<XMFLOAT2[]> sideTable;
+    std::unique_ptr<XMFLOAT2[]> poleTable;
+    const Image& pano = *panorama.GetImage(0, 0, 0);
+    hr = CreateEquirectTables(size, pano.width, pano.height, sideTable, poleTable);
+    if (FAILED(hr))
+        return hr;
+
+    hr = result.InitializeCube(srcImage.format, size, size, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    const size_t rows = 6 * size;
+
+    if (filter & TEX_FILTER_PARALLEL)
+    {
+#ifdef _OPENMP
+        const size_t nthreads = static_cast<size_t>(std::max<int>(1, omp_get_max_threads()));
+        const size_t bandRows = std::max<size_t>(c_ProjectionMinBandRows, (rows + nthreads * 4 - 1) / (nthreads * 4));
+        const size_t nbands = (rows + bandRows - 1) / bandRows;
+
+        if (nbands > INT32_MAX)
+        {
+            result.Release();
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+        }
+
+        bool fail = false;
+
+#pragma omp parallel for
+        for (int band = 0; band < static_cast<int>(nbands); ++band)
+        {
+            const size_t rowStart = size_t(band) * bandRows;
+            const size_t rowEnd = std::min<size_t>(rowStart + bandRows, rows);
+
+            HRESULT hrBand = EquirectToCubeRows(pano, sideTable.get(), poleTable.get(), size, rowStart, rowEnd, filter, result);
+            if (FAILED(hrBand))
+                fail = true;
+        }
+
+        if (fail)
+        {
+            result.Release();
+            return E_FAIL;
+        }
+#endif
+    }
+    else
+    {
+        hr = EquirectToCubeRows(pano, sideTable.get(), poleTable.get(), size, 0, rows, filter, result);
+        if (FAILED(hr))
+        {
+            result.Release();
+            return hr;
+        }
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Equirectangular (latitude-longitude) panorama from a cubemap
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::CubeMapToEquirect(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DWORD filter,
+    size_t width,
+    size_t height,
+    ScratchImage& result)
+{
+    if (!srcImages || !nimages || !IsValid(metadata.format))
+        return E_INVALIDARG;
+
+    if (!metadata.IsCubemap() || metadata.dimension != TEX_DIMENSION_TEXTURE2D
+        || (metadata.arraySize % 6) != 0 || metadata.width != metadata.height)
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format) || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+#ifndef _OPENMP
+    if (filter & TEX_FILTER_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    if (!width)
+        width = metadata.width * 4;
+
+    if (!height)
+        height = std::max<size_t>(1, width / 2);
+
+    if (width > UINT32_MAX || height > UINT32_MAX)
+        return E_INVALIDARG;
+
+    // Faces with more detail than the panorama holds are read from a lower level of a mip chain
+    const bool point = (filter & TEX_FILTER_MASK) == TEX_FILTER_POINT;
+    const float lod = point ? 0.f : std::max(0.f, log2f(float(metadata.width * 4) / float(width)));
+
+    size_t levels = (lod > 0.f) ? 0 : 1;
+    if (!_CalculateMipLevels(metadata.width, metadata.height, levels))
+        return E_INVALIDARG;
+
+    ScratchImage work;
+    HRESULT hr = _ConvertCubeMapToR32G32B32A32(srcImages, nimages, metadata, filter, levels, work);
+    if (FAILED(hr))
+        return hr;
+
+    levels = std::min<size_t>(levels, work.GetMetadata().mipLevels);
+
+    // Only the first cube of an array is projected
+    std::unique_ptr<const Image*[]> levelFaces(new (std::nothrow) const Image*[levels * 6]);
+    if (!levelFaces)
+        return E_OUTOFMEMORY;
+
+    for (size_t level = 0; level < levels; ++level)
+    {
+        for (size_t face = 0; face < 6; ++face)
+        {
+            levelFaces[level * 6 + face] = work.GetImage(level, face, 0);
+            if (!levelFaces[level * 6 + face])
+                return E_POINTER;
+        }
+    }
+
+    // Direction tables: sine and cosine of the longitude of each column and of the latitude of each row
+    std::unique_ptr<XMFLOAT2[]> longitudes(new (std::nothrow) XMFLOAT2[width]);
+    std::unique_ptr<XMFLOAT2[]> latitudes(new (std::nothrow) XMFLOAT2[height]);
+    if (!longitudes || !latitudes)
+        return E_OUTOFMEMORY;
+
+    for (size_t x = 0; x < width; ++x)
+    {
+        XMScalarSinCos(&longitudes[x].x, &longitudes[x].y, ((float(x) + 0.5f) / float(width) - 0.5f) * XM_2PI);
+    }
+
+    for (size_t y = 0; y < height; ++y)
+    {
+        XMScalarSinCos(&latitudes[y].x, &latitudes[y].y, (0.5f - (float(y) + 0.5f) / float(height)) * XM_PI);
+    }
+
+    hr = result.Initialize2D(metadata.format, width, height, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    const Image& destImage = *result.GetImage(0, 0, 0);
+
+    if (filter & TEX_FILTER_PARALLEL)
+    {
+#ifdef _OPENMP
+        const size_t nthreads = static_cast<size_t>(std::max<int>(1, omp_get_max_threads()));
+        const size_t bandRows = std::max<size_t>(c_ProjectionMinBandRows, (height + nthreads * 4 - 1) / (nthreads * 4));
+        const size_t nbands = (height + bandRows - 1) / bandRows;
+
+        if (nbands > INT32_MAX)
+        {
+            result.Release();
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+        }
+
+        bool fail = false;
+
+#pragma omp parallel for
+        for (int band = 0; band < static_cast<int>(nbands); ++band)
+        {
+            const size_t yStart = size_t(band) * bandRows;
+            const size_t yEnd = std::min<size_t>(yStart + bandRows, height);
+
+            HRESULT hrBand = CubeToEquirectRows(levelFaces.get(), levels, lod, longitudes.get(), latitudes.get(),
+                yStart, yEnd, filter, destImage);
+            if (FAILED(hrBand))
+                fail = true;
+        }
+
+        if (fail)
+        {
+            result.Release();
+            return E_FAIL;
+        }
+#endif
+    }
+    else
+    {
+        hr = CubeToEquirectRows(levelFaces.get(), levels, lod, longitudes.get(), latitudes.get(), 0, height, filter, destImage);
+        if (FAILED(hr))
+        {
+            result.Release();
+            return hr;
+        }
+    }
+
+    return S_OK;
+}
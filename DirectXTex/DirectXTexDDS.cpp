@@ -1114,6 +1114,25 @@ namespace
     }
 
 
+    //-------------------------------------------------------------------------------------
+    // Adds the legacy pixel size overrides needed to compute source pitches
+    //-------------------------------------------------------------------------------------
+    DWORD GetSourcePitchFlags(DWORD cpFlags, DWORD convFlags)
+    {
+        if (convFlags & CONV_FLAGS_EXPAND)
+        {
+            if (convFlags & CONV_FLAGS_888)
+                cpFlags |= CP_FLAGS_24BPP;
+            else if (convFlags & (CONV_FLAGS_565 | CONV_FLAGS_5551 | CONV_FLAGS_4444 | CONV_FLAGS_8332 | CONV_FLAGS_A8P8 | CONV_FLAGS_L16 | CONV_FLAGS_A8L8))
+                cpFlags |= CP_FLAGS_16BPP;
+            else if (convFlags & (CONV_FLAGS_44 | CONV_FLAGS_332 | CONV_FLAGS_PAL8 | CONV_FLAGS_L8))
+                cpFlags |= CP_FLAGS_8BPP;
+        }
+
+        return cpFlags;
+    }
+
+
     //-------------------------------------------------------------------------------------
     // Converts or copies image data from pPixels into scratch image data
     //-------------------------------------------------------------------------------------
@@ -1132,15 +1151,7 @@ namespace
         if (!size)
             return E_FAIL;
 
-        if (convFlags & CONV_FLAGS_EXPAND)
-        {
-            if (convFlags & CONV_FLAGS_888)
-                cpFlags |= CP_FLAGS_24BPP;
-            else if (convFlags & (CONV_FLAGS_565 | CONV_FLAGS_5551 | CONV_FLAGS_4444 | CONV_FLAGS_8332 | CONV_FLAGS_A8P8 | CONV_FLAGS_L16 | CONV_FLAGS_A8L8))
-                cpFlags |= CP_FLAGS_16BPP;
-            else if (convFlags & (CONV_FLAGS_44 | CONV_FLAGS_332 | CONV_FLAGS_PAL8 | CONV_FLAGS_L8))
-                cpFlags |= CP_FLAGS_8BPP;
-        }
+        cpFlags = GetSourcePitchFlags(cpFlags, convFlags);
 
         size_t pixelSize, nimages;
         if (!_DetermineImageArray(metadata, cpFlags, nimages, pixelSize))
@@ -1392,17 +1403,15 @@ namespace
         return S_OK;
     }
 
-    HRESULT CopyImageInPlace(DWORD convFlags, _In_ const ScratchImage& image)
+    HRESULT CopyImageInPlace(
+        DWORD convFlags,
+        _In_reads_(nimages) const Image* images,
+        size_t nimages,
+        const TexMetadata& metadata)
     {
-        if (!image.GetPixels())
-            return E_FAIL;
-
-        const Image* images = image.GetImages();
         if (!images)
             return E_FAIL;
 
-        const TexMetadata& metadata = image.GetMetadata();
-
         if (IsPlanar(metadata.format))
             return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
 
@@ -1410,7 +1419,7 @@ namespace
         if (convFlags & CONV_FLAGS_SWIZZLE)
             tflags |= TEXP_SCANLINE_LEGACY;
 
-        for (size_t i = 0; i < image.GetImageCount(); ++i)
+        for (size_t i = 0; i < nimages; ++i)
         {
             const Image* img = &images[i];
             uint8_t *pPixels = img->pixels;
@@ -1761,7 +1770,7 @@ HRESULT DirectX::LoadFromDDSFile(
         if (convFlags & (CONV_FLAGS_SWIZZLE | CONV_FLAGS_NOALPHA))
         {
             // Swizzle/copy image in place
-            hr = CopyImageInPlace(convFlags, image);
+            hr = CopyImageInPlace(convFlags, image.GetImages(), image.GetImageCount(), image.GetMetadata());
             if (FAILED(hr))
             {
                 image.Release();
@@ -1777,6 +1786,428 @@ HRESULT DirectX::LoadFromDDSFile(
 }
 
 
+//-------------------------------------------------------------------------------------
+// Load a subset of the mips and array items of a DDS file from disk
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::LoadFromDDSFileRange(
+    const wchar_t* szFile,
+    DWORD flags,
+    size_t firstMip,
+    size_t mipCount,
+    size_t firstItem,
+    size_t itemCount,
+    TexMetadata* metadata,
+    ScratchImage& image)
+{
+    if (!szFile)
+        return E_INVALIDARG;
+
+    image.Release();
+
+#if (_WIN32_WINNT >= _WIN32_WINNT_WIN8)
+    ScopedHandle hFile(safe_handle(CreateFile2(szFile, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr)));
+#else
+    ScopedHandle hFile(safe_handle(CreateFileW(szFile, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr)));
+#endif
+
+    if (!hFile)
+    {
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+
+    // Get the file size
+    FILE_STANDARD_INFO fileInfo;
+    if (!GetFileInformationByHandleEx(hFile.get(), FileStandardInfo, &fileInfo, sizeof(fileInfo)))
+    {
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+
+    // Same 4 GB limit as LoadFromDDSFile
+    if (fileInfo.EndOfFile.HighPart > 0)
+    {
+        return HRESULT_FROM_WIN32(ERROR_FILE_TOO_LARGE);
+    }
+
+    // Need at least enough data to fill the standard header and magic number to be a valid DDS
+    if (fileInfo.EndOfFile.LowPart < (sizeof(DDS_HEADER) + sizeof(uint32_t)))
+    {
+        return E_FAIL;
+    }
+
+    // Read the header in (including extended header if present)
+    const size_t MAX_HEADER_SIZE = sizeof(uint32_t) + sizeof(DDS_HEADER) + sizeof(DDS_HEADER_DXT10);
+    uint8_t header[MAX_HEADER_SIZE] = {};
+
+    DWORD bytesRead = 0;
+    if (!ReadFile(hFile.get(), header, MAX_HEADER_SIZE, &bytesRead, nullptr))
+    {
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+
+    DWORD convFlags = 0;
+    TexMetadata mdata;
+    HRESULT hr = DecodeDDSHeader(header, bytesRead, flags, mdata, convFlags);
+    if (FAILED(hr))
+        return hr;
+
+    // Validate the requested range ('0' counts select everything from the first entry onwards)
+    if (firstMip >= mdata.mipLevels)
+        return E_INVALIDARG;
+
+    if (!mipCount)
+        mipCount = mdata.mipLevels - firstMip;
+
+    if (mipCount > (mdata.mipLevels - firstMip))
+        return E_INVALIDARG;
+
+    const size_t arraySize = (mdata.dimension == TEX_DIMENSION_TEXTURE3D) ? 1 : mdata.arraySize;
+
+    if (firstItem >= arraySize)
+        return E_INVALIDARG;
+
+    if (!itemCount)
+        itemCount = arraySize - firstItem;
+
+    if (itemCount > (arraySize - firstItem))
+        return E_INVALIDARG;
+
+    uint64_t offset = sizeof(uint32_t) + sizeof(DDS_HEADER);
+    if (convFlags & CONV_FLAGS_DX10)
+        offset += sizeof(DDS_HEADER_DXT10);
+
+    std::unique_ptr<uint32_t[]> pal8;
+    if (convFlags & CONV_FLAGS_PAL8)
+    {
+        pal8.reset(new (std::nothrow) uint32_t[256]);
+        if (!pal8)
+        {
+            return E_OUTOFMEMORY;
+        }
+
+        LARGE_INTEGER filePos;
+        filePos.QuadPart = static_cast<LONGLONG>(offset);
+        if (!SetFilePointerEx(hFile.get(), filePos, nullptr, FILE_BEGIN))
+        {
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        if (!ReadFile(hFile.get(), pal8.get(), 256 * sizeof(uint32_t), &bytesRead, nullptr))
+        {
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        if (bytesRead != (256 * sizeof(uint32_t)))
+        {
+            return E_FAIL;
+        }
+
+        offset += (256 * sizeof(uint32_t));
+    }
+
+    DWORD cflags = CP_FLAGS_NONE;
+    if (flags & DDS_FLAGS_LEGACY_DWORD)
+    {
+        cflags |= CP_FLAGS_LEGACY_DWORD;
+    }
+    if (flags & DDS_FLAGS_BAD_DXTN_TAILS)
+    {
+        cflags |= CP_FLAGS_BAD_DXTN_TAILS;
+    }
+
+    // Sizes in the file of one array item, of the mips before the range, and of the range itself
+    // (using the same pitches as CopyImage)
+    const DWORD srcFlags = GetSourcePitchFlags(cflags, convFlags);
+
+    uint64_t itemSize = 0;
+    uint64_t skipSize = 0;
+    uint64_t rangeSize = 0;
+    {
+        size_t w = mdata.width;
+        size_t h = mdata.height;
+        size_t d = mdata.depth;
+        for (size_t level = 0; level < mdata.mipLevels; ++level)
+        {
+            size_t rowPitch, slicePitch;
+            hr = ComputePitch(mdata.format, w, h, rowPitch, slicePitch, srcFlags);
+            if (FAILED(hr))
+                return hr;
+
+            const uint64_t levelSize = uint64_t(slicePitch) * uint64_t((mdata.dimension == TEX_DIMENSION_TEXTURE3D) ? d : 1);
+
+            itemSize += levelSize;
+            if (level < firstMip)
+                skipSize += levelSize;
+            else if (level < (firstMip + mipCount))
+                rangeSize += levelSize;
+
+            if (h > 1)
+                h >>= 1;
+
+            if (w > 1)
+                w >>= 1;
+
+            if (d > 1)
+                d >>= 1;
+        }
+    }
+
+    if ((offset + itemSize * arraySize) > fileInfo.EndOfFile.LowPart)
+        return HRESULT_FROM_WIN32(ERROR_HANDLE_EOF);
+
+    // Shape of the result
+    TexMetadata smdata = mdata;
+    smdata.width = std::max<size_t>(1, mdata.width >> firstMip);
+    smdata.height = std::max<size_t>(1, mdata.height >> firstMip);
+    smdata.depth = (mdata.dimension == TEX_DIMENSION_TEXTURE3D) ? std::max<size_t>(1, mdata.depth >> firstMip) : 1;
+    smdata.mipLevels = mipCount;
+    smdata.arraySize = itemCount;
+
+    // A subset is only still a cubemap if it covers whole cubes
+    if (mdata.IsCubemap() && ((firstItem % 6) != 0 || (itemCount % 6) != 0))
+    {
+        smdata.miscFlags &= ~static_cast<uint32_t>(TEX_MISC_TEXTURECUBE);
+    }
+
+    if ((flags & DDS_FLAGS_BAD_DXTN_TAILS) && IsCompressed(mdata.format) && (smdata.width < 4 || smdata.height < 4))
+    {
+        // The tail fix-up copies from the last full-size level, which a range starting in the tail doesn't contain
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    hr = image.Initialize(smdata);
+    if (FAILED(hr))
+        return hr;
+
+    if (rangeSize > UINT32_MAX)
+    {
+        image.Release();
+        return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+    }
+
+    const bool direct = !(convFlags & CONV_FLAGS_EXPAND) && !(flags & (DDS_FLAGS_LEGACY_DWORD | DDS_FLAGS_BAD_DXTN_TAILS));
+
+    // Without conversion the file layout of the subset matches the scratch image, so read straight into it
+    std::unique_ptr<uint8_t[]> temp;
+    uint8_t* pDest = image.GetPixels();
+    size_t destSize = image.GetPixelsSize();
+    if (!direct)
+    {
+        destSize = static_cast<size_t>(rangeSize * itemCount);
+        temp.reset(new (std::nothrow) uint8_t[destSize]);
+        if (!temp)
+        {
+            image.Release();
+            return E_OUTOFMEMORY;
+        }
+        pDest = temp.get();
+    }
+    else if (destSize != rangeSize * itemCount)
+    {
+        image.Release();
+        return E_UNEXPECTED;
+    }
+
+    for (size_t item = firstItem; item < (firstItem + itemCount); ++item)
+    {
+        LARGE_INTEGER filePos;
+        filePos.QuadPart = static_cast<LONGLONG>(offset + itemSize * item + skipSize);
+        if (!SetFilePointerEx(hFile.get(), filePos, nullptr, FILE_BEGIN))
+        {
+            image.Release();
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        if (!ReadFile(hFile.get(), pDest, static_cast<DWORD>(rangeSize), &bytesRead, nullptr))
+        {
+            image.Release();
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        if (bytesRead != rangeSize)
+        {
+            image.Release();
+            return E_FAIL;
+        }
+
+        pDest += rangeSize;
+    }
+
+    if (!direct)
+    {
+        hr = CopyImage(temp.get(),
+            destSize,
+            smdata,
+            cflags,
+            convFlags,
+            pal8.get(),
+            image);
+        if (FAILED(hr))
+        {
+            image.Release();
+            return hr;
+        }
+    }
+    else if (convFlags & (CONV_FLAGS_SWIZZLE | CONV_FLAGS_NOALPHA))
+    {
+        // Swizzle/copy image in place
+        hr = CopyImageInPlace(convFlags, image.GetImages(), image.GetImageCount(), image.GetMetadata());
+        if (FAILED(hr))
+        {
+            image.Release();
+            return hr;
+        }
+    }
+
+    if (metadata)
+        memcpy(metadata, &smdata, sizeof(TexMetadata));
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Load a DDS file from disk by mapping it into memory
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::LoadFromDDSFileMapped(
+    const wchar_t* szFile,
+    DWORD flags,
+    TexMetadata* metadata,
+    MappedImage& image)
+{
+    if (!szFile)
+        return E_INVALIDARG;
+
+    image.Release();
+
+    if (flags & (DDS_FLAGS_LEGACY_DWORD | DDS_FLAGS_BAD_DXTN_TAILS))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+#if (_WIN32_WINNT >= _WIN32_WINNT_WIN8)
+    ScopedHandle hFile(safe_handle(CreateFile2(szFile, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr)));
+#else
+    ScopedHandle hFile(safe_handle(CreateFileW(szFile, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr)));
+#endif
+
+    if (!hFile)
+    {
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+
+    // Get the file size
+    FILE_STANDARD_INFO fileInfo;
+    if (!GetFileInformationByHandleEx(hFile.get(), FileStandardInfo, &fileInfo, sizeof(fileInfo)))
+    {
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+
+    // Same 4 GB limit as LoadFromDDSFile
+    if (fileInfo.EndOfFile.HighPart > 0)
+    {
+        return HRESULT_FROM_WIN32(ERROR_FILE_TOO_LARGE);
+    }
+
+    // Need at least enough data to fill the standard header and magic number to be a valid DDS
+    if (fileInfo.EndOfFile.LowPart < (sizeof(DDS_HEADER) + sizeof(uint32_t)))
+    {
+        return E_FAIL;
+    }
+
+    // Copy-on-write keeps the file untouched while still allowing the in-place swizzle below
+    ScopedHandle hMapping(safe_handle(CreateFileMappingW(hFile.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr)));
+    if (!hMapping)
+    {
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+
+    void* view = MapViewOfFile(hMapping.get(), FILE_MAP_COPY, 0, 0, 0);
+    if (!view)
+    {
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+
+    // The view stays valid after the file and mapping handles are closed
+    image.m_view = view;
+
+    const size_t size = fileInfo.EndOfFile.LowPart;
+    auto pSource = static_cast<uint8_t*>(view);
+
+    DWORD convFlags = 0;
+    TexMetadata mdata;
+    HRESULT hr = DecodeDDSHeader(pSource, size, flags, mdata, convFlags);
+    if (FAILED(hr))
+    {
+        image.Release();
+        return hr;
+    }
+
+    if (convFlags & (CONV_FLAGS_EXPAND | CONV_FLAGS_PAL8))
+    {
+        image.Release();
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    size_t offset = sizeof(uint32_t) + sizeof(DDS_HEADER);
+    if (convFlags & CONV_FLAGS_DX10)
+        offset += sizeof(DDS_HEADER_DXT10);
+
+    assert(offset <= size);
+
+    size_t nimages = 0;
+    size_t pixelSize = 0;
+    if (!_DetermineImageArray(mdata, CP_FLAGS_NONE, nimages, pixelSize))
+    {
+        image.Release();
+        return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+    }
+
+    if ((size - offset) < pixelSize)
+    {
+        image.Release();
+        return HRESULT_FROM_WIN32(ERROR_HANDLE_EOF);
+    }
+
+    image.m_image = new (std::nothrow) Image[nimages];
+    if (!image.m_image)
+    {
+        image.Release();
+        return E_OUTOFMEMORY;
+    }
+
+    memset(image.m_image, 0, sizeof(Image) * nimages);
+
+    if (!_SetupImageArray(pSource + offset, pixelSize, mdata, CP_FLAGS_NONE, image.m_image, nimages))
+    {
+        image.Release();
+        return E_FAIL;
+    }
+
+    if (convFlags & (CONV_FLAGS_SWIZZLE | CONV_FLAGS_NOALPHA))
+    {
+        // Only the pages touched here become private copies
+        hr = CopyImageInPlace(convFlags, image.m_image, nimages, mdata);
+        if (FAILED(hr))
+        {
+            image.Release();
+            return hr;
+        }
+    }
+
+    image.m_nimages = nimages;
+    image.m_size = pixelSize;
+    image.m_pixels = pSource + offset;
+    image.m_metadata = mdata;
+
+    if (metadata)
+        memcpy(metadata, &mdata, sizeof(TexMetadata));
+
+    return S_OK;
+}
+
+
 //-------------------------------------------------------------------------------------
 // Save a DDS file to memory
 //-------------------------------------------------------------------------------------
@@ -0,0 +1,202 @@
+//-------------------------------------------------------------------------------------
+// DirectXTexFilterCache.cpp
+//  
+// DirectX Texture Library - Shared cache of resize filter weight tables
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248926
+//-------------------------------------------------------------------------------------
+
+#include "DirectXTexp.h"
+
+#include "filters.h"
+
+#include <list>
+#include <mutex>
+
+using namespace DirectX;
+
+namespace
+{
+    // Bounds on the memory retained by each cache; tables larger than this are built but never kept
+    const size_t c_FilterCacheMaxBytes = 32 * 1024 * 1024;
+    const size_t c_FilterCacheMaxEntries = 64;
+
+    struct FilterKey
+    {
+        size_t  source;
+        size_t  dest;
+        DWORD   filter;
+        bool    wrap;
+        bool    mirror;
+
+        bool operator == (const FilterKey& other) const noexcept
+        {
+            return source == other.source && dest == other.dest && filter == other.filter
+                && wrap == other.wrap && mirror == other.mirror;
+        }
+    };
+
+    // Most-recently-used ordered list of immutable filter tables
+    template<typename T>
+    class FilterCache
+    {
+    public:
+        FilterCache() noexcept : mTotalBytes(0) {}
+
+        FilterCache(FilterCache const&) = delete;
+        FilterCache& operator= (FilterCache const&) = delete;
+
+        std::shared_ptr<const T> Find(const FilterKey& key)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            for (auto it = mEntries.begin(); it != mEntries.end(); ++it)
+            {
+                if (it->key == key)
+                {
+                    mEntries.splice(mEntries.begin(), mEntries, it);
+                    return mEntries.front().value;
+                }
+            }
+
+            return nullptr;
+        }
+
+        void Insert(const FilterKey& key, const std::shared_ptr<const T>& value, size_t bytes)
+        {
+            if (bytes > c_FilterCacheMaxBytes)
+                return;
+
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            // Another thread may have built the same table in the meantime
+            for (auto it = mEntries.cbegin(); it != mEntries.cend(); ++it)
+            {
+                if (it->key == key)
+                    return;
+            }
+
+            while (!mEntries.empty()
+                && (mEntries.size() >= c_FilterCacheMaxEntries || (mTotalBytes + bytes) > c_FilterCacheMaxBytes))
+            {
+                mTotalBytes -= mEntries.back().bytes;
+                mEntries.pop_back();
+            }
+
+            Entry entry = { key, value, bytes };
+            mEntries.push_front(entry);
+            mTotalBytes += bytes;
+        }
+
+    private:
+        struct Entry
+        {
+            FilterKey                   key;
+            std::shared_ptr<const T>    value;
+            size_t                      bytes;
+        };
+
+        std::mutex          mMutex;
+        std::list<Entry>    mEntries;
+        size_t              mTotalBytes;
+    };
+
+    FilterCache<SeparableFilter>& GetSeparableFilterCache()
+    {
+        static FilterCache<SeparableFilter> s_cache;
+        return s_cache;
+    }
+
+    FilterCache<TriangleFilter::Filter>& GetTriangleFilterCache()
+    {
+        static FilterCache<TriangleFilter::Filter> s_cache;
+        return s_cache;
+    }
+}
+
+
+//=====================================================================================
+// Entry-points
+//=====================================================================================
+
+_Use_decl_annotations_
+HRESULT DirectX::_GetCachedSeparableFilter(
+    size_t source,
+    size_t dest,
+    DWORD filter,
+    bool wrap,
+    bool mirror,
+    std::shared_ptr<const SeparableFilter>& sf)
+{
+    sf.reset();
+
+    if (!source || !dest)
+        return E_INVALIDARG;
+
+    FilterKey key = { source, dest, filter, wrap, mirror };
+
+    auto& cache = GetSeparableFilterCache();
+
+    sf = cache.Find(key);
+    if (sf)
+        return S_OK;
+
+    std::shared_ptr<SeparableFilter> result(new (std::nothrow) SeparableFilter);
+    if (!result)
+        return E_OUTOFMEMORY;
+
+    HRESULT hr = _CreateSeparableFilter(source, dest, filter, wrap, mirror, *result);
+    if (FAILED(hr))
+        return hr;
+
+    // Fixed-point weights are optional, so a kernel that can't be quantized is still cached
+    hr = _QuantizeSeparableFilter(dest, *result);
+    if (FAILED(hr))
+        return hr;
+
+    size_t bytes = sizeof(SeparableFilter)
+        + dest * (sizeof(size_t) + result->taps * (sizeof(size_t) + sizeof(float)));
+    if (result->fixedWeight)
+        bytes += dest * result->taps * sizeof(int16_t);
+
+    sf = result;
+    cache.Insert(key, sf, bytes);
+
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT DirectX::_GetCachedTriangleFilter(
+    size_t source,
+    size_t dest,
+    bool wrap,
+    std::shared_ptr<const TriangleFilter::Filter>& tf)
+{
+    tf.reset();
+
+    if (!source || !dest)
+        return E_INVALIDARG;
+
+    FilterKey key = { source, dest, TEX_FILTER_TRIANGLE, wrap, false };
+
+    auto& cache = GetTriangleFilterCache();
+
+    tf = cache.Find(key);
+    if (tf)
+        return S_OK;
+
+    std::unique_ptr<TriangleFilter::Filter> result;
+    HRESULT hr = TriangleFilter::_Create(source, dest, wrap, result);
+    if (FAILED(hr))
+        return hr;
+
+    const size_t bytes = result->totalSize;
+
+    tf = std::move(result);
+    cache.Insert(key, tf, bytes);
+
+    return S_OK;
+}
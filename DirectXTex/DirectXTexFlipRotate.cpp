@@ -171,6 +171,69 @@ namespace
 
         return S_OK;
     }
+
+
+    //-------------------------------------------------------------------------------------
+    // Do flip operation in-place by swapping whole pixels (no format conversion)
+    //-------------------------------------------------------------------------------------
+    HRESULT PerformFlipInPlace(
+        const Image& image,
+        bool flipHorizontal,
+        bool flipVertical)
+    {
+        if (!image.pixels)
+            return E_POINTER;
+
+        size_t bpp = BitsPerPixel(image.format);
+        if (!bpp || (bpp % 8) || (bpp > 128)
+            || IsCompressed(image.format) || IsPlanar(image.format) || IsPacked(image.format))
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+        const size_t bytesPerPixel = bpp / 8;
+        const size_t rowBytes = image.width * bytesPerPixel;
+        if (rowBytes > image.rowPitch)
+            return E_FAIL;
+
+        if (flipHorizontal)
+        {
+            uint8_t temp[16];
+
+            uint8_t* pRow = image.pixels;
+            for (size_t h = 0; h < image.height; ++h, pRow += image.rowPitch)
+            {
+                uint8_t* pLeft = pRow;
+                uint8_t* pRight = pRow + rowBytes - bytesPerPixel;
+                while (pLeft < pRight)
+                {
+                    memcpy(temp, pLeft, bytesPerPixel);
+                    memcpy(pLeft, pRight, bytesPerPixel);
+                    memcpy(pRight, temp, bytesPerPixel);
+                    pLeft += bytesPerPixel;
+                    pRight -= bytesPerPixel;
+                }
+            }
+        }
+
+        if (flipVertical && image.height > 1)
+        {
+            std::unique_ptr<uint8_t[]> temp(new (std::nothrow) uint8_t[rowBytes]);
+            if (!temp)
+                return E_OUTOFMEMORY;
+
+            uint8_t* pTop = image.pixels;
+            uint8_t* pBottom = image.pixels + (image.height - 1) * image.rowPitch;
+            while (pTop < pBottom)
+            {
+                memcpy(temp.get(), pTop, rowBytes);
+                memcpy(pTop, pBottom, rowBytes);
+                memcpy(pBottom, temp.get(), rowBytes);
+                pTop += image.rowPitch;
+                pBottom -= image.rowPitch;
+            }
+        }
+
+        return S_OK;
+    }
 }
 
 
@@ -275,6 +338,96 @@ HRESULT DirectX::FlipRotate(
 }
 
 
+//-------------------------------------------------------------------------------------
+// Flip/rotate image into a caller-provided destination
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::FlipRotate(
+    const Image& srcImage,
+    DWORD flags,
+    const Image& destImage)
+{
+    if (!srcImage.pixels || !destImage.pixels)
+        return E_POINTER;
+
+    if (!flags)
+        return E_INVALIDARG;
+
+    if ((srcImage.width > UINT32_MAX) || (srcImage.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    if (IsCompressed(srcImage.format))
+    {
+        // We don't support flip/rotate operations on compressed images
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    // Only supports 90, 180, 270, or no rotation flags... not a combination of rotation flags
+    int rotateMode = static_cast<int>(flags & (TEX_FR_ROTATE0 | TEX_FR_ROTATE90 | TEX_FR_ROTATE180 | TEX_FR_ROTATE270));
+
+    switch (rotateMode)
+    {
+    case 0:
+    case TEX_FR_ROTATE90:
+    case TEX_FR_ROTATE180:
+    case TEX_FR_ROTATE270:
+        break;
+
+    default:
+        return E_INVALIDARG;
+    }
+
+    if (srcImage.format != destImage.format)
+        return E_INVALIDARG;
+
+    if ((rotateMode == TEX_FR_ROTATE90) || (rotateMode == TEX_FR_ROTATE270))
+    {
+        if (destImage.width != srcImage.height || destImage.height != srcImage.width)
+            return E_INVALIDARG;
+    }
+    else if (destImage.width != srcImage.width || destImage.height != srcImage.height)
+    {
+        return E_INVALIDARG;
+    }
+
+    if (srcImage.pixels == destImage.pixels)
+    {
+        // In-place requires the layout to be unchanged, which rules out 90 and 270 degree rotations
+        if ((rotateMode == TEX_FR_ROTATE90) || (rotateMode == TEX_FR_ROTATE270)
+            || (srcImage.rowPitch != destImage.rowPitch))
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+        // A 180 degree rotation is equivalent to flipping both horizontally and vertically
+        bool rotate180 = (rotateMode == TEX_FR_ROTATE180);
+        bool flipHorizontal = ((flags & TEX_FR_FLIP_HORIZONTAL) != 0) != rotate180;
+        bool flipVertical = ((flags & TEX_FR_FLIP_VERTICAL) != 0) != rotate180;
+
+        return PerformFlipInPlace(srcImage, flipHorizontal, flipVertical);
+    }
+
+    WICPixelFormatGUID pfGUID;
+    if (_DXGIToWIC(srcImage.format, pfGUID))
+    {
+        // Case 1: Source format is supported by Windows Imaging Component
+        return PerformFlipRotateUsingWIC(srcImage, flags, pfGUID, destImage);
+    }
+    else
+    {
+        // Case 2: Source format is not supported by WIC, so we have to convert, flip/rotate, and convert back
+        uint64_t expandedSize = uint64_t(srcImage.width) * uint64_t(srcImage.height) * sizeof(float) * 4;
+        if (expandedSize > UINT32_MAX)
+        {
+            // Image is too large for float32, so have to use float16 instead
+            return PerformFlipRotateViaF16(srcImage, flags, destImage);
+        }
+        else
+        {
+            return PerformFlipRotateViaF32(srcImage, flags, destImage);
+        }
+    }
+}
+
+
 //-------------------------------------------------------------------------------------
 // Flip/rotate image (complex)
 //-------------------------------------------------------------------------------------
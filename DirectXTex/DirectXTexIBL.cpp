@@ -0,0 +1,957 @@
+//-------------------------------------------------------------------------------------
+// DirectXTexIBL.cpp
+//  
+// DirectX Texture Library - Image based lighting environment map filtering
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248926
+//-------------------------------------------------------------------------------------
+
+#include "DirectXTexp.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#pragma warning(disable : 4616 6993)
+#endif
+
+using namespace DirectX;
+
+namespace DirectX
+{
+    extern bool _CalculateMipLevels(_In_ size_t width, _In_ size_t height, _Inout_ size_t& mipLevels);
+}
+
+namespace
+{
+    //--- Hammersley point set ---
+    // http://holger.dammertz.org/stuff/notes_HammersleyOnHemisphere.html
+    inline float RadicalInverse(uint32_t bits)
+    {
+        bits = (bits << 16u) | (bits >> 16u);
+        bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+        bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+        bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+        bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+        return float(bits) * 2.3283064365386963e-10f;
+    }
+
+    //--- GGX importance samples ---
+    // Since the view direction is taken to be the normal, every output texel uses the same samples expressed in the
+    // tangent frame of its normal: x, y, z is the light direction (z being N.L, the sample weight) and w is the source
+    // level to read, chosen so the texels covered match the solid angle of the sample
+    // http://blog.selfshadow.com/publications/s2013-shading-course/karis/s2013_pbs_epic_notes_v2.pdf
+    HRESULT CreateSpecularSamples(
+        float roughness,
+        size_t sampleCount,
+        const TexMetadata& source,
+        ScopedAlignedArrayXMVECTOR& samples,
+        size_t& count,
+        float& totalWeight)
+    {
+        count = 0;
+        totalWeight = 0.f;
+
+        if (roughness <= 0.f)
+            sampleCount = 1;
+
+        samples.reset(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * sampleCount, 16)));
+        if (!samples)
+            return E_OUTOFMEMORY;
+
+        if (roughness <= 0.f)
+        {
+            // A perfect mirror reflects the source exactly
+            samples[0] = g_XMIdentityR2;
+            count = 1;
+            totalWeight = 1.f;
+            return S_OK;
+        }
+
+        const float a = roughness * roughness;
+        const float a2 = a * a;
+        const float maxLod = float(source.mipLevels - 1);
+        const float solidAngleTexel = 4.f * XM_PI / (6.f * float(source.width) * float(source.width));
+
+        for (size_t i = 0; i < sampleCount; ++i)
+        {
+            const float xi0 = float(i) / float(sampleCount);
+            const float xi1 = RadicalInverse(static_cast<uint32_t>(i));
+
+            const float phi = XM_2PI * xi0;
+            const float cosTheta = sqrtf((1.f - xi1) / (1.f + (a2 - 1.f) * xi1));
+            const float sinTheta = sqrtf(std::max(0.f, 1.f - cosTheta * cosTheta));
+
+            float sinPhi, cosPhi;
+            XMScalarSinCos(&sinPhi, &cosPhi, phi);
+
+            // L = 2 * dot(V, H) * H - V, with V = N = (0, 0, 1)
+            const float NoL = 2.f * cosTheta * cosTheta - 1.f;
+            if (NoL <= 0.f)
+                continue;
+
+            // pdf = D(h) * N.H / (4 * V.H), which is D(h) / 4 since V = N
+            const float d = cosTheta * cosTheta * (a2 - 1.f) + 1.f;
+            const float D = a2 / (XM_PI * d * d);
+            const float pdf = D * 0.25f;
+
+            const float solidAngleSample = 1.f / (float(sampleCount) * pdf);
+            float lod = 0.5f * log2f(solidAngleSample / solidAngleTexel);
+            lod = std::min(std::max(lod, 0.f), maxLod);
+
+            samples[count++] = XMVectorSet(2.f * cosTheta * sinTheta * cosPhi, 2.f * cosTheta * sinTheta * sinPhi, NoL, lod);
+            totalWeight += NoL;
+        }
+
+        return (count > 0) ? S_OK : E_FAIL;
+    }
+
+
+    //--- Specular prefiltering ---
+    void PrefilterSpecularRow(
+        _In_reads_(sourceLevels * 6) const Image* const* sourceFaces,
+        size_t sourceLevels,
+        _In_reads_(count) const XMVECTOR* samples,
+        size_t count,
+        float totalWeight,
+        size_t face,
+        size_t y,
+        const Image& destImage)
+    {
+        const size_t size = destImage.width;
+        const float scale = 2.f / float(size);
+        const float v = 1.f - (float(y) + 0.5f) * scale;
+
+        const XMVECTOR invWeight = XMVectorReplicate(1.f / totalWeight);
+
+        auto dptr = reinterpret_cast<XMFLOAT4*>(destImage.pixels + destImage.rowPitch * y);
+        for (size_t x = 0; x < size; ++x, ++dptr)
+        {
+            const float u = (float(x) + 0.5f) * scale - 1.f;
+
+            XMVECTOR N = XMVector3Normalize(_CubeFaceDirection(face, u, v));
+
+            // Tangent frame of the normal, as built by importanceSampleGGX
+            XMVECTOR up = (fabsf(XMVectorGetZ(N)) < 0.999f) ? g_XMIdentityR2 : g_XMIdentityR0;
+            XMVECTOR tangentX = XMVector3Normalize(XMVector3Cross(up, N));
+            XMVECTOR tangentY = XMVector3Cross(N, tangentX);
+
+            XMVECTOR sum = g_XMZero;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const XMVECTOR s = samples[i];
+
+                XMVECTOR L = XMVectorMultiply(XMVectorSplatZ(s), N);
+                L = XMVectorMultiplyAdd(XMVectorSplatY(s), tangentY, L);
+                L = XMVectorMultiplyAdd(XMVectorSplatX(s), tangentX, L);
+
+                XMVECTOR c = _SampleCubeTrilinear(sourceFaces, sourceLevels, L, XMVectorGetW(s));
+                sum = XMVectorMultiplyAdd(XMVectorMax(c, g_XMZero), XMVectorSplatZ(s), sum);
+            }
+
+            XMStoreFloat4(dptr, XMVectorMultiply(sum, invWeight));
+        }
+    }
+
+    HRESULT PrefilterSpecularLevel(
+        const ScratchImage& source,
+        size_t level,
+        float roughness,
+        size_t sampleCount,
+        DWORD filter,
+        const ScratchImage& dest)
+    {
+        const TexMetadata& smdata = source.GetMetadata();
+
+        ScopedAlignedArrayXMVECTOR samples;
+        size_t count;
+        float totalWeight;
+        HRESULT hr = CreateSpecularSamples(roughness, sampleCount, smdata, samples, count, totalWeight);
+        if (FAILED(hr))
+            return hr;
+
+        const size_t cubes = smdata.arraySize / 6;
+        const size_t size = std::max<size_t>(1, smdata.width >> level);
+
+        for (size_t cube = 0; cube < cubes; ++cube)
+        {
+            std::unique_ptr<const Image*[]> sourceFaces(new (std::nothrow) const Image*[smdata.mipLevels * 6]);
+            if (!sourceFaces)
+                return E_OUTOFMEMORY;
+
+            for (size_t slevel = 0; slevel < smdata.mipLevels; ++slevel)
+            {
+                for (size_t face = 0; face < 6; ++face)
+                {
+                    auto img = source.GetImage(slevel, cube * 6 + face, 0);
+                    if (!img)
+                        return E_POINTER;
+
+                    sourceFaces[slevel * 6 + face] = img;
+                }
+            }
+
+            const Image* destFaces[6] = {};
+            for (size_t face = 0; face < 6; ++face)
+            {
+                destFaces[face] = dest.GetImage(level, cube * 6 + face, 0);
+                if (!destFaces[face] || destFaces[face]->width != size)
+                    return E_POINTER;
+            }
+
+            // Every face row is an independent job
+            const size_t rows = 6 * size;
+
+            if (filter & TEX_FILTER_PARALLEL)
+            {
+#ifdef _OPENMP
+                if (rows > INT32_MAX)
+                    return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+#pragma omp parallel for schedule(dynamic)
+                for (int row = 0; row < static_cast<int>(rows); ++row)
+                {
+                    const size_t face = size_t(row) / size;
+                    PrefilterSpecularRow(sourceFaces.get(), smdata.mipLevels, samples.get(), count, totalWeight,
+                        face, size_t(row) % size, *destFaces[face]);
+                }
+#endif
+            }
+            else
+            {
+                for (size_t row = 0; row < rows; ++row)
+                {
+                    const size_t face = row / size;
+                    PrefilterSpecularRow(sourceFaces.get(), smdata.mipLevels, samples.get(), count, totalWeight,
+                        face, row % size, *destFaces[face]);
+                }
+            }
+        }
+
+        return S_OK;
+    }
+
+    //--- Spherical harmonics ---
+    const size_t c_SHMaxOrder = 3;
+
+    // Real SH basis up to order 3 for a unit direction, in the order (l, m) = (0, 0), (1, -1), (1, 0), (1, 1), (2, -2) ...
+    // http://graphics.stanford.edu/papers/envmap/envmap.pdf
+#pragma prefast(suppress : 25000, "FXMVECTOR is 16 bytes")
+    inline void EvaluateSHBasis(FXMVECTOR dir, size_t order, _Out_writes_(order * order) float* basis)
+    {
+        XMFLOAT3 d;
+        XMStoreFloat3(&d, dir);
+
+        basis[0] = 0.282094792f;
+
+        if (order > 1)
+        {
+            basis[1] = 0.488602512f * d.y;
+            basis[2] = 0.488602512f * d.z;
+            basis[3] = 0.488602512f * d.x;
+        }
+
+        if (order > 2)
+        {
+            basis[4] = 1.092548431f * d.x * d.y;
+            basis[5] = 1.092548431f * d.y * d.z;
+            basis[6] = 0.315391565f * (3.f * d.z * d.z - 1.f);
+            basis[7] = 1.092548431f * d.x * d.z;
+            basis[8] = 0.546274215f * (d.x * d.x - d.y * d.y);
+        }
+    }
+
+    // Solid angle of the texels of a face, which only depends on the texel's distance from the face center, so a
+    // single quadrant is stored and indexed with TexelSolidAngle
+    inline float AreaElement(float x, float y)
+    {
+        return atan2f(x * y, sqrtf(x * x + y * y + 1.f));
+    }
+
+    HRESULT CreateTexelSolidAngles(size_t size, ScopedAlignedArrayFloat& solidAngles)
+    {
+        const size_t half = (size + 1) / 2;
+
+        solidAngles.reset(static_cast<float*>(_aligned_malloc(sizeof(float) * half * half, 16)));
+        if (!solidAngles)
+            return E_OUTOFMEMORY;
+
+        const float scale = 2.f / float(size);
+
+        for (size_t y = 0; y < half; ++y)
+        {
+            const float v0 = float(y) * scale - 1.f;
+            const float v1 = float(y + 1) * scale - 1.f;
+
+            for (size_t x = 0; x < half; ++x)
+            {
+                const float u0 = float(x) * scale - 1.f;
+                const float u1 = float(x + 1) * scale - 1.f;
+
+                solidAngles[y * half + x] = AreaElement(u0, v0) - AreaElement(u0, v1) - AreaElement(u1, v0) + AreaElement(u1, v1);
+            }
+        }
+
+        return S_OK;
+    }
+
+    inline float TexelSolidAngle(_In_ const float* solidAngles, size_t size, size_t x, size_t y)
+    {
+        const size_t half = (size + 1) / 2;
+        return solidAngles[std::min(y, size - 1 - y) * half + std::min(x, size - 1 - x)];
+    }
+
+    // Accumulates the projection of rows [yStart, yEnd) of a face into coefficients
+    HRESULT ProjectSHRows(
+        const Image& srcImage,
+        size_t face,
+        size_t yStart,
+        size_t yEnd,
+        DWORD filter,
+        _In_ const float* solidAngles,
+        size_t order,
+        _Inout_updates_all_(order * order) XMVECTOR* coefficients)
+    {
+        const size_t size = srcImage.width;
+
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * size, 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        const float scale = 2.f / float(size);
+        float basis[c_SHMaxOrder * c_SHMaxOrder];
+
+        for (size_t y = yStart; y < yEnd; ++y)
+        {
+            if (!_LoadScanlineLinear(scanline.get(), size, srcImage.pixels + srcImage.rowPitch * y, srcImage.rowPitch, srcImage.format, filter))
+                return E_FAIL;
+
+            const float v = 1.f - (float(y) + 0.5f) * scale;
+
+            for (size_t x = 0; x < size; ++x)
+            {
+                const float u = (float(x) + 0.5f) * scale - 1.f;
+
+                EvaluateSHBasis(XMVector3Normalize(_CubeFaceDirection(face, u, v)), order, basis);
+
+                XMVECTOR c = XMVectorScale(scanline[x], TexelSolidAngle(solidAngles, size, x, y));
+                for (size_t i = 0; i < order * order; ++i)
+                {
+                    coefficients[i] = XMVectorMultiplyAdd(c, XMVectorReplicate(basis[i]), coefficients[i]);
+                }
+            }
+        }
+
+        return S_OK;
+    }
+
+    // Projects the top level of one cube onto the SH basis (radiance coefficients per channel)
+    HRESULT ProjectCubeToSH(
+        _In_reads_(nimages) const Image* srcImages,
+        size_t nimages,
+        const TexMetadata& metadata,
+        size_t cube,
+        DWORD filter,
+        size_t order,
+        _Out_writes_(order * order) XMVECTOR* coefficients)
+    {
+        const size_t size = metadata.width;
+
+        const Image* faces[6] = {};
+        for (size_t face = 0; face < 6; ++face)
+        {
+            const size_t index = metadata.ComputeIndex(0, cube * 6 + face, 0);
+            if (index >= nimages)
+                return E_FAIL;
+
+            faces[face] = &srcImages[index];
+            if (faces[face]->width != size || faces[face]->height != size || faces[face]->format != metadata.format)
+                return E_FAIL;
+        }
+
+        ScopedAlignedArrayFloat solidAngles;
+        HRESULT hr = CreateTexelSolidAngles(size, solidAngles);
+        if (FAILED(hr))
+            return hr;
+
+        const size_t ncoeffs = order * order;
+        for (size_t i = 0; i < ncoeffs; ++i)
+        {
+            coefficients[i] = g_XMZero;
+        }
+
+        if (filter & TEX_FILTER_PARALLEL)
+        {
+#ifdef _OPENMP
+            // Each band reduces into its own partial sums, which are added up in a fixed order so the result
+            // doesn't depend on the number of threads
+            static const size_t c_MinBandRows = 16;
+
+            const size_t nthreads = static_cast<size_t>(std::max<int>(1, omp_get_max_threads()));
+            const size_t targetBands = std::max<size_t>(1, (nthreads * 4 + 5) / 6);
+            const size_t bandRows = std::max<size_t>(c_MinBandRows, (size + targetBands - 1) / targetBands);
+            const size_t nbands = (size + bandRows - 1) / bandRows;
+            const size_t njobs = nbands * 6;
+
+            if (njobs > INT32_MAX)
+                return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+            ScopedAlignedArrayXMVECTOR partial(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * ncoeffs * njobs, 16)));
+            if (!partial)
+                return E_OUTOFMEMORY;
+
+            bool fail = false;
+
+#pragma omp parallel for
+            for (int job = 0; job < static_cast<int>(njobs); ++job)
+            {
+                const size_t face = size_t(job) / nbands;
+                const size_t yStart = (size_t(job) % nbands) * bandRows;
+                const size_t yEnd = std::min<size_t>(yStart + bandRows, size);
+
+                XMVECTOR* sums = partial.get() + size_t(job) * ncoeffs;
+                for (size_t i = 0; i < ncoeffs; ++i)
+                {
+                    sums[i] = g_XMZero;
+                }
+
+                HRESULT hrJob = ProjectSHRows(*faces[face], face, yStart, yEnd, filter, solidAngles.get(), order, sums);
+                if (FAILED(hrJob))
+                    fail = true;
+            }
+
+            if (fail)
+                return E_FAIL;
+
+            for (size_t job = 0; job < njobs; ++job)
+            {
+                for (size_t i = 0; i < ncoeffs; ++i)
+                {
+                    coefficients[i] = XMVectorAdd(coefficients[i], partial[job * ncoeffs + i]);
+                }
+            }
+#endif
+        }
+        else
+        {
+            for (size_t face = 0; face < 6; ++face)
+            {
+                hr = ProjectSHRows(*faces[face], face, 0, size, filter, solidAngles.get(), order, coefficients);
+                if (FAILED(hr))
+                    return hr;
+            }
+        }
+
+        return S_OK;
+    }
+
+    // Writes rows of an irradiance face from convolved coefficients (which already include the cosine lobe and 1/pi)
+    HRESULT EvaluateIrradianceRows(
+        _In_reads_(order * order) const XMVECTOR* coefficients,
+        size_t order,
+        size_t face,
+        size_t yStart,
+        size_t yEnd,
+        DWORD filter,
+        const Image& destImage)
+    {
+        const size_t size = destImage.width;
+
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * size, 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        const float scale = 2.f / float(size);
+        float basis[c_SHMaxOrder * c_SHMaxOrder];
+
+        for (size_t y = yStart; y < yEnd; ++y)
+        {
+            const float v = 1.f - (float(y) + 0.5f) * scale;
+
+            for (size_t x = 0; x < size; ++x)
+            {
+                const float u = (float(x) + 0.5f) * scale - 1.f;
+
+                EvaluateSHBasis(XMVector3Normalize(_CubeFaceDirection(face, u, v)), order, basis);
+
+                XMVECTOR c = g_XMZero;
+                for (size_t i = 0; i < order * order; ++i)
+                {
+                    c = XMVectorMultiplyAdd(coefficients[i], XMVectorReplicate(basis[i]), c);
+                }
+
+                // Ringing can push low order reconstructions negative
+                scanline[x] = XMVectorSelect(g_XMOne, XMVectorMax(c, g_XMZero), g_XMSelect1110);
+            }
+
+            if (!_StoreScanlineLinear(destImage.pixels + destImage.rowPitch * y, destImage.rowPitch, destImage.format, scanline.get(), size, filter))
+                return E_FAIL;
+        }
+
+        return S_OK;
+    }
+
+    //--- Environment BRDF ---
+    // Geometry term of one direction, as GGX() in Shaders/BRDF/schlick.hlsl and smith.hlsl with the remapped roughness
+    inline float BRDFGeometry(float NoV, float roughness, bool smith)
+    {
+        const float a = roughness * roughness;
+        if (smith)
+        {
+            const float a2 = a * a;
+            return 2.f * NoV / (NoV + sqrtf(NoV * NoV * (1.f - a2) + a2));
+        }
+        else
+        {
+            const float k = a * 0.5f;
+            return NoV / (NoV * (1.f - k) + k);
+        }
+    }
+
+    // Integrates rows [yStart, yEnd) of the table, as sumLut() does over GGX importance samples
+    HRESULT IntegrateBRDFRows(size_t sampleCount, bool smith, size_t yStart, size_t yEnd, const Image& destImage)
+    {
+        const size_t width = destImage.width;
+
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * (width + sampleCount), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        // Half vectors are the same for the whole row, since the sampled lobe is isotropic around N = (0, 0, 1)
+        XMVECTOR* halfVectors = scanline.get() + width;
+
+        for (size_t y = yStart; y < yEnd; ++y)
+        {
+            const float roughness = (float(y) + 0.5f) / float(destImage.height);
+            const float a = roughness * roughness;
+            const float a2 = a * a;
+
+            for (size_t i = 0; i < sampleCount; ++i)
+            {
+                const float xi0 = float(i) / float(sampleCount);
+                const float xi1 = RadicalInverse(static_cast<uint32_t>(i));
+
+                const float cosTheta = sqrtf((1.f - xi1) / (1.f + (a2 - 1.f) * xi1));
+                const float sinTheta = sqrtf(std::max(0.f, 1.f - cosTheta * cosTheta));
+
+                float sinPhi, cosPhi;
+                XMScalarSinCos(&sinPhi, &cosPhi, XM_2PI * xi0);
+
+                halfVectors[i] = XMVectorSet(sinTheta * cosPhi, sinTheta * sinPhi, cosTheta, 0.f);
+            }
+
+            for (size_t x = 0; x < width; ++x)
+            {
+                const float NoV = (float(x) + 0.5f) / float(width);
+                const XMVECTOR V = XMVectorSet(sqrtf(1.f - NoV * NoV), 0.f, NoV, 0.f);
+                const float visibility = BRDFGeometry(NoV, roughness, smith);
+
+                float scale = 0.f;
+                float bias = 0.f;
+                for (size_t i = 0; i < sampleCount; ++i)
+                {
+                    const XMVECTOR H = halfVectors[i];
+                    const float VoH = XMVectorGetX(XMVector3Dot(V, H));
+
+                    // L = 2 * dot(V, H) * H - V
+                    const float NoL = 2.f * VoH * XMVectorGetZ(H) - NoV;
+                    if (NoL <= 0.f)
+                        continue;
+
+                    const float NoH = XMVectorGetZ(H);
+                    const float G = BRDFGeometry(NoL, roughness, smith) * visibility;
+                    const float G_Vis = G * VoH / (NoH * NoV);
+                    const float F = powf(1.f - VoH, 5.f);
+
+                    scale += (1.f - F) * G_Vis;
+                    bias += F * G_Vis;
+                }
+
+                scanline[x] = XMVectorSet(scale / float(sampleCount), bias / float(sampleCount), 0.f, 1.f);
+            }
+
+            if (!_StoreScanline(destImage.pixels + destImage.rowPitch * y, destImage.rowPitch, destImage.format, scanline.get(), width))
+                return E_FAIL;
+        }
+
+        return S_OK;
+    }
+
+    // Cached tables are only reused when they match exactly what would be computed
+    bool IsMatchingBRDFTable(const TexMetadata& metadata, size_t width, size_t height, DXGI_FORMAT format)
+    {
+        return metadata.width == width && metadata.height == height && metadata.format == format
+            && metadata.dimension == TEX_DIMENSION_TEXTURE2D && metadata.depth == 1
+            && metadata.arraySize == 1 && metadata.mipLevels == 1;
+    }
+}
+
+
+//=====================================================================================
+// Entry-points
+//=====================================================================================
+
+//-------------------------------------------------------------------------------------
+// GGX prefiltered specular environment map
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::PrefilterSpecularCubeMap(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DWORD filter,
+    size_t sampleCount,
+    size_t levels,
+    ScratchImage& result)
+{
+    if (!srcImages || !nimages || !IsValid(metadata.format))
+        return E_INVALIDARG;
+
+    if (!metadata.IsCubemap() || metadata.dimension != TEX_DIMENSION_TEXTURE2D
+        || (metadata.arraySize % 6) != 0 || metadata.width != metadata.height)
+        return E_INVALIDARG;
+
+    if (!sampleCount || sampleCount > UINT32_MAX)
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format) || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (!_CalculateMipLevels(metadata.width, metadata.height, levels))
+        return E_INVALIDARG;
+
+#ifndef _OPENMP
+    if (filter & TEX_FILTER_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    // Samples with a wide lobe read from the smaller levels of a complete source chain
+    size_t sourceLevels = 0;
+    if (!_CalculateMipLevels(metadata.width, metadata.height, sourceLevels))
+        return E_INVALIDARG;
+
+    ScratchImage source;
+    HRESULT hr = _ConvertCubeMapToR32G32B32A32(srcImages, nimages, metadata, filter, sourceLevels, source);
+    if (FAILED(hr))
+        return hr;
+
+    TexMetadata mdata = source.GetMetadata();
+    mdata.mipLevels = levels;
+
+    ScratchImage filtered;
+    hr = filtered.Initialize(mdata);
+    if (FAILED(hr))
+        return hr;
+
+    for (size_t level = 0; level < levels; ++level)
+    {
+        const float roughness = (levels > 1) ? float(level) / float(levels - 1) : 0.f;
+
+        hr = PrefilterSpecularLevel(source, level, roughness, sampleCount, filter, filtered);
+        if (FAILED(hr))
+            return hr;
+    }
+
+    source.Release();
+
+    if (metadata.format == DXGI_FORMAT_R32G32B32A32_FLOAT)
+    {
+        std::swap(result, filtered);
+        return S_OK;
+    }
+
+    return Convert(filtered.GetImages(), filtered.GetImageCount(), filtered.GetMetadata(), metadata.format,
+        filter & TEX_FILTER_SRGB_OUT, TEX_THRESHOLD_DEFAULT, result);
+}
+
+
+//-------------------------------------------------------------------------------------
+// Spherical harmonics projection of a cubemap
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::ProjectCubeMapToSH(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    size_t cube,
+    DWORD filter,
+    size_t order,
+    XMFLOAT3* coefficients)
+{
+    if (!srcImages || !nimages || !coefficients || !IsValid(metadata.format))
+        return E_INVALIDARG;
+
+    if (!metadata.IsCubemap() || metadata.dimension != TEX_DIMENSION_TEXTURE2D
+        || (metadata.arraySize % 6) != 0 || metadata.width != metadata.height)
+        return E_INVALIDARG;
+
+    if (cube >= metadata.arraySize / 6 || !order || order > c_SHMaxOrder)
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format) || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+#ifndef _OPENMP
+    if (filter & TEX_FILTER_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    XMVECTOR sh[c_SHMaxOrder * c_SHMaxOrder];
+    HRESULT hr = ProjectCubeToSH(srcImages, nimages, metadata, cube, filter, order, sh);
+    if (FAILED(hr))
+        return hr;
+
+    for (size_t i = 0; i < order * order; ++i)
+    {
+        XMStoreFloat3(&coefficients[i], sh[i]);
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Diffuse irradiance environment map from spherical harmonics
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::GenerateIrradianceCubeMap(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DWORD filter,
+    size_t order,
+    size_t size,
+    ScratchImage& result)
+{
+    if (!srcImages || !nimages || !IsValid(metadata.format))
+        return E_INVALIDARG;
+
+    if (!metadata.IsCubemap() || metadata.dimension != TEX_DIMENSION_TEXTURE2D
+        || (metadata.arraySize % 6) != 0 || metadata.width != metadata.height)
+        return E_INVALIDARG;
+
+    if (!order || order > c_SHMaxOrder)
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format) || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+#ifndef _OPENMP
+    if (filter & TEX_FILTER_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    if (!size)
+        size = metadata.width;
+
+    TexMetadata mdata = metadata;
+    mdata.width = mdata.height = size;
+    mdata.mipLevels = 1;
+
+    HRESULT hr = result.Initialize(mdata);
+    if (FAILED(hr))
+        return hr;
+
+    // Cosine lobe convolution per band, divided by pi so the result is the light a white diffuse surface reflects
+    static const float s_bandScale[c_SHMaxOrder] = { 1.f, 2.f / 3.f, 0.25f };
+
+    const size_t cubes = metadata.arraySize / 6;
+    for (size_t cube = 0; cube < cubes; ++cube)
+    {
+        XMVECTOR sh[c_SHMaxOrder * c_SHMaxOrder];
+        hr = ProjectCubeToSH(srcImages, nimages, metadata, cube, filter, order, sh);
+        if (FAILED(hr))
+        {
+            result.Release();
+            return hr;
+        }
+
+        for (size_t l = 0; l < order; ++l)
+        {
+            for (size_t i = l * l; i < (l + 1) * (l + 1); ++i)
+            {
+                sh[i] = XMVectorScale(sh[i], s_bandScale[l]);
+            }
+        }
+
+        const Image* destFaces[6] = {};
+        for (size_t face = 0; face < 6; ++face)
+        {
+            destFaces[face] = result.GetImage(0, cube * 6 + face, 0);
+            if (!destFaces[face])
+            {
+                result.Release();
+                return E_POINTER;
+            }
+        }
+
+        if (filter & TEX_FILTER_PARALLEL)
+        {
+#ifdef _OPENMP
+            // Evaluating is cheap, so a face is split into just a few bands
+            const size_t nthreads = static_cast<size_t>(std::max<int>(1, omp_get_max_threads()));
+            const size_t nbands = std::min<size_t>(size, (nthreads + 5) / 6);
+            const size_t bandRows = (size + nbands - 1) / nbands;
+            const size_t njobs = nbands * 6;
+
+            if (njobs > INT32_MAX)
+            {
+                result.Release();
+                return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+            }
+
+            bool fail = false;
+
+#pragma omp parallel for
+            for (int job = 0; job < static_cast<int>(njobs); ++job)
+            {
+                const size_t face = size_t(job) / nbands;
+                const size_t yStart = std::min<size_t>((size_t(job) % nbands) * bandRows, size);
+                const size_t yEnd = std::min<size_t>(yStart + bandRows, size);
+
+                HRESULT hrJob = EvaluateIrradianceRows(sh, order, face, yStart, yEnd, filter, *destFaces[face]);
+                if (FAILED(hrJob))
+                    fail = true;
+            }
+
+            if (fail)
+            {
+                result.Release();
+                return E_FAIL;
+            }
+#endif
+        }
+        else
+        {
+            for (size_t face = 0; face < 6; ++face)
+            {
+                hr = EvaluateIrradianceRows(sh, order, face, 0, size, filter, *destFaces[face]);
+                if (FAILED(hr))
+                {
+                    result.Release();
+                    return hr;
+                }
+            }
+        }
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Split-sum environment BRDF lookup table
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::GenerateBRDFLookupTable(
+    size_t width,
+    size_t height,
+    size_t sampleCount,
+    DWORD flags,
+    DXGI_FORMAT format,
+    const wchar_t* cacheDirectory,
+    ScratchImage& result)
+{
+    if (!width || !height || !sampleCount || sampleCount > UINT32_MAX)
+        return E_INVALIDARG;
+
+    if (format != DXGI_FORMAT_R16G16_FLOAT && format != DXGI_FORMAT_R32G32_FLOAT)
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+#ifndef _OPENMP
+    if (flags & BRDF_LUT_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    const bool smith = (flags & BRDF_LUT_SMITH) != 0;
+
+    // The cache file name is the key: model, size, sample count, and format
+    wchar_t cacheFile[MAX_PATH] = {};
+    if (cacheDirectory && *cacheDirectory)
+    {
+        const size_t len = wcslen(cacheDirectory);
+        const bool slash = (cacheDirectory[len - 1] == L'\\' || cacheDirectory[len - 1] == L'/');
+
+        // swprintf_s would invoke the invalid parameter handler on overflow, so truncate and treat that as the error
+        if (_snwprintf_s(cacheFile, MAX_PATH, _TRUNCATE, L"%ls%lsbrdf_%ls_%zux%zu_%zu_%d.dds", cacheDirectory, slash ? L"" : L"\\",
+            smith ? L"smith" : L"schlick", width, height, sampleCount, static_cast<int>(format)) < 0)
+            return HRESULT_FROM_WIN32(ERROR_FILENAME_EXCED_RANGE);
+
+        TexMetadata mdata;
+        ScratchImage cached;
+        if (SUCCEEDED(LoadFromDDSFile(cacheFile, DDS_FLAGS_NONE, &mdata, cached))
+            && IsMatchingBRDFTable(mdata, width, height, format))
+        {
+            std::swap(result, cached);
+            return S_OK;
+        }
+    }
+
+    HRESULT hr = result.Initialize2D(format, width, height, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    const Image* destImage = result.GetImage(0, 0, 0);
+    if (!destImage)
+    {
+        result.Release();
+        return E_POINTER;
+    }
+
+    if (flags & BRDF_LUT_PARALLEL)
+    {
+#ifdef _OPENMP
+        if (height > INT32_MAX)
+        {
+            result.Release();
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+        }
+
+        bool fail = false;
+
+#pragma omp parallel for
+        for (int y = 0; y < static_cast<int>(height); ++y)
+        {
+            HRESULT hrRow = IntegrateBRDFRows(sampleCount, smith, size_t(y), size_t(y) + 1, *destImage);
+            if (FAILED(hrRow))
+                fail = true;
+        }
+
+        if (fail)
+        {
+            result.Release();
+            return E_FAIL;
+        }
+#endif
+    }
+    else
+    {
+        hr = IntegrateBRDFRows(sampleCount, smith, 0, height, *destImage);
+        if (FAILED(hr))
+        {
+            result.Release();
+            return hr;
+        }
+    }
+
+    if (*cacheFile)
+    {
+        // Written under a temporary name unique to this process and thread and then renamed, so concurrent bakes
+        // never read or write a partial table. Failing to update the cache (including a temporary name that doesn't
+        // fit in MAX_PATH) doesn't fail the call, the table is just computed again next time
+        wchar_t tempFile[MAX_PATH] = {};
+        if (_snwprintf_s(tempFile, MAX_PATH, _TRUNCATE, L"%ls.%lu.%lu.tmp", cacheFile, GetCurrentProcessId(), GetCurrentThreadId()) >= 0)
+        {
+            if (SUCCEEDED(SaveToDDSFile(*destImage, DDS_FLAGS_NONE, tempFile)))
+            {
+                if (!MoveFileExW(tempFile, cacheFile, MOVEFILE_REPLACE_EXISTING))
+                {
+                    (void)DeleteFileW(tempFile);
+                }
+            }
+        }
+    }
+
+    return S_OK;
+}
@@ -716,6 +716,20 @@ bool ScratchImage::OverrideFormat(DXGI_FORMAT f)
     return true;
 }
 
+_Use_decl_annotations_
+bool ScratchImage::OverrideAlphaMode(TEX_ALPHA_MODE mode)
+{
+    if (!m_image)
+        return false;
+
+    if (static_cast<uint32_t>(mode) & ~static_cast<uint32_t>(TEX_MISC2_ALPHA_MODE_MASK))
+        return false;
+
+    m_metadata.SetAlphaMode(mode);
+
+    return true;
+}
+
 _Use_decl_annotations_
 const Image* ScratchImage::GetImage(size_t mip, size_t item, size_t slice) const
 {
@@ -821,3 +835,68 @@ bool ScratchImage::IsAlphaAllOpaque() const
 
     return true;
 }
+
+
+//=====================================================================================
+// MappedImage - Read-only image container over a memory-mapped file
+//=====================================================================================
+
+MappedImage& MappedImage::operator= (MappedImage&& moveFrom) noexcept
+{
+    if (this != &moveFrom)
+    {
+        Release();
+
+        m_nimages = moveFrom.m_nimages;
+        m_size = moveFrom.m_size;
+        m_metadata = moveFrom.m_metadata;
+        m_image = moveFrom.m_image;
+        m_view = moveFrom.m_view;
+        m_pixels = moveFrom.m_pixels;
+
+        moveFrom.m_nimages = 0;
+        moveFrom.m_size = 0;
+        moveFrom.m_image = nullptr;
+        moveFrom.m_view = nullptr;
+        moveFrom.m_pixels = nullptr;
+    }
+    return *this;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Methods
+//-------------------------------------------------------------------------------------
+void MappedImage::Release()
+{
+    m_nimages = 0;
+    m_size = 0;
+    m_pixels = nullptr;
+
+    if (m_image)
+    {
+        delete[] m_image;
+        m_image = nullptr;
+    }
+
+    if (m_view)
+    {
+        UnmapViewOfFile(m_view);
+        m_view = nullptr;
+    }
+
+    memset(&m_metadata, 0, sizeof(m_metadata));
+}
+
+_Use_decl_annotations_
+const Image* MappedImage::GetImage(size_t mip, size_t item, size_t slice) const
+{
+    if (!m_image)
+        return nullptr;
+
+    size_t index = m_metadata.ComputeIndex(mip, item, slice);
+    if (index >= m_nimages)
+        return nullptr;
+
+    return &m_image[index];
+}
@@ -13,6 +13,11 @@
 
 #include "filters.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#pragma warning(disable : 4616 6993)
+#endif
+
 using namespace DirectX;
 using Microsoft::WRL::ComPtr;
 
@@ -116,6 +121,113 @@ namespace
 
         return hr;
     }
+
+
+    //--- Native Fant resize of output rows [yStart, yEnd) ---
+    HRESULT ResizeRowsUsingNativeFant(
+        _In_ const Image& srcImage,
+        _In_ const SeparableFilter& sfX,
+        _In_ const SeparableFilter& sfY,
+        bool weighted,
+        _In_ const Image& destImage,
+        size_t yStart,
+        size_t yEnd)
+    {
+        // Source rows of an area filter are consecutive and increasing, so horizontally filtered rows
+        // are kept in a ring indexed by source row
+        const size_t slots = sfY.taps;
+
+        // Allocate temporary space (1 source scanline, 1 target scanline, and the cached rows)
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(
+            (sizeof(XMVECTOR) * (srcImage.width + destImage.width * (slots + 1))), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        std::unique_ptr<size_t[]> tags(new (std::nothrow) size_t[slots]);
+        if (!tags)
+            return E_OUTOFMEMORY;
+
+        for (size_t j = 0; j < slots; ++j)
+        {
+            tags[j] = size_t(-1);
+        }
+
+        XMVECTOR* target = scanline.get();
+        XMVECTOR* row = target + destImage.width;
+        XMVECTOR* cacheRows = row + srcImage.width;
+
+        uint8_t* pDest = destImage.pixels + destImage.rowPitch * yStart;
+
+        for (size_t y = yStart; y < yEnd; ++y)
+        {
+            const size_t count = sfY.count[y];
+            const size_t* yIndex = &sfY.index[y * sfY.taps];
+            const float* yWeight = &sfY.weight[y * sfY.taps];
+
+            memset(target, 0, sizeof(XMVECTOR) * destImage.width);
+
+            for (size_t k = 0; k < count; ++k)
+            {
+                const size_t sy = yIndex[k];
+                XMVECTOR* hrow = cacheRows + destImage.width * (sy % slots);
+
+                if (tags[sy % slots] != sy)
+                {
+                    if (!_LoadScanline(row, srcImage.width, srcImage.pixels + srcImage.rowPitch * sy, srcImage.rowPitch, srcImage.format))
+                        return E_FAIL;
+
+                    if (weighted)
+                    {
+                        for (size_t x = 0; x < srcImage.width; ++x)
+                        {
+                            XMVECTOR v = row[x];
+                            row[x] = XMVectorSelect(v, XMVectorMultiply(v, XMVectorSplatW(v)), g_XMSelect1110);
+                        }
+                    }
+
+                    for (size_t x = 0; x < destImage.width; ++x)
+                    {
+                        const size_t* xIndex = &sfX.index[x * sfX.taps];
+                        const float* xWeight = &sfX.weight[x * sfX.taps];
+
+                        XMVECTOR v = XMVectorScale(row[xIndex[0]], xWeight[0]);
+                        for (size_t t = 1; t < sfX.count[x]; ++t)
+                        {
+                            v = XMVectorMultiplyAdd(row[xIndex[t]], XMVectorReplicate(xWeight[t]), v);
+                        }
+                        hrow[x] = v;
+                    }
+
+                    tags[sy % slots] = sy;
+                }
+
+                XMVECTOR w = XMVectorReplicate(yWeight[k]);
+                for (size_t x = 0; x < destImage.width; ++x)
+                {
+                    target[x] = XMVectorMultiplyAdd(hrow[x], w, target[x]);
+                }
+            }
+
+            if (weighted)
+            {
+                for (size_t x = 0; x < destImage.width; ++x)
+                {
+                    // Fully transparent results have no color
+                    XMVECTOR v = target[x];
+                    XMVECTOR alpha = XMVectorSplatW(v);
+                    XMVECTOR color = XMVectorSelect(g_XMZero, XMVectorDivide(v, alpha), XMVectorGreater(alpha, g_XMZero));
+                    target[x] = XMVectorSelect(v, color, g_XMSelect1110);
+                }
+            }
+
+            if (!_StoreScanline(pDest, destImage.rowPitch, destImage.format, target, destImage.width))
+                return E_FAIL;
+
+            pDest += destImage.rowPitch;
+        }
+
+        return S_OK;
+    }
 }
 
 
@@ -374,6 +486,86 @@ namespace DirectX
 
         return hr;
     }
+
+    //--- Determine when the WIC Fant scaler is replaced by the native implementation ---
+    // This is opt-in (TEX_FILTER_NATIVE_FANT) as the native results are not verified to match WIC's
+    bool _UseNativeFant(_In_ DWORD filter)
+    {
+        if (!(filter & TEX_FILTER_NATIVE_FANT) || (filter & TEX_FILTER_FORCE_WIC))
+            return false;
+
+        static_assert(TEX_FILTER_FANT == TEX_FILTER_BOX, "TEX_FILTER_ flag alias mismatch");
+
+        switch (filter & TEX_FILTER_MASK)
+        {
+        case 0:
+        case TEX_FILTER_FANT:
+            // _GetWICInterp uses Fant for both
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    //--- Resizing using area-averaging (same semantics as the WIC Fant scaler, without WIC) ---
+    // Values are filtered as stored (no sRGB conversion), and unless TEX_FILTER_SEPARATE_ALPHA is
+    // given, color channels are weighted by alpha as the WIC scaler does for formats with transparency.
+    // TEX_FILTER_PARALLEL splits the output rows into bands.
+    HRESULT _ResizeUsingNativeFant(
+        _In_ const Image& srcImage,
+        _In_ DWORD filter,
+        _In_ const Image& destImage)
+    {
+        if (!srcImage.pixels || !destImage.pixels)
+            return E_POINTER;
+
+        assert(srcImage.format == destImage.format);
+
+        std::shared_ptr<const SeparableFilter> sfX;
+        HRESULT hr = _GetCachedSeparableFilter(srcImage.width, destImage.width, TEX_FILTER_FANT, false, false, sfX);
+        if (FAILED(hr))
+            return hr;
+
+        std::shared_ptr<const SeparableFilter> sfY;
+        hr = _GetCachedSeparableFilter(srcImage.height, destImage.height, TEX_FILTER_FANT, false, false, sfY);
+        if (FAILED(hr))
+            return hr;
+
+        const bool weighted = HasAlpha(srcImage.format) && !(filter & TEX_FILTER_SEPARATE_ALPHA);
+
+        if (!(filter & TEX_FILTER_PARALLEL))
+            return ResizeRowsUsingNativeFant(srcImage, *sfX, *sfY, weighted, destImage, 0, destImage.height);
+
+#ifndef _OPENMP
+        return E_NOTIMPL;
+#else
+        // Output rows are split into bands which each keep their own row cache. Rows are computed exactly as in the
+        // serial path, so the results are bit-identical; only source rows at band edges are filtered twice.
+        static const size_t c_MinBandRows = 16;
+
+        const size_t nthreads = static_cast<size_t>(std::max<int>(1, omp_get_max_threads()));
+        const size_t bandRows = std::max<size_t>(c_MinBandRows, (destImage.height + nthreads * 4 - 1) / (nthreads * 4));
+        const size_t nbands = (destImage.height + bandRows - 1) / bandRows;
+
+        if (nbands > INT32_MAX)
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+        bool fail = false;
+
+#pragma omp parallel for
+        for (int band = 0; band < static_cast<int>(nbands); ++band)
+        {
+            const size_t yStart = size_t(band) * bandRows;
+            const size_t yEnd = std::min<size_t>(yStart + bandRows, destImage.height);
+
+            if (FAILED(ResizeRowsUsingNativeFant(srcImage, *sfX, *sfY, weighted, destImage, yStart, yEnd)))
+                fail = true;
+        }
+
+        return (fail) ? E_FAIL : S_OK;
+#endif
+    }
 }
 
 namespace
@@ -591,6 +783,55 @@ namespace
     }
 
 
+    //--- mipmap (1D/2D) generation using the native Fant scaler ---
+    HRESULT GenerateMipMapsUsingNativeFant(
+        _In_ const Image& baseImage,
+        _In_ DWORD filter,
+        _In_ size_t levels,
+        _In_ const ScratchImage& mipChain,
+        _In_ size_t item)
+    {
+        assert(levels > 1);
+
+        if (!baseImage.pixels || !mipChain.GetPixels())
+            return E_POINTER;
+
+        // Copy base image to top miplevel
+        const Image *img0 = mipChain.GetImage(0, item, 0);
+        if (!img0)
+            return E_POINTER;
+
+        uint8_t* pDest = img0->pixels;
+        if (!pDest)
+            return E_POINTER;
+
+        const uint8_t *pSrc = baseImage.pixels;
+        for (size_t h = 0; h < baseImage.height; ++h)
+        {
+            size_t msize = std::min<size_t>(img0->rowPitch, baseImage.rowPitch);
+            memcpy_s(pDest, img0->rowPitch, pSrc, msize);
+            pSrc += baseImage.rowPitch;
+            pDest += img0->rowPitch;
+        }
+
+        // Like the WIC path, each miplevel is resized from the base image
+        for (size_t level = 1; level < levels; ++level)
+        {
+            const Image *img = mipChain.GetImage(level, item, 0);
+            if (!img)
+                return E_POINTER;
+
+            assert(img->format == baseImage.format);
+
+            HRESULT hr = _ResizeUsingNativeFant(baseImage, filter, *img);
+            if (FAILED(hr))
+                return hr;
+        }
+
+        return S_OK;
+    }
+
+
     //-------------------------------------------------------------------------------------
     // Generate (1D/2D) mip-map helpers (custom filtering)
     //-------------------------------------------------------------------------------------
@@ -650,17 +891,17 @@ namespace
     }
 
     //--- 2D Point Filter ---
-    HRESULT Generate2DMipsPointFilter(size_t levels, const ScratchImage& mipChain, size_t item)
+    HRESULT Generate2DMipsPointFilter(size_t levels, _In_reads_(levels) const Image* mips)
     {
-        if (!mipChain.GetImages())
+        if (!mips)
             return E_INVALIDARG;
 
         // This assumes that the base image is already placed into the mipChain at the top level... (see _Setup2DMips)
 
         assert(levels > 1);
 
-        size_t width = mipChain.GetMetadata().width;
-        size_t height = mipChain.GetMetadata().height;
+        size_t width = mips[0].width;
+        size_t height = mips[0].height;
 
         // Allocate temporary space (2 scanlines)
         ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*width * 2), 16)));
@@ -679,11 +920,8 @@ namespace
 #endif
 
             // 2D point filter
-            const Image* src = mipChain.GetImage(level - 1, item, 0);
-            const Image* dest = mipChain.GetImage(level, item, 0);
-
-            if (!src || !dest)
-                return E_POINTER;
+            const Image* src = &mips[level - 1];
+            const Image* dest = &mips[level];
 
             const uint8_t* pSrc = src->pixels;
             uint8_t* pDest = dest->pixels;
@@ -734,76 +972,117 @@ namespace
 
 
     //--- 2D Box Filter ---
-    HRESULT Generate2DMipsBoxFilter(size_t levels, DWORD filter, const ScratchImage& mipChain, size_t item)
+    // All levels are produced by a single top-down pass over the base image. Each new row of a level is paired with
+    // the pending row above it to emit a row of the next level right away, so intermediate rows are consumed while
+    // still in cache instead of re-reading every level from memory. Emitted rows are reloaded from the mip chain
+    // before feeding the next level, so results match building each level from the stored previous one.
+    //
+    // This processes rows [yStart, yEnd) of firstLevel into levels firstLevel + 1 ... lastLevel. When yStart and yEnd
+    // are multiples of 2^(lastLevel - firstLevel), the rows written depend on no other rows of firstLevel.
+    HRESULT Generate2DMipsBoxFilterRows(
+        size_t firstLevel,
+        size_t lastLevel,
+        size_t yStart,
+        size_t yEnd,
+        DWORD filter,
+        _In_reads_(lastLevel + 1) const Image* mips)
     {
-        if (!mipChain.GetImages())
+        if (!mips)
             return E_INVALIDARG;
 
-        // This assumes that the base image is already placed into the mipChain at the top level... (see _Setup2DMips)
+        assert(firstLevel < lastLevel);
 
-        assert(levels > 1);
+        const Image* base = &mips[firstLevel];
 
-        size_t width = mipChain.GetMetadata().width;
-        size_t height = mipChain.GetMetadata().height;
+        const size_t width = base->width;
+        const size_t height = base->height;
 
-        if (!ispow2(width) || !ispow2(height))
+        if (!ispow2(width) || !ispow2(height) || yStart >= yEnd || yEnd > height)
             return E_FAIL;
 
-        // Allocate temporary space (3 scanlines)
-        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*width * 3), 16)));
-        if (!scanline)
-            return E_OUTOFMEMORY;
-
-        XMVECTOR* target = scanline.get();
+        const size_t levels = lastLevel - firstLevel + 1;
 
-        XMVECTOR* urow0 = target + width;
-        XMVECTOR* urow1 = target + width * 2;
+        std::unique_ptr<size_t[]> levelInfo(new (std::nothrow) size_t[levels * 3]);
+        if (!levelInfo)
+            return E_OUTOFMEMORY;
 
-        const XMVECTOR* urow2 = urow0 + 1;
-        const XMVECTOR* urow3 = urow1 + 1;
+        size_t* levelWidth = levelInfo.get();
+        size_t* levelRows = levelWidth + levels;
+        size_t* pending = levelRows + levels;
 
-        // Resize base image to each target mip level
-        for (size_t level = 1; level < levels; ++level)
+        size_t scanlineCount = 0;
         {
-            if (height <= 1)
+            size_t w = width;
+            for (size_t level = 0; level < levels; ++level)
             {
-                urow1 = urow0;
-            }
+                levelWidth[level] = w;
+                levelRows[level] = yStart >> level;
+                pending[level] = 0;
+                scanlineCount += w * 2;
 
-            if (width <= 1)
-            {
-                urow2 = urow0;
-                urow3 = urow1;
+                if (w > 1)
+                    w >>= 1;
             }
+        }
 
-            // 2D box filter
-            const Image* src = mipChain.GetImage(level - 1, item, 0);
-            const Image* dest = mipChain.GetImage(level, item, 0);
+        // Allocate temporary space (current and pending row for each level, plus 1 target scanline)
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * (scanlineCount + width), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
 
-            if (!src || !dest)
-                return E_POINTER;
+        std::unique_ptr<XMVECTOR*[]> rowPtrs(new (std::nothrow) XMVECTOR*[levels * 2]);
+        if (!rowPtrs)
+            return E_OUTOFMEMORY;
 
-            const uint8_t* pSrc = src->pixels;
-            uint8_t* pDest = dest->pixels;
+        XMVECTOR** current = rowPtrs.get();
+        XMVECTOR** above = current + levels;
 
-            size_t rowPitch = src->rowPitch;
+        XMVECTOR* target = scanline.get();
+        {
+            XMVECTOR* ptr = target + width;
+            for (size_t level = 0; level < levels; ++level)
+            {
+                current[level] = ptr;
+                above[level] = ptr + levelWidth[level];
+                ptr += levelWidth[level] * 2;
+            }
+        }
 
-            size_t nwidth = (width > 1) ? (width >> 1) : 1;
-            size_t nheight = (height > 1) ? (height >> 1) : 1;
+        const uint8_t* pSrc = base->pixels + base->rowPitch * yStart;
 
-            for (size_t y = 0; y < nheight; ++y)
+        for (size_t y = yStart; y < yEnd; ++y)
+        {
+            if (!_LoadScanlineLinear(current[0], width, pSrc, base->rowPitch, base->format, filter))
+                return E_FAIL;
+            pSrc += base->rowPitch;
+
+            // Cascade the new row down the chain as far as it completes a pair of rows
+            for (size_t level = 0; level + 1 < levels; ++level)
             {
-                if (!_LoadScanlineLinear(urow0, width, pSrc, rowPitch, src->format, filter))
-                    return E_FAIL;
-                pSrc += rowPitch;
+                const size_t lheight = std::max<size_t>(height >> level, 1);
 
-                if (urow0 != urow1)
+                const XMVECTOR* urow0 = current[level];
+                const XMVECTOR* urow1 = current[level];
+
+                if (lheight > 1)
                 {
-                    if (!_LoadScanlineLinear(urow1, width, pSrc, rowPitch, src->format, filter))
-                        return E_FAIL;
-                    pSrc += rowPitch;
+                    if (!pending[level])
+                    {
+                        std::swap(current[level], above[level]);
+                        pending[level] = 1;
+                        break;
+                    }
+
+                    urow0 = above[level];
+                    pending[level] = 0;
                 }
 
+                const size_t lwidth = levelWidth[level];
+                const size_t nwidth = levelWidth[level + 1];
+
+                const XMVECTOR* urow2 = (lwidth > 1) ? urow0 + 1 : urow0;
+                const XMVECTOR* urow3 = (lwidth > 1) ? urow1 + 1 : urow1;
+
                 for (size_t x = 0; x < nwidth; ++x)
                 {
                     size_t x2 = x << 1;
@@ -811,34 +1090,50 @@ namespace
                     AVERAGE4(target[x], urow0[x2], urow1[x2], urow2[x2], urow3[x2]);
                 }
 
+                const Image* dest = &mips[firstLevel + level + 1];
+
+                const size_t v = levelRows[level + 1]++;
+                if (v >= dest->height)
+                    return E_UNEXPECTED;
+
+                uint8_t* pDest = dest->pixels + dest->rowPitch * v;
+
                 if (!_StoreScanlineLinear(pDest, dest->rowPitch, dest->format, target, nwidth, filter))
                     return E_FAIL;
-                pDest += dest->rowPitch;
-            }
 
-            if (height > 1)
-                height >>= 1;
-
-            if (width > 1)
-                width >>= 1;
+                if (level + 2 < levels)
+                {
+                    if (!_LoadScanlineLinear(current[level + 1], nwidth, pDest, dest->rowPitch, dest->format, filter))
+                        return E_FAIL;
+                }
+            }
         }
 
         return S_OK;
     }
 
+    HRESULT Generate2DMipsBoxFilter(size_t levels, DWORD filter, _In_reads_(levels) const Image* mips)
+    {
+        // This assumes that the base image is already placed into the mipChain at the top level... (see _Setup2DMips)
+
+        assert(levels > 1);
+
+        return Generate2DMipsBoxFilterRows(0, levels - 1, 0, mips[0].height, filter, mips);
+    }
+
 
     //--- 2D Linear Filter ---
-    HRESULT Generate2DMipsLinearFilter(size_t levels, DWORD filter, const ScratchImage& mipChain, size_t item)
+    HRESULT Generate2DMipsLinearFilter(size_t levels, DWORD filter, _In_reads_(levels) const Image* mips)
     {
-        if (!mipChain.GetImages())
+        if (!mips)
             return E_INVALIDARG;
 
         // This assumes that the base image is already placed into the mipChain at the top level... (see _Setup2DMips)
 
         assert(levels > 1);
 
-        size_t width = mipChain.GetMetadata().width;
-        size_t height = mipChain.GetMetadata().height;
+        size_t width = mips[0].width;
+        size_t height = mips[0].height;
 
         // Allocate temporary space (3 scanlines, plus X and Y filters)
         ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*width * 3), 16)));
@@ -861,11 +1156,8 @@ namespace
         for (size_t level = 1; level < levels; ++level)
         {
             // 2D linear filter
-            const Image* src = mipChain.GetImage(level - 1, item, 0);
-            const Image* dest = mipChain.GetImage(level, item, 0);
-
-            if (!src || !dest)
-                return E_POINTER;
+            const Image* src = &mips[level - 1];
+            const Image* dest = &mips[level];
 
             const uint8_t* pSrc = src->pixels;
             uint8_t* pDest = dest->pixels;
@@ -939,17 +1231,17 @@ namespace
     }
 
     //--- 2D Cubic Filter ---
-    HRESULT Generate2DMipsCubicFilter(size_t levels, DWORD filter, const ScratchImage& mipChain, size_t item)
+    HRESULT Generate2DMipsCubicFilter(size_t levels, DWORD filter, _In_reads_(levels) const Image* mips)
     {
-        if (!mipChain.GetImages())
+        if (!mips)
             return E_INVALIDARG;
 
         // This assumes that the base image is already placed into the mipChain at the top level... (see _Setup2DMips)
 
         assert(levels > 1);
 
-        size_t width = mipChain.GetMetadata().width;
-        size_t height = mipChain.GetMetadata().height;
+        size_t width = mips[0].width;
+        size_t height = mips[0].height;
 
         // Allocate temporary space (5 scanlines, plus X and Y filters)
         ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*width * 5), 16)));
@@ -974,11 +1266,8 @@ namespace
         for (size_t level = 1; level < levels; ++level)
         {
             // 2D cubic filter
-            const Image* src = mipChain.GetImage(level - 1, item, 0);
-            const Image* dest = mipChain.GetImage(level, item, 0);
-
-            if (!src || !dest)
-                return E_POINTER;
+            const Image* src = &mips[level - 1];
+            const Image* dest = &mips[level];
 
             const uint8_t* pSrc = src->pixels;
             uint8_t* pDest = dest->pixels;
@@ -1125,9 +1414,9 @@ namespace
 
 
     //--- 2D Triangle Filter ---
-    HRESULT Generate2DMipsTriangleFilter(size_t levels, DWORD filter, const ScratchImage& mipChain, size_t item)
+    HRESULT Generate2DMipsTriangleFilter(size_t levels, DWORD filter, _In_reads_(levels) const Image* mips)
     {
-        if (!mipChain.GetImages())
+        if (!mips)
             return E_INVALIDARG;
 
         using namespace TriangleFilter;
@@ -1136,8 +1425,8 @@ namespace
 
         assert(levels > 1);
 
-        size_t width = mipChain.GetMetadata().width;
-        size_t height = mipChain.GetMetadata().height;
+        size_t width = mips[0].width;
+        size_t height = mips[0].height;
 
         // Allocate initial temporary space (1 scanline, accumulation rows, plus X and Y filters)
         ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * width, 16)));
@@ -1150,7 +1439,7 @@ namespace
 
         TriangleRow * rowFree = nullptr;
 
-        std::unique_ptr<Filter> tfX, tfY;
+        std::shared_ptr<const Filter> tfX, tfY;
 
         XMVECTOR* row = scanline.get();
 
@@ -1158,11 +1447,8 @@ namespace
         for (size_t level = 1; level < levels; ++level)
         {
             // 2D triangle filter
-            const Image* src = mipChain.GetImage(level - 1, item, 0);
-            const Image* dest = mipChain.GetImage(level, item, 0);
-
-            if (!src || !dest)
-                return E_POINTER;
+            const Image* src = &mips[level - 1];
+            const Image* dest = &mips[level];
 
             const uint8_t* pSrc = src->pixels;
             size_t rowPitch = src->rowPitch;
@@ -1171,12 +1457,12 @@ namespace
             uint8_t* pDest = dest->pixels;
 
             size_t nwidth = (width > 1) ? (width >> 1) : 1;
-            HRESULT hr = _Create(width, nwidth, (filter & TEX_FILTER_WRAP_U) != 0, tfX);
+            HRESULT hr = _GetCachedTriangleFilter(width, nwidth, (filter & TEX_FILTER_WRAP_U) != 0, tfX);
             if (FAILED(hr))
                 return hr;
 
             size_t nheight = (height > 1) ? (height >> 1) : 1;
-            hr = _Create(height, nheight, (filter & TEX_FILTER_WRAP_V) != 0, tfY);
+            hr = _GetCachedTriangleFilter(height, nheight, (filter & TEX_FILTER_WRAP_V) != 0, tfY);
             if (FAILED(hr))
                 return hr;
 
@@ -1188,7 +1474,7 @@ namespace
             auto yFromEnd = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(tfY.get()) + tfY->sizeInBytes);
 
             // Count times rows get written (and clear out any leftover accumulation rows from last miplevel)
-            for (FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
+            for (const FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
             {
                 for (size_t j = 0; j < yFrom->count; ++j)
                 {
@@ -1204,11 +1490,11 @@ namespace
                     }
                 }
 
-                yFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(yFrom) + yFrom->sizeInBytes);
+                yFrom = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(yFrom) + yFrom->sizeInBytes);
             }
 
             // Filter image
-            for (FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
+            for (const FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
             {
                 // Create accumulation rows as needed
                 for (size_t j = 0; j < yFrom->count; ++j)
@@ -1249,7 +1535,7 @@ namespace
 
                 // Process row
                 size_t x = 0;
-                for (FilterFrom* xFrom = tfX->from; xFrom < xFromEnd; ++x)
+                for (const FilterFrom* xFrom = tfX->from; xFrom < xFromEnd; ++x)
                 {
                     for (size_t j = 0; j < yFrom->count; ++j)
                     {
@@ -1273,7 +1559,7 @@ namespace
                         }
                     }
 
-                    xFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(xFrom) + xFrom->sizeInBytes);
+                    xFrom = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(xFrom) + xFrom->sizeInBytes);
                 }
 
                 // Write completed accumulation rows
@@ -1323,7 +1609,7 @@ namespace
                     }
                 }
 
-                yFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(yFrom) + yFrom->sizeInBytes);
+                yFrom = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(yFrom) + yFrom->sizeInBytes);
             }
 
             if (height > 1)
@@ -1394,34 +1680,431 @@ namespace
     }
 
 
-    //--- 3D Point Filter ---
-    HRESULT Generate3DMipsPointFilter(size_t depth, size_t levels, const ScratchImage& mipChain)
+    //--- 2D mip generation for every item ---
+    // The levels of one item (or standalone images of consecutive levels) are passed as an array
+    HRESULT Generate2DMipsItem(DWORD filter_select, size_t levels, DWORD filter, _In_reads_(levels) const Image* mips)
     {
-        if (!depth || !mipChain.GetImages())
-            return E_INVALIDARG;
+        if (!mips)
+            return E_POINTER;
 
-        // This assumes that the base images are already placed into the mipChain at the top level... (see _Setup3DMips)
+        switch (filter_select)
+        {
+        case TEX_FILTER_BOX:
+            return Generate2DMipsBoxFilter(levels, filter, mips);
 
-        assert(levels > 1);
+        case TEX_FILTER_POINT:
+            return Generate2DMipsPointFilter(levels, mips);
 
-        size_t width = mipChain.GetMetadata().width;
-        size_t height = mipChain.GetMetadata().height;
+        case TEX_FILTER_LINEAR:
+            return Generate2DMipsLinearFilter(levels, filter, mips);
 
-        // Allocate temporary space (2 scanlines)
-        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*width * 2), 16)));
-        if (!scanline)
-            return E_OUTOFMEMORY;
+        case TEX_FILTER_CUBIC:
+            return Generate2DMipsCubicFilter(levels, filter, mips);
 
-        XMVECTOR* target = scanline.get();
+        case TEX_FILTER_TRIANGLE:
+            return Generate2DMipsTriangleFilter(levels, filter, mips);
 
-        XMVECTOR* row = target + width;
+        default:
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+        }
+    }
 
-        // Resize base image to each target mip level
-        for (size_t level = 1; level < levels; ++level)
-        {
-#ifdef _DEBUG
-            memset(row, 0xCD, sizeof(XMVECTOR)*width);
-#endif
+#ifdef _OPENMP
+    HRESULT Generate2DMipsBoxFilterParallel(size_t levels, DWORD filter, const ScratchImage& mipChain)
+    {
+        const TexMetadata& metadata = mipChain.GetMetadata();
+
+        if (!ispow2(metadata.width) || !ispow2(metadata.height))
+            return E_FAIL;
+
+        // Blocks of 2^bandShift base rows produce whole rows of the first bandShift levels independently of each other,
+        // so those levels are built from row bands in parallel and the remaining small levels per item afterwards
+        static const size_t c_MaxBandShift = 6;
+
+        size_t bandShift = 0;
+        while (bandShift < c_MaxBandShift && (bandShift + 1) < levels && (size_t(2) << bandShift) <= metadata.height)
+            ++bandShift;
+
+        const size_t bandRows = size_t(1) << bandShift;
+        const size_t nbands = metadata.height >> bandShift;
+        const size_t items = metadata.arraySize;
+
+        if ((items * nbands) > INT32_MAX)
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+        bool fail = false;
+
+        if (bandShift > 0)
+        {
+#pragma omp parallel for
+            for (int job = 0; job < static_cast<int>(items * nbands); ++job)
+            {
+                const size_t item = size_t(job) / nbands;
+                const size_t yStart = (size_t(job) % nbands) * bandRows;
+
+                HRESULT hr = Generate2DMipsBoxFilterRows(0, bandShift, yStart, yStart + bandRows, filter, mipChain.GetImage(0, item, 0));
+                if (FAILED(hr))
+                    fail = true;
+            }
+
+            if (fail)
+                return E_FAIL;
+        }
+
+        if ((bandShift + 1) < levels)
+        {
+            const size_t height = metadata.height >> bandShift;
+
+#pragma omp parallel for
+            for (int item = 0; item < static_cast<int>(items); ++item)
+            {
+                HRESULT hr = Generate2DMipsBoxFilterRows(bandShift, levels - 1, 0, height, filter, mipChain.GetImage(0, size_t(item), 0));
+                if (FAILED(hr))
+                    fail = true;
+            }
+        }
+
+        return (fail) ? E_FAIL : S_OK;
+    }
+#endif // _OPENMP
+
+    // With TEX_FILTER_PARALLEL items are generated concurrently, and box filtering also splits each item into row
+    // bands. Every output row is computed exactly as in the serial path, so the results are bit-identical.
+    HRESULT Generate2DMipsAllItems(DWORD filter_select, size_t levels, DWORD filter, const ScratchImage& mipChain)
+    {
+        const size_t items = mipChain.GetMetadata().arraySize;
+
+        if (!(filter & TEX_FILTER_PARALLEL))
+        {
+            for (size_t item = 0; item < items; ++item)
+            {
+                HRESULT hr = Generate2DMipsItem(filter_select, levels, filter, mipChain.GetImage(0, item, 0));
+                if (FAILED(hr))
+                    return hr;
+            }
+
+            return S_OK;
+        }
+
+#ifndef _OPENMP
+        return E_NOTIMPL;
+#else
+        if (filter_select == TEX_FILTER_BOX)
+            return Generate2DMipsBoxFilterParallel(levels, filter, mipChain);
+
+        if (items > INT32_MAX)
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+        bool fail = false;
+
+#pragma omp parallel for
+        for (int item = 0; item < static_cast<int>(items); ++item)
+        {
+            HRESULT hr = Generate2DMipsItem(filter_select, levels, filter, mipChain.GetImage(0, size_t(item), 0));
+            if (FAILED(hr))
+                fail = true;
+        }
+
+        return (fail) ? E_FAIL : S_OK;
+#endif
+    }
+
+
+    //--- Alpha coverage ---
+    const size_t c_AlphaHistogramBins = 4096;
+
+    // Builds a histogram of alpha values in [0, 1] (one pass over the image)
+    HRESULT ComputeAlphaHistogram(const Image& image, _Out_writes_(c_AlphaHistogramBins) size_t* histogram)
+    {
+        memset(histogram, 0, sizeof(size_t) * c_AlphaHistogramBins);
+
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*image.width), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        const uint8_t* pSrc = image.pixels;
+        for (size_t y = 0; y < image.height; ++y, pSrc += image.rowPitch)
+        {
+            if (!_LoadScanline(scanline.get(), image.width, pSrc, image.rowPitch, image.format))
+                return E_FAIL;
+
+            const XMVECTOR* ptr = scanline.get();
+            for (size_t x = 0; x < image.width; ++x, ++ptr)
+            {
+                const float alpha = std::min(std::max(XMVectorGetW(*ptr), 0.f), 1.f);
+                const size_t bin = std::min<size_t>(static_cast<size_t>(alpha * float(c_AlphaHistogramBins)), c_AlphaHistogramBins - 1);
+                ++histogram[bin];
+            }
+        }
+
+        return S_OK;
+    }
+
+    // Fraction of texels of the histogram with alpha above the threshold (interpolating within the threshold's bin)
+    float AlphaCoverage(_In_reads_(c_AlphaHistogramBins) const size_t* histogram, size_t total, float threshold)
+    {
+        if (!total)
+            return 0.f;
+
+        const float pos = std::min(std::max(threshold, 0.f), 1.f) * float(c_AlphaHistogramBins);
+        const size_t bin = std::min<size_t>(static_cast<size_t>(pos), c_AlphaHistogramBins - 1);
+
+        float count = float(histogram[bin]) * (float(bin + 1) - pos);
+        for (size_t j = bin + 1; j < c_AlphaHistogramBins; ++j)
+        {
+            count += float(histogram[j]);
+        }
+
+        return count / float(total);
+    }
+
+    // Finds the scale for which the fraction of texels with (alpha * scale) > alphaReference equals the coverage,
+    // by walking the histogram down from the top until enough texels are above the threshold alphaReference / scale
+    float AlphaCoverageScale(_In_reads_(c_AlphaHistogramBins) const size_t* histogram, size_t total, float coverage, float alphaReference)
+    {
+        static const float c_MaxAlphaScale = 4.f;
+
+        if (!total || coverage <= 0.f)
+            return 1.f;
+
+        const float needed = coverage * float(total);
+
+        float count = 0.f;
+        float threshold = 0.f;
+        for (size_t j = c_AlphaHistogramBins; j > 0; --j)
+        {
+            const float binCount = float(histogram[j - 1]);
+            if (binCount > 0.f && (count + binCount) >= needed)
+            {
+                threshold = (float(j) - (needed - count) / binCount) / float(c_AlphaHistogramBins);
+                break;
+            }
+
+            count += binCount;
+        }
+
+        if (threshold <= (alphaReference / c_MaxAlphaScale))
+            return c_MaxAlphaScale;
+
+        return alphaReference / threshold;
+    }
+
+    HRESULT ScaleAlpha(const Image& srcImage, float alphaScale, const Image& destImage)
+    {
+        assert(srcImage.width == destImage.width && srcImage.height == destImage.height);
+
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*srcImage.width), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        const XMVECTOR scale = XMVectorSet(1.f, 1.f, 1.f, alphaScale);
+
+        const uint8_t* pSrc = srcImage.pixels;
+        uint8_t* pDest = destImage.pixels;
+        for (size_t y = 0; y < srcImage.height; ++y, pSrc += srcImage.rowPitch, pDest += destImage.rowPitch)
+        {
+            if (!_LoadScanline(scanline.get(), srcImage.width, pSrc, srcImage.rowPitch, srcImage.format))
+                return E_FAIL;
+
+            XMVECTOR* ptr = scanline.get();
+            for (size_t x = 0; x < srcImage.width; ++x, ++ptr)
+            {
+                XMVECTOR v = XMVectorMultiply(*ptr, scale);
+                *ptr = XMVectorSelect(*ptr, XMVectorSaturate(v), g_XMSelect0001);
+            }
+
+            if (!_StoreScanline(pDest, destImage.rowPitch, destImage.format, scanline.get(), srcImage.width))
+                return E_FAIL;
+        }
+
+        return S_OK;
+    }
+
+
+    //--- Incremental 2D update ---
+    // Range of destination samples whose taps read any of the source samples [first, last]
+    bool AffectedRange(const SeparableFilter& sf, size_t dest, size_t first, size_t last, size_t& outFirst, size_t& outLast)
+    {
+        bool found = false;
+        outFirst = outLast = 0;
+
+        for (size_t u = 0; u < dest; ++u)
+        {
+            const size_t* index = &sf.index[u * sf.taps];
+            for (size_t t = 0; t < sf.count[u]; ++t)
+            {
+                if (index[t] >= first && index[t] <= last)
+                {
+                    if (!found)
+                        outFirst = u;
+                    outLast = u;
+                    found = true;
+                    break;
+                }
+            }
+        }
+
+        return found;
+    }
+
+    // Recomputes destRect of dest from src with the separable filter (matches the separable resize engine)
+    HRESULT UpdateMipLevelRect(
+        const Image& src,
+        const Image& dest,
+        const SeparableFilter& sfX,
+        const SeparableFilter& sfY,
+        const Rect& destRect,
+        DWORD filter,
+        bool point)
+    {
+        // Partial rows can be addressed directly when each pixel is a whole number of bytes
+        const size_t bpp = BitsPerPixel(src.format);
+        const bool partial = (bpp > 0) && !(bpp % 8) && !IsPacked(src.format);
+
+        size_t cmin = 0;
+        size_t cmax = src.width - 1;
+        if (partial)
+        {
+            cmin = src.width;
+            cmax = 0;
+            for (size_t u = destRect.x; u < destRect.x + destRect.w; ++u)
+            {
+                for (size_t t = 0; t < sfX.count[u]; ++t)
+                {
+                    cmin = std::min<size_t>(cmin, sfX.index[u * sfX.taps + t]);
+                    cmax = std::max<size_t>(cmax, sfX.index[u * sfX.taps + t]);
+                }
+            }
+
+            if (cmin > cmax)
+                return E_UNEXPECTED;
+        }
+
+        const size_t span = cmax - cmin + 1;
+        const size_t destCount = (partial) ? destRect.w : dest.width;
+        const size_t destFirst = (partial) ? destRect.x : 0;
+
+        // Allocate temporary space (1 source span, 1 horizontally filtered span, and 1 target row)
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * (span + destRect.w + destCount), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        XMVECTOR* row = scanline.get();
+        XMVECTOR* hrow = row + span;
+        XMVECTOR* target = hrow + destRect.w;
+
+        const size_t bytesPerPixel = bpp / 8;
+
+        for (size_t v = destRect.y; v < destRect.y + destRect.h; ++v)
+        {
+            uint8_t* pDest = dest.pixels + dest.rowPitch * v;
+
+            if (!partial)
+            {
+                // Keep the texels outside of the rectangle
+                if (point)
+                {
+                    if (!_LoadScanline(target, dest.width, pDest, dest.rowPitch, dest.format))
+                        return E_FAIL;
+                }
+                else if (!_LoadScanlineLinear(target, dest.width, pDest, dest.rowPitch, dest.format, filter))
+                    return E_FAIL;
+            }
+
+            XMVECTOR* rect = target + (destRect.x - destFirst);
+
+            const size_t* yIndex = &sfY.index[v * sfY.taps];
+            const float* yWeight = &sfY.weight[v * sfY.taps];
+
+            for (size_t k = 0; k < sfY.count[v]; ++k)
+            {
+                const uint8_t* pSrc = src.pixels + src.rowPitch * yIndex[k];
+                const size_t offset = (partial) ? cmin * bytesPerPixel : 0;
+                const size_t size = (partial) ? span * bytesPerPixel : src.rowPitch;
+
+                if (point)
+                {
+                    if (!_LoadScanline(row, span, pSrc + offset, size, src.format))
+                        return E_FAIL;
+                }
+                else if (!_LoadScanlineLinear(row, span, pSrc + offset, size, src.format, filter))
+                    return E_FAIL;
+
+                for (size_t u = 0; u < destRect.w; ++u)
+                {
+                    const size_t x = destRect.x + u;
+                    const size_t* xIndex = &sfX.index[x * sfX.taps];
+                    const float* xWeight = &sfX.weight[x * sfX.taps];
+
+                    XMVECTOR h = XMVectorScale(row[xIndex[0] - cmin], xWeight[0]);
+                    for (size_t t = 1; t < sfX.count[x]; ++t)
+                    {
+                        h = XMVectorMultiplyAdd(row[xIndex[t] - cmin], XMVectorReplicate(xWeight[t]), h);
+                    }
+                    hrow[u] = h;
+                }
+
+                if (!k)
+                {
+                    for (size_t u = 0; u < destRect.w; ++u)
+                    {
+                        rect[u] = XMVectorScale(hrow[u], yWeight[0]);
+                    }
+                }
+                else
+                {
+                    XMVECTOR w = XMVectorReplicate(yWeight[k]);
+                    for (size_t u = 0; u < destRect.w; ++u)
+                    {
+                        rect[u] = XMVectorMultiplyAdd(hrow[u], w, rect[u]);
+                    }
+                }
+            }
+
+            uint8_t* pOut = pDest + destFirst * bytesPerPixel;
+            const size_t outSize = (partial) ? destCount * bytesPerPixel : dest.rowPitch;
+
+            if (point)
+            {
+                if (!_StoreScanline(pOut, outSize, dest.format, target, destCount))
+                    return E_FAIL;
+            }
+            else if (!_StoreScanlineLinear(pOut, outSize, dest.format, target, destCount, filter))
+                return E_FAIL;
+        }
+
+        return S_OK;
+    }
+
+
+    //--- 3D Point Filter ---
+    HRESULT Generate3DMipsPointFilter(size_t depth, size_t levels, const ScratchImage& mipChain)
+    {
+        if (!depth || !mipChain.GetImages())
+            return E_INVALIDARG;
+
+        // This assumes that the base images are already placed into the mipChain at the top level... (see _Setup3DMips)
+
+        assert(levels > 1);
+
+        size_t width = mipChain.GetMetadata().width;
+        size_t height = mipChain.GetMetadata().height;
+
+        // Allocate temporary space (2 scanlines)
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc((sizeof(XMVECTOR)*width * 2), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        XMVECTOR* target = scanline.get();
+
+        XMVECTOR* row = target + width;
+
+        // Resize base image to each target mip level
+        for (size_t level = 1; level < levels; ++level)
+        {
+#ifdef _DEBUG
+            memset(row, 0xCD, sizeof(XMVECTOR)*width);
+#endif
 
             if (depth > 1)
             {
@@ -2310,7 +2993,7 @@ namespace
 
         TriangleRow * sliceFree = nullptr;
 
-        std::unique_ptr<Filter> tfX, tfY, tfZ;
+        std::shared_ptr<const Filter> tfX, tfY, tfZ;
 
         XMVECTOR* row = scanline.get();
 
@@ -2318,17 +3001,17 @@ namespace
         for (size_t level = 1; level < levels; ++level)
         {
             size_t nwidth = (width > 1) ? (width >> 1) : 1;
-            HRESULT hr = _Create(width, nwidth, (filter & TEX_FILTER_WRAP_U) != 0, tfX);
+            HRESULT hr = _GetCachedTriangleFilter(width, nwidth, (filter & TEX_FILTER_WRAP_U) != 0, tfX);
             if (FAILED(hr))
                 return hr;
 
             size_t nheight = (height > 1) ? (height >> 1) : 1;
-            hr = _Create(height, nheight, (filter & TEX_FILTER_WRAP_V) != 0, tfY);
+            hr = _GetCachedTriangleFilter(height, nheight, (filter & TEX_FILTER_WRAP_V) != 0, tfY);
             if (FAILED(hr))
                 return hr;
 
             size_t ndepth = (depth > 1) ? (depth >> 1) : 1;
-            hr = _Create(depth, ndepth, (filter & TEX_FILTER_WRAP_W) != 0, tfZ);
+            hr = _GetCachedTriangleFilter(depth, ndepth, (filter & TEX_FILTER_WRAP_W) != 0, tfZ);
             if (FAILED(hr))
                 return hr;
 
@@ -2341,7 +3024,7 @@ namespace
             auto zFromEnd = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(tfZ.get()) + tfZ->sizeInBytes);
 
             // Count times slices get written (and clear out any leftover accumulation slices from last miplevel)
-            for (FilterFrom* zFrom = tfZ->from; zFrom < zFromEnd; )
+            for (const FilterFrom* zFrom = tfZ->from; zFrom < zFromEnd; )
             {
                 for (size_t j = 0; j < zFrom->count; ++j)
                 {
@@ -2357,12 +3040,12 @@ namespace
                     }
                 }
 
-                zFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(zFrom) + zFrom->sizeInBytes);
+                zFrom = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(zFrom) + zFrom->sizeInBytes);
             }
 
             // Filter image
             size_t z = 0;
-            for (FilterFrom* zFrom = tfZ->from; zFrom < zFromEnd; ++z)
+            for (const FilterFrom* zFrom = tfZ->from; zFrom < zFromEnd; ++z)
             {
                 // Create accumulation slices as needed
                 for (size_t j = 0; j < zFrom->count; ++j)
@@ -2402,7 +3085,7 @@ namespace
                 size_t rowPitch = src->rowPitch;
                 const uint8_t* pEndSrc = pSrc + rowPitch * height;
 
-                for (FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
+                for (const FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
                 {
                     // Load source scanline
                     if ((pSrc + rowPitch) > pEndSrc)
@@ -2415,7 +3098,7 @@ namespace
 
                     // Process row
                     size_t x = 0;
-                    for (FilterFrom* xFrom = tfX->from; xFrom < xFromEnd; ++x)
+                    for (const FilterFrom* xFrom = tfX->from; xFrom < xFromEnd; ++x)
                     {
                         for (size_t j = 0; j < zFrom->count; ++j)
                         {
@@ -2448,10 +3131,10 @@ namespace
                             }
                         }
 
-                        xFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(xFrom) + xFrom->sizeInBytes);
+                        xFrom = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(xFrom) + xFrom->sizeInBytes);
                     }
 
-                    yFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(yFrom) + yFrom->sizeInBytes);
+                    yFrom = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(yFrom) + yFrom->sizeInBytes);
                 }
 
                 // Write completed accumulation slices
@@ -2510,7 +3193,7 @@ namespace
                     }
                 }
 
-                zFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(zFrom) + zFrom->sizeInBytes);
+                zFrom = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(zFrom) + zFrom->sizeInBytes);
             }
 
             if (height > 1)
@@ -2525,67 +3208,563 @@ namespace
 
         return S_OK;
     }
-}
-
 
-//=====================================================================================
-// Entry-points
-//=====================================================================================
 
-//-------------------------------------------------------------------------------------
-// Generate mipmap chain
-//-------------------------------------------------------------------------------------
-_Use_decl_annotations_
-HRESULT DirectX::GenerateMipMaps(
-    const Image& baseImage,
-    DWORD filter,
-    size_t levels,
-    ScratchImage& mipChain,
-    bool allow1D)
-{
-    if (!IsValid(baseImage.format))
-        return E_INVALIDARG;
+#ifdef _OPENMP
+    //--- 3D Separable Filter (point, box, linear, cubic, and triangle) ---
+    // Each source slice needed by the output slices [zStart, zEnd) is filtered in X (every row loaded once)
+    // and then in Y into a small cache keyed by source slice, so the Z pass only combines cached slices.
+    HRESULT Generate3DMipsSeparableSlices(
+        size_t level,
+        DWORD filter,
+        DWORD filter_select,
+        const SeparableFilter& sfX,
+        const SeparableFilter& sfY,
+        const SeparableFilter& sfZ,
+        const ScratchImage& mipChain,
+        size_t zStart,
+        size_t zEnd)
+    {
+        assert(level > 0);
 
-    if (!baseImage.pixels)
-        return E_POINTER;
+        const Image* src0 = mipChain.GetImage(level - 1, 0, 0);
+        const Image* dest0 = mipChain.GetImage(level, 0, 0);
+        if (!src0 || !dest0)
+            return E_POINTER;
 
-    if (!_CalculateMipLevels(baseImage.width, baseImage.height, levels))
-        return E_INVALIDARG;
+        const size_t width = src0->width;
+        const size_t height = src0->height;
+        const size_t nwidth = dest0->width;
+        const size_t nheight = dest0->height;
+        const size_t sliceSize = nwidth * nheight;
 
-    if (levels <= 1)
-        return E_INVALIDARG;
+        // Point filtering does not blend, so it uses the raw values rather than linear color space
+        const bool point = (filter_select == TEX_FILTER_POINT);
 
-    if (IsCompressed(baseImage.format) || IsTypeless(baseImage.format) || IsPlanar(baseImage.format) || IsPalettized(baseImage.format))
-    {
-        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
-    }
+        const size_t slots = sfZ.taps;
 
-    HRESULT hr = E_UNEXPECTED;
+        // Allocate temporary space (1 source scanline, 1 target scanline, 1 horizontally filtered slice, and the cached slices)
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(
+            sizeof(XMVECTOR) * (width + nwidth + nwidth * height + sliceSize * slots), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
 
-    static_assert(TEX_FILTER_POINT == 0x100000, "TEX_FILTER_ flag values don't match TEX_FILTER_MASK");
+        std::unique_ptr<size_t[]> cache(new (std::nothrow) size_t[slots * 3]);
+        if (!cache)
+            return E_OUTOFMEMORY;
 
-    bool usewic = UseWICFiltering(baseImage.format, filter);
+        XMVECTOR* row = scanline.get();
+        XMVECTOR* target = row + width;
+        XMVECTOR* hslice = target + nwidth;
+        XMVECTOR* cacheSlices = hslice + nwidth * height;
 
-    WICPixelFormatGUID pfGUID = {};
-    bool wicpf = (usewic) ? _DXGIToWIC(baseImage.format, pfGUID, true) : false;
+        size_t* tags = cache.get();
+        size_t* lastUsed = tags + slots;
+        size_t* tapSlot = lastUsed + slots;
 
-    if (usewic && !wicpf)
-    {
-        // Check to see if the source and/or result size is too big for WIC
-        uint64_t expandedSize = uint64_t(std::max<size_t>(1, baseImage.width >> 1)) * uint64_t(std::max<size_t>(1, baseImage.height >> 1)) * sizeof(float) * 4;
-        uint64_t expandedSize2 = uint64_t(baseImage.width) * uint64_t(baseImage.height) * sizeof(float) * 4;
-        if (expandedSize > UINT32_MAX || expandedSize2 > UINT32_MAX)
+        for (size_t j = 0; j < slots; ++j)
         {
-            if (filter & TEX_FILTER_FORCE_WIC)
-                return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
-
-            usewic = false;
+            tags[j] = size_t(-1);
+            lastUsed[j] = size_t(-1);
         }
-    }
 
-    if (usewic)
-    {
-        //--- Use WIC filtering to generate mipmaps -----------------------------------
+        for (size_t z = zStart; z < zEnd; ++z)
+        {
+            const size_t count = sfZ.count[z];
+            const size_t* zIndex = &sfZ.index[z * sfZ.taps];
+            const float* zWeight = &sfZ.weight[z * sfZ.taps];
+
+            // Find cached slices, marking them as in use by this output slice
+            for (size_t k = 0; k < count; ++k)
+            {
+                tapSlot[k] = size_t(-1);
+                for (size_t j = 0; j < slots; ++j)
+                {
+                    if (tags[j] == zIndex[k])
+                    {
+                        tapSlot[k] = j;
+                        lastUsed[j] = z;
+                        break;
+                    }
+                }
+            }
+
+            // Filter any missing slices in X and Y into slots not used by this output slice
+            for (size_t k = 0; k < count; ++k)
+            {
+                if (tapSlot[k] != size_t(-1))
+                    continue;
+
+                size_t j = 0;
+                for (; j < slots; ++j)
+                {
+                    if (tags[j] == zIndex[k])
+                        break;
+                }
+
+                if (j >= slots)
+                {
+                    for (j = 0; j < slots; ++j)
+                    {
+                        if (lastUsed[j] != z)
+                            break;
+                    }
+
+                    if (j >= slots)
+                        return E_UNEXPECTED;
+
+                    const Image* src = mipChain.GetImage(level - 1, 0, zIndex[k]);
+                    if (!src)
+                        return E_POINTER;
+
+                    const uint8_t* pSrc = src->pixels;
+                    for (size_t y = 0; y < height; ++y, pSrc += src->rowPitch)
+                    {
+                        if (point)
+                        {
+                            if (!_LoadScanline(row, width, pSrc, src->rowPitch, src->format))
+                                return E_FAIL;
+                        }
+                        else if (!_LoadScanlineLinear(row, width, pSrc, src->rowPitch, src->format, filter))
+                            return E_FAIL;
+
+                        XMVECTOR* hrow = hslice + nwidth * y;
+                        for (size_t x = 0; x < nwidth; ++x)
+                        {
+                            const size_t* xIndex = &sfX.index[x * sfX.taps];
+                            const float* xWeight = &sfX.weight[x * sfX.taps];
+
+                            XMVECTOR v = XMVectorScale(row[xIndex[0]], xWeight[0]);
+                            for (size_t t = 1; t < sfX.count[x]; ++t)
+                            {
+                                v = XMVectorMultiplyAdd(row[xIndex[t]], XMVectorReplicate(xWeight[t]), v);
+                            }
+                            hrow[x] = v;
+                        }
+                    }
+
+                    XMVECTOR* dslice = cacheSlices + sliceSize * j;
+                    for (size_t y = 0; y < nheight; ++y)
+                    {
+                        const size_t* yIndex = &sfY.index[y * sfY.taps];
+                        const float* yWeight = &sfY.weight[y * sfY.taps];
+
+                        XMVECTOR* drow = dslice + nwidth * y;
+                        const XMVECTOR* hrow = hslice + nwidth * yIndex[0];
+                        for (size_t x = 0; x < nwidth; ++x)
+                        {
+                            drow[x] = XMVectorScale(hrow[x], yWeight[0]);
+                        }
+
+                        for (size_t t = 1; t < sfY.count[y]; ++t)
+                        {
+                            hrow = hslice + nwidth * yIndex[t];
+                            XMVECTOR w = XMVectorReplicate(yWeight[t]);
+                            for (size_t x = 0; x < nwidth; ++x)
+                            {
+                                drow[x] = XMVectorMultiplyAdd(hrow[x], w, drow[x]);
+                            }
+                        }
+                    }
+
+                    tags[j] = zIndex[k];
+                }
+
+                tapSlot[k] = j;
+                lastUsed[j] = z;
+            }
+
+            // Depth pass
+            const Image* dest = mipChain.GetImage(level, 0, z);
+            if (!dest)
+                return E_POINTER;
+
+            uint8_t* pDest = dest->pixels;
+            for (size_t y = 0; y < nheight; ++y, pDest += dest->rowPitch)
+            {
+                if (!count)
+                {
+                    memset(target, 0, sizeof(XMVECTOR) * nwidth);
+                }
+                else
+                {
+                    const XMVECTOR* srow = cacheSlices + sliceSize * tapSlot[0] + nwidth * y;
+                    for (size_t x = 0; x < nwidth; ++x)
+                    {
+                        target[x] = XMVectorScale(srow[x], zWeight[0]);
+                    }
+
+                    for (size_t k = 1; k < count; ++k)
+                    {
+                        srow = cacheSlices + sliceSize * tapSlot[k] + nwidth * y;
+                        XMVECTOR w = XMVectorReplicate(zWeight[k]);
+                        for (size_t x = 0; x < nwidth; ++x)
+                        {
+                            target[x] = XMVectorMultiplyAdd(srow[x], w, target[x]);
+                        }
+                    }
+                }
+
+                if (point)
+                {
+                    if (!_StoreScanline(pDest, dest->rowPitch, dest->format, target, nwidth))
+                        return E_FAIL;
+                }
+                else
+                {
+                    if (filter_select == TEX_FILTER_TRIANGLE)
+                    {
+                        switch (dest->format)
+                        {
+                        case DXGI_FORMAT_R10G10B10A2_UNORM:
+                        case DXGI_FORMAT_R10G10B10A2_UINT:
+                        {
+                            // Need to slightly bias results for floating-point error accumulation which can
+                            // be visible with harshly quantized values
+                            static const XMVECTORF32 Bias = { { { 0.f, 0.f, 0.f, 0.1f } } };
+
+                            XMVECTOR* ptr = target;
+                            for (size_t i = 0; i < nwidth; ++i, ++ptr)
+                            {
+                                *ptr = XMVectorAdd(*ptr, Bias);
+                            }
+                        }
+                        break;
+
+                        default:
+                            break;
+                        }
+                    }
+
+                    if (!_StoreScanlineLinear(pDest, dest->rowPitch, dest->format, target, nwidth, filter))
+                        return E_FAIL;
+                }
+            }
+        }
+
+        return S_OK;
+    }
+
+    // Output slices of each level are split into one contiguous range per thread, so each thread's slice cache
+    // is reused by consecutive output slices
+    HRESULT Generate3DMipsSeparableFilterParallel(DWORD filter_select, size_t depth, size_t levels, DWORD filter, const ScratchImage& mipChain)
+    {
+        if (!depth || !mipChain.GetImages())
+            return E_INVALIDARG;
+
+        // This assumes that the base images are already placed into the mipChain at the top level... (see _Setup3DMips)
+
+        assert(levels > 1);
+
+        size_t width = mipChain.GetMetadata().width;
+        size_t height = mipChain.GetMetadata().height;
+
+        DWORD table = filter_select;
+        if (filter_select == TEX_FILTER_BOX)
+        {
+            if (!ispow2(width) || !ispow2(height) || !ispow2(depth))
+                return E_FAIL;
+
+            // A 2:1 linear filter samples the same 2x2x2 footprint with equal weights as the box filter
+            table = TEX_FILTER_LINEAR;
+        }
+
+        for (size_t level = 1; level < levels; ++level)
+        {
+            const size_t nwidth = (width > 1) ? (width >> 1) : 1;
+            const size_t nheight = (height > 1) ? (height >> 1) : 1;
+            const size_t ndepth = (depth > 1) ? (depth >> 1) : 1;
+
+            std::shared_ptr<const SeparableFilter> sfX;
+            HRESULT hr = _GetCachedSeparableFilter(width, nwidth, table,
+                (filter & TEX_FILTER_WRAP_U) != 0, (filter & TEX_FILTER_MIRROR_U) != 0, sfX);
+            if (FAILED(hr))
+                return hr;
+
+            std::shared_ptr<const SeparableFilter> sfY;
+            hr = _GetCachedSeparableFilter(height, nheight, table,
+                (filter & TEX_FILTER_WRAP_V) != 0, (filter & TEX_FILTER_MIRROR_V) != 0, sfY);
+            if (FAILED(hr))
+                return hr;
+
+            std::shared_ptr<const SeparableFilter> sfZ;
+            hr = _GetCachedSeparableFilter(depth, ndepth, table,
+                (filter & TEX_FILTER_WRAP_W) != 0, (filter & TEX_FILTER_MIRROR_W) != 0, sfZ);
+            if (FAILED(hr))
+                return hr;
+
+            const int chunks = static_cast<int>(std::min<size_t>(ndepth, size_t(std::max(omp_get_max_threads(), 1))));
+
+            bool fail = false;
+
+#pragma omp parallel for
+            for (int chunk = 0; chunk < chunks; ++chunk)
+            {
+                const size_t zStart = (ndepth * size_t(chunk)) / size_t(chunks);
+                const size_t zEnd = (ndepth * size_t(chunk + 1)) / size_t(chunks);
+
+                HRESULT hrChunk = Generate3DMipsSeparableSlices(level, filter, filter_select, *sfX, *sfY, *sfZ, mipChain, zStart, zEnd);
+                if (FAILED(hrChunk))
+                    fail = true;
+            }
+
+            if (fail)
+                return E_FAIL;
+
+            width = nwidth;
+            height = nheight;
+            depth = ndepth;
+        }
+
+        return S_OK;
+    }
+#endif // _OPENMP
+
+    // With TEX_FILTER_PARALLEL, volumes are generated by the separable filter with output slices processed
+    // concurrently; the results match the serial filters to floating-point rounding.
+    HRESULT Generate3DMips(DWORD filter_select, size_t depth, size_t levels, DWORD filter, const ScratchImage& mipChain)
+    {
+        if (filter & TEX_FILTER_PARALLEL)
+        {
+#ifndef _OPENMP
+            return E_NOTIMPL;
+#else
+            return Generate3DMipsSeparableFilterParallel(filter_select, depth, levels, filter, mipChain);
+#endif
+        }
+
+        switch (filter_select)
+        {
+        case TEX_FILTER_BOX:
+            return Generate3DMipsBoxFilter(depth, levels, filter, mipChain);
+
+        case TEX_FILTER_POINT:
+            return Generate3DMipsPointFilter(depth, levels, mipChain);
+
+        case TEX_FILTER_LINEAR:
+            return Generate3DMipsLinearFilter(depth, levels, filter, mipChain);
+
+        case TEX_FILTER_CUBIC:
+            return Generate3DMipsCubicFilter(depth, levels, filter, mipChain);
+
+        case TEX_FILTER_TRIANGLE:
+            return Generate3DMipsTriangleFilter(depth, levels, filter, mipChain);
+
+        default:
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+        }
+    }
+}
+
+
+namespace DirectX
+{
+    //-------------------------------------------------------------------------------------
+    // Single-level 1D/2D mip generation (used to interleave mip filtering with other work)
+    //-------------------------------------------------------------------------------------
+
+    // Resolves the path and filter GenerateMipMaps would use for these base images, once for the whole chain. The
+    // path is encoded in the result: TEX_FILTER_FORCE_WIC scales from the base image with WIC (which needs COM on the
+    // calling thread), TEX_FILTER_FORCE_NON_WIC filters the previous level with the custom filter already chosen, and
+    // neither scales from the base image with the native Fant implementation
+    HRESULT _SelectMipFilter(_In_ const TexMetadata& metadata, _In_ DWORD filter, _Out_ DWORD& mipFilter)
+    {
+        mipFilter = 0;
+
+        static_assert(TEX_FILTER_POINT == 0x100000, "TEX_FILTER_ flag values don't match TEX_FILTER_MASK");
+
+        bool usewic = !metadata.IsPMAlpha() && UseWICFiltering(metadata.format, filter);
+
+        if (usewic && _UseNativeFant(filter))
+        {
+            assert(!(filter & (TEX_FILTER_FORCE_WIC | TEX_FILTER_FORCE_NON_WIC)));
+            mipFilter = filter;
+            return S_OK;
+        }
+
+        if (usewic)
+        {
+            WICPixelFormatGUID pfGUID = {};
+            if (!_DXGIToWIC(metadata.format, pfGUID, true))
+            {
+                // Check to see if the source and/or result size is too big for WIC
+                uint64_t expandedSize = uint64_t(std::max<size_t>(1, metadata.width >> 1)) * uint64_t(std::max<size_t>(1, metadata.height >> 1)) * sizeof(float) * 4;
+                uint64_t expandedSize2 = uint64_t(metadata.width) * uint64_t(metadata.height) * sizeof(float) * 4;
+                if (expandedSize > UINT32_MAX || expandedSize2 > UINT32_MAX)
+                {
+                    if (filter & TEX_FILTER_FORCE_WIC)
+                        return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+                    usewic = false;
+                }
+            }
+        }
+
+        if (usewic)
+        {
+            switch (filter & TEX_FILTER_MASK)
+            {
+            case 0:
+            case TEX_FILTER_POINT:
+            case TEX_FILTER_FANT: // Equivalent to Box filter
+            case TEX_FILTER_LINEAR:
+            case TEX_FILTER_CUBIC:
+                mipFilter = filter | TEX_FILTER_FORCE_WIC;
+                return S_OK;
+
+            default:
+                return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+            }
+        }
+
+        DWORD filter_select = (filter & TEX_FILTER_MASK);
+        if (!filter_select)
+        {
+            // Default filter choice (made from the base image, not per level)
+            filter_select = (ispow2(metadata.width) && ispow2(metadata.height)) ? TEX_FILTER_BOX : TEX_FILTER_LINEAR;
+        }
+
+        switch (filter_select)
+        {
+        case TEX_FILTER_BOX:
+        case TEX_FILTER_POINT:
+        case TEX_FILTER_LINEAR:
+        case TEX_FILTER_CUBIC:
+        case TEX_FILTER_TRIANGLE:
+            break;
+
+        default:
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+        }
+
+        mipFilter = (filter & ~static_cast<DWORD>(TEX_FILTER_MASK | TEX_FILTER_FORCE_WIC)) | filter_select | TEX_FILTER_FORCE_NON_WIC;
+        return S_OK;
+    }
+
+    // Produces the level after srcImage as a standalone single-level image, exactly as GenerateMipMaps builds it
+    HRESULT _GenerateMipLevel(
+        _In_ const Image& baseImage,
+        _In_ const Image& srcImage,
+        _In_ DWORD mipFilter,
+        _Out_ ScratchImage& nextLevel)
+    {
+        const size_t width = std::max<size_t>(1, srcImage.width >> 1);
+        const size_t height = std::max<size_t>(1, srcImage.height >> 1);
+
+        if (mipFilter & TEX_FILTER_FORCE_WIC)
+        {
+            // Like GenerateMipMaps, WIC scales every level from the base image
+            return Resize(baseImage, width, height, mipFilter, nextLevel);
+        }
+
+        HRESULT hr = nextLevel.Initialize2D(srcImage.format, width, height, 1, 1);
+        if (FAILED(hr))
+            return hr;
+
+        const Image* dest = nextLevel.GetImage(0, 0, 0);
+        if (!dest)
+        {
+            nextLevel.Release();
+            return E_POINTER;
+        }
+
+        if (mipFilter & TEX_FILTER_FORCE_NON_WIC)
+        {
+            // Custom filters build each level from the previous one
+            const Image mips[2] = { srcImage, *dest };
+            hr = Generate2DMipsItem(mipFilter & TEX_FILTER_MASK, 2, mipFilter, mips);
+        }
+        else
+        {
+            // Like GenerateMipMaps, the native Fant scaler resizes every level from the base image
+            hr = _ResizeUsingNativeFant(baseImage, mipFilter, *dest);
+        }
+
+        if (FAILED(hr))
+            nextLevel.Release();
+
+        return hr;
+    }
+}
+
+
+//=====================================================================================
+// Entry-points
+//=====================================================================================
+
+//-------------------------------------------------------------------------------------
+// Generate mipmap chain
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::GenerateMipMaps(
+    const Image& baseImage,
+    DWORD filter,
+    size_t levels,
+    ScratchImage& mipChain,
+    bool allow1D)
+{
+    if (!IsValid(baseImage.format))
+        return E_INVALIDARG;
+
+    if (!baseImage.pixels)
+        return E_POINTER;
+
+    if (!_CalculateMipLevels(baseImage.width, baseImage.height, levels))
+        return E_INVALIDARG;
+
+    if (levels <= 1)
+        return E_INVALIDARG;
+
+    if (IsCompressed(baseImage.format) || IsTypeless(baseImage.format) || IsPlanar(baseImage.format) || IsPalettized(baseImage.format))
+    {
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    HRESULT hr = E_UNEXPECTED;
+
+    static_assert(TEX_FILTER_POINT == 0x100000, "TEX_FILTER_ flag values don't match TEX_FILTER_MASK");
+
+    bool usewic = UseWICFiltering(baseImage.format, filter);
+
+    // With TEX_FILTER_NATIVE_FANT, the WIC Fant scaler is replaced by the native implementation
+    const bool usefant = usewic && _UseNativeFant(filter);
+    if (usefant)
+        usewic = false;
+
+    WICPixelFormatGUID pfGUID = {};
+    bool wicpf = (usewic) ? _DXGIToWIC(baseImage.format, pfGUID, true) : false;
+
+    if (usewic && !wicpf)
+    {
+        // Check to see if the source and/or result size is too big for WIC
+        uint64_t expandedSize = uint64_t(std::max<size_t>(1, baseImage.width >> 1)) * uint64_t(std::max<size_t>(1, baseImage.height >> 1)) * sizeof(float) * 4;
+        uint64_t expandedSize2 = uint64_t(baseImage.width) * uint64_t(baseImage.height) * sizeof(float) * 4;
+        if (expandedSize > UINT32_MAX || expandedSize2 > UINT32_MAX)
+        {
+            if (filter & TEX_FILTER_FORCE_WIC)
+                return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+            usewic = false;
+        }
+    }
+
+    if (usefant)
+    {
+        //--- Use native Fant filtering to generate mipmaps ---------------------------
+        hr = (baseImage.height > 1 || !allow1D)
+            ? mipChain.Initialize2D(baseImage.format, baseImage.width, baseImage.height, 1, levels)
+            : mipChain.Initialize1D(baseImage.format, baseImage.width, 1, levels);
+        if (FAILED(hr))
+            return hr;
+
+        hr = GenerateMipMapsUsingNativeFant(baseImage, filter, levels, mipChain, 0);
+        if (FAILED(hr))
+            mipChain.Release();
+        return hr;
+    }
+    else if (usewic)
+    {
+        //--- Use WIC filtering to generate mipmaps -----------------------------------
         switch (filter & TEX_FILTER_MASK)
         {
         case 0:
@@ -2674,7 +3853,7 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            hr = Generate2DMipsBoxFilter(levels, filter, mipChain, 0);
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
             if (FAILED(hr))
                 mipChain.Release();
             return hr;
@@ -2684,7 +3863,7 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            hr = Generate2DMipsPointFilter(levels, mipChain, 0);
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
             if (FAILED(hr))
                 mipChain.Release();
             return hr;
@@ -2694,7 +3873,7 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            hr = Generate2DMipsLinearFilter(levels, filter, mipChain, 0);
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
             if (FAILED(hr))
                 mipChain.Release();
             return hr;
@@ -2704,7 +3883,7 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            hr = Generate2DMipsCubicFilter(levels, filter, mipChain, 0);
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
             if (FAILED(hr))
                 mipChain.Release();
             return hr;
@@ -2714,7 +3893,7 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            hr = Generate2DMipsTriangleFilter(levels, filter, mipChain, 0);
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
             if (FAILED(hr))
                 mipChain.Release();
             return hr;
@@ -2779,6 +3958,11 @@ HRESULT DirectX::GenerateMipMaps(
 
     bool usewic = !metadata.IsPMAlpha() && UseWICFiltering(metadata.format, filter);
 
+    // With TEX_FILTER_NATIVE_FANT, the WIC Fant scaler is replaced by the native implementation
+    const bool usefant = usewic && _UseNativeFant(filter);
+    if (usefant)
+        usewic = false;
+
     WICPixelFormatGUID pfGUID = {};
     bool wicpf = (usewic) ? _DXGIToWIC(metadata.format, pfGUID, true) : false;
 
@@ -2796,7 +3980,28 @@ HRESULT DirectX::GenerateMipMaps(
         }
     }
 
-    if (usewic)
+    if (usefant)
+    {
+        //--- Use native Fant filtering to generate mipmaps ---------------------------
+        TexMetadata mdata2 = metadata;
+        mdata2.mipLevels = levels;
+        hr = mipChain.Initialize(mdata2);
+        if (FAILED(hr))
+            return hr;
+
+        for (size_t item = 0; item < metadata.arraySize; ++item)
+        {
+            hr = GenerateMipMapsUsingNativeFant(baseImages[item], filter, levels, mipChain, item);
+            if (FAILED(hr))
+            {
+                mipChain.Release();
+                return hr;
+            }
+        }
+
+        return S_OK;
+    }
+    else if (usewic)
     {
         //--- Use WIC filtering to generate mipmaps -----------------------------------
         switch (filter & TEX_FILTER_MASK)
@@ -2887,12 +4092,9 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            for (size_t item = 0; item < metadata.arraySize; ++item)
-            {
-                hr = Generate2DMipsBoxFilter(levels, filter, mipChain, item);
-                if (FAILED(hr))
-                    mipChain.Release();
-            }
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
+            if (FAILED(hr))
+                mipChain.Release();
             return hr;
 
         case TEX_FILTER_POINT:
@@ -2900,12 +4102,9 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            for (size_t item = 0; item < metadata.arraySize; ++item)
-            {
-                hr = Generate2DMipsPointFilter(levels, mipChain, item);
-                if (FAILED(hr))
-                    mipChain.Release();
-            }
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
+            if (FAILED(hr))
+                mipChain.Release();
             return hr;
 
         case TEX_FILTER_LINEAR:
@@ -2913,12 +4112,9 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            for (size_t item = 0; item < metadata.arraySize; ++item)
-            {
-                hr = Generate2DMipsLinearFilter(levels, filter, mipChain, item);
-                if (FAILED(hr))
-                    mipChain.Release();
-            }
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
+            if (FAILED(hr))
+                mipChain.Release();
             return hr;
 
         case TEX_FILTER_CUBIC:
@@ -2926,12 +4122,9 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            for (size_t item = 0; item < metadata.arraySize; ++item)
-            {
-                hr = Generate2DMipsCubicFilter(levels, filter, mipChain, item);
-                if (FAILED(hr))
-                    mipChain.Release();
-            }
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
+            if (FAILED(hr))
+                mipChain.Release();
             return hr;
 
         case TEX_FILTER_TRIANGLE:
@@ -2939,12 +4132,9 @@ HRESULT DirectX::GenerateMipMaps(
             if (FAILED(hr))
                 return hr;
 
-            for (size_t item = 0; item < metadata.arraySize; ++item)
-            {
-                hr = Generate2DMipsTriangleFilter(levels, filter, mipChain, item);
-                if (FAILED(hr))
-                    mipChain.Release();
-            }
+            hr = Generate2DMipsAllItems(filter_select, levels, filter, mipChain);
+            if (FAILED(hr))
+                mipChain.Release();
             return hr;
 
         default:
@@ -2954,6 +4144,217 @@ HRESULT DirectX::GenerateMipMaps(
 }
 
 
+//-------------------------------------------------------------------------------------
+// Scale alpha of a mipmap chain to preserve alpha test coverage
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::ScaleMipMapsAlphaForCoverage(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    size_t item,
+    float alphaReference,
+    ScratchImage& mipChain)
+{
+    if (!srcImages || !nimages || !IsValid(metadata.format) || nimages > metadata.mipLevels || !mipChain.GetImages())
+        return E_INVALIDARG;
+
+    if (metadata.IsVolumemap()
+        || IsCompressed(metadata.format) || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (!HasAlpha(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (item >= metadata.arraySize || alphaReference <= 0.f || alphaReference >= 1.f)
+        return E_INVALIDARG;
+
+    const TexMetadata& mdata = mipChain.GetMetadata();
+    if (mdata.format != metadata.format || mdata.width != metadata.width || mdata.height != metadata.height
+        || mdata.mipLevels < nimages || mdata.arraySize <= item)
+        return E_INVALIDARG;
+
+    for (size_t level = 0; level < nimages; ++level)
+    {
+        const Image& src = srcImages[level];
+        if (!src.pixels)
+            return E_POINTER;
+
+        const Image* dest = mipChain.GetImage(level, item, 0);
+        if (!dest)
+            return E_POINTER;
+
+        if (src.format != metadata.format || src.width != dest->width || src.height != dest->height)
+            return E_FAIL;
+    }
+
+    std::unique_ptr<size_t[]> histogram(new (std::nothrow) size_t[c_AlphaHistogramBins]);
+    if (!histogram)
+        return E_OUTOFMEMORY;
+
+    // Copy base image, and measure its coverage
+    {
+        const Image& src = srcImages[0];
+        const Image* dest = mipChain.GetImage(0, item, 0);
+
+        const uint8_t* pSrc = src.pixels;
+        uint8_t* pDest = dest->pixels;
+        const size_t msize = std::min<size_t>(dest->rowPitch, src.rowPitch);
+        for (size_t y = 0; y < src.height; ++y, pSrc += src.rowPitch, pDest += dest->rowPitch)
+        {
+            memcpy_s(pDest, dest->rowPitch, pSrc, msize);
+        }
+    }
+
+    HRESULT hr = ComputeAlphaHistogram(srcImages[0], histogram.get());
+    if (FAILED(hr))
+        return hr;
+
+    const float coverage = AlphaCoverage(histogram.get(), srcImages[0].width * srcImages[0].height, alphaReference);
+
+    for (size_t level = 1; level < nimages; ++level)
+    {
+        const Image& src = srcImages[level];
+
+        hr = ComputeAlphaHistogram(src, histogram.get());
+        if (FAILED(hr))
+            return hr;
+
+        const float alphaScale = AlphaCoverageScale(histogram.get(), src.width * src.height, coverage, alphaReference);
+
+        hr = ScaleAlpha(src, alphaScale, *mipChain.GetImage(level, item, 0));
+        if (FAILED(hr))
+            return hr;
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Update part of a mipmap chain
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::UpdateMipMaps(
+    const Image* images,
+    size_t nimages,
+    const TexMetadata& metadata,
+    size_t item,
+    const Rect& dirtyRect,
+    DWORD filter,
+    Rect* levelRects,
+    Rect* blockRects)
+{
+    if (!images || !nimages || !IsValid(metadata.format))
+        return E_INVALIDARG;
+
+    if (metadata.IsVolumemap()
+        || IsCompressed(metadata.format) || IsTypeless(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (filter & TEX_FILTER_FORCE_WIC)
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (item >= metadata.arraySize || metadata.mipLevels < 1)
+        return E_INVALIDARG;
+
+    if (!dirtyRect.w || !dirtyRect.h
+        || (dirtyRect.x + dirtyRect.w) > metadata.width || (dirtyRect.y + dirtyRect.h) > metadata.height)
+        return E_INVALIDARG;
+
+    // Resolve the path GenerateMipMaps takes for these flags. Only its custom filters build each level from the
+    // previous one; WIC and the native (alpha-weighted) Fant scaler resize every level from the base image, which
+    // a partial update can't reproduce
+    DWORD mipFilter = 0;
+    HRESULT hr = _SelectMipFilter(metadata, filter, mipFilter);
+    if (FAILED(hr))
+        return hr;
+
+    if (!(mipFilter & TEX_FILTER_FORCE_NON_WIC))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    DWORD filter_select = (mipFilter & TEX_FILTER_MASK);
+
+    switch (filter_select)
+    {
+    case TEX_FILTER_BOX:
+        if (!ispow2(metadata.width) || !ispow2(metadata.height))
+            return E_FAIL;
+
+        // A 2:1 linear filter samples the same 2x2 footprint with equal weights as the box filter
+        filter_select = TEX_FILTER_LINEAR;
+        break;
+
+    case TEX_FILTER_POINT:
+    case TEX_FILTER_LINEAR:
+    case TEX_FILTER_CUBIC:
+    case TEX_FILTER_TRIANGLE:
+        break;
+
+    default:
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    Rect rect = dirtyRect;
+
+    for (size_t level = 0; level < metadata.mipLevels; ++level)
+    {
+        if (level > 0)
+        {
+            size_t srcIndex = metadata.ComputeIndex(level - 1, item, 0);
+            size_t destIndex = metadata.ComputeIndex(level, item, 0);
+            if (srcIndex >= nimages || destIndex >= nimages)
+                return E_FAIL;
+
+            const Image& src = images[srcIndex];
+            const Image& dest = images[destIndex];
+            if (!src.pixels || !dest.pixels)
+                return E_POINTER;
+
+            if (src.format != metadata.format || dest.format != metadata.format)
+                return E_FAIL;
+
+            std::shared_ptr<const SeparableFilter> sfX;
+            hr = _GetCachedSeparableFilter(src.width, dest.width, filter_select,
+                (filter & TEX_FILTER_WRAP_U) != 0, (filter & TEX_FILTER_MIRROR_U) != 0, sfX);
+            if (FAILED(hr))
+                return hr;
+
+            std::shared_ptr<const SeparableFilter> sfY;
+            hr = _GetCachedSeparableFilter(src.height, dest.height, filter_select,
+                (filter & TEX_FILTER_WRAP_V) != 0, (filter & TEX_FILTER_MIRROR_V) != 0, sfY);
+            if (FAILED(hr))
+                return hr;
+
+            size_t x0, x1, y0, y1;
+            if (!AffectedRange(*sfX, dest.width, rect.x, rect.x + rect.w - 1, x0, x1)
+                || !AffectedRange(*sfY, dest.height, rect.y, rect.y + rect.h - 1, y0, y1))
+                return E_UNEXPECTED;
+
+            rect = Rect(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+
+            hr = UpdateMipLevelRect(src, dest, *sfX, *sfY, rect, filter, filter_select == TEX_FILTER_POINT);
+            if (FAILED(hr))
+                return hr;
+        }
+
+        if (levelRects)
+        {
+            levelRects[level] = rect;
+        }
+
+        if (blockRects)
+        {
+            const size_t bx = rect.x >> 2;
+            const size_t by = rect.y >> 2;
+            blockRects[level] = Rect(bx, by, ((rect.x + rect.w + 3) >> 2) - bx, ((rect.y + rect.h + 3) >> 2) - by);
+        }
+    }
+
+    return S_OK;
+}
+
+
 //-------------------------------------------------------------------------------------
 // Generate mipmap chain for volume texture
 //-------------------------------------------------------------------------------------
@@ -3014,7 +4415,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsBoxFilter(depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3024,7 +4425,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsPointFilter(depth, levels, mipChain);
+        hr = Generate3DMips(filter_select, depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3034,7 +4435,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsLinearFilter(depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3044,7 +4445,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsCubicFilter(depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3054,7 +4455,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsTriangleFilter(depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3130,7 +4531,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsBoxFilter(metadata.depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, metadata.depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3140,7 +4541,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsPointFilter(metadata.depth, levels, mipChain);
+        hr = Generate3DMips(filter_select, metadata.depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3150,7 +4551,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsLinearFilter(metadata.depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, metadata.depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3160,7 +4561,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsCubicFilter(metadata.depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, metadata.depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -3170,7 +4571,7 @@ HRESULT DirectX::GenerateMipMaps3D(
         if (FAILED(hr))
             return hr;
 
-        hr = Generate3DMipsTriangleFilter(metadata.depth, levels, filter, mipChain);
+        hr = Generate3DMips(filter_select, metadata.depth, levels, filter, mipChain);
         if (FAILED(hr))
             mipChain.Release();
         return hr;
@@ -759,3 +759,27 @@ HRESULT DirectX::TransformImage(
 
     return S_OK;
 }
+
+
+//-------------------------------------------------------------------------------------
+// Transform image into a caller-provided destination
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::TransformImage(
+    const Image& image,
+    std::function<void __cdecl(_Out_writes_(width) XMVECTOR* outPixels, _In_reads_(width) const XMVECTOR* inPixels, size_t width, size_t y)> pixelFunc,
+    const Image& destImage)
+{
+    if (image.width > UINT32_MAX
+        || image.height > UINT32_MAX)
+        return E_INVALIDARG;
+
+    if (IsPlanar(image.format) || IsPalettized(image.format) || IsCompressed(image.format) || IsTypeless(image.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (image.pixels == destImage.pixels && image.rowPitch != destImage.rowPitch)
+        return E_INVALIDARG;
+
+    // Source and destination scanlines are staged separately, so image and destImage may alias
+    return TransformImage_(image, pixelFunc, destImage);
+}
@@ -280,6 +280,72 @@ namespace DirectX
         _Inout_updates_all_(count) XMVECTOR* pBuffer, _In_ size_t count,
         _In_ DXGI_FORMAT outFormat, _In_ DXGI_FORMAT inFormat, _In_ DWORD flags);
 
+    //---------------------------------------------------------------------------------
+    // Cubemap helper functions
+
+    // Direction through face coordinates u, v in [-1, 1] (v pointing up) in the Direct3D face order +X, -X, +Y, -Y, +Z, -Z
+    inline XMVECTOR __cdecl _CubeFaceDirection(_In_ size_t face, _In_ float u, _In_ float v)
+    {
+        switch (face)
+        {
+        case 0:     return XMVectorSet(1.f, v, -u, 0.f);
+        case 1:     return XMVectorSet(-1.f, v, u, 0.f);
+        case 2:     return XMVectorSet(u, 1.f, -v, 0.f);
+        case 3:     return XMVectorSet(u, -1.f, v, 0.f);
+        case 4:     return XMVectorSet(u, v, 1.f, 0.f);
+        default:    return XMVectorSet(-u, v, -1.f, 0.f);
+        }
+    }
+
+    // Face hit by a direction, and the face coordinates u, v in [-1, 1] (v pointing up) of the hit
+#pragma prefast(suppress : 25000, "FXMVECTOR is 16 bytes")
+    inline size_t XM_CALLCONV _CubeFaceFromDirection(_In_ FXMVECTOR dir, _Out_ float& u, _Out_ float& v)
+    {
+        XMFLOAT3 d;
+        XMStoreFloat3(&d, dir);
+
+        const float ax = fabsf(d.x);
+        const float ay = fabsf(d.y);
+        const float az = fabsf(d.z);
+
+        if (ax >= ay && ax >= az)
+        {
+            u = ((d.x > 0.f) ? -d.z : d.z) / ax;
+            v = d.y / ax;
+            return (d.x > 0.f) ? 0 : 1;
+        }
+        else if (ay >= az)
+        {
+            u = d.x / ay;
+            v = ((d.y > 0.f) ? -d.z : d.z) / ay;
+            return (d.y > 0.f) ? 2 : 3;
+        }
+        else
+        {
+            u = ((d.z > 0.f) ? d.x : -d.x) / az;
+            v = d.y / az;
+            return (d.z > 0.f) ? 4 : 5;
+        }
+    }
+
+    // Texel of an R32G32B32A32_FLOAT face
+    inline XMVECTOR __cdecl _LoadCubeTexel(_In_ const Image& image, _In_ size_t x, _In_ size_t y)
+    {
+        return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(image.pixels + image.rowPitch * y) + x);
+    }
+
+    XMVECTOR __cdecl _FetchCubeTexelSeamless(
+        _In_reads_(6) const Image* const* faces, _In_ size_t face, _In_ ptrdiff_t x, _In_ ptrdiff_t y, _In_ size_t size);
+
+    XMVECTOR XM_CALLCONV _SampleCubeBilinear(_In_reads_(6) const Image* const* faces, _In_ FXMVECTOR dir);
+
+    XMVECTOR XM_CALLCONV _SampleCubeTrilinear(
+        _In_reads_(levels * 6) const Image* const* levelFaces, _In_ size_t levels, _In_ FXMVECTOR dir, _In_ float lod);
+
+    HRESULT __cdecl _ConvertCubeMapToR32G32B32A32(
+        _In_reads_(nimages) const Image* srcImages, _In_ size_t nimages, _In_ const TexMetadata& metadata,
+        _In_ DWORD filter, _In_ size_t levels, _Out_ ScratchImage& work);
+
     //---------------------------------------------------------------------------------
     // DDS helper functions
     HRESULT __cdecl _EncodeDDSHeader(
@@ -322,3 +322,94 @@ HRESULT DirectX::PremultiplyAlpha(
 
     return S_OK;
 }
+
+
+//-------------------------------------------------------------------------------------
+// Converts to/from a premultiplied alpha version of the texture (caller-provided destination)
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::PremultiplyAlpha(
+    const Image& srcImage,
+    DWORD flags,
+    const Image& destImage)
+{
+    if (!srcImage.pixels || !destImage.pixels)
+        return E_POINTER;
+
+    if (IsCompressed(srcImage.format)
+        || IsPlanar(srcImage.format)
+        || IsPalettized(srcImage.format)
+        || IsTypeless(srcImage.format)
+        || !HasAlpha(srcImage.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if ((srcImage.width > UINT32_MAX) || (srcImage.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    if (srcImage.format != destImage.format
+        || srcImage.width != destImage.width
+        || srcImage.height != destImage.height)
+        return E_INVALIDARG;
+
+    // Scanlines are processed one at a time, so srcImage and destImage may alias
+    if (flags & TEX_PMALPHA_REVERSE)
+    {
+        return (flags & TEX_PMALPHA_IGNORE_SRGB) ? DemultiplyAlpha(srcImage, destImage) : DemultiplyAlphaLinear(srcImage, flags, destImage);
+    }
+    else
+    {
+        return (flags & TEX_PMALPHA_IGNORE_SRGB) ? PremultiplyAlpha_(srcImage, destImage) : PremultiplyAlphaLinear(srcImage, flags, destImage);
+    }
+}
+
+
+//-------------------------------------------------------------------------------------
+// Converts to/from a premultiplied alpha version of the texture (in-place)
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::PremultiplyAlpha(
+    ScratchImage& image,
+    DWORD flags)
+{
+    const TexMetadata& metadata = image.GetMetadata();
+
+    const Image* images = image.GetImages();
+    const size_t nimages = image.GetImageCount();
+    if (!images || !nimages)
+        return E_INVALIDARG;
+
+    if (IsCompressed(metadata.format)
+        || IsPlanar(metadata.format)
+        || IsPalettized(metadata.format)
+        || IsTypeless(metadata.format)
+        || !HasAlpha(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if ((metadata.width > UINT32_MAX) || (metadata.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    if (metadata.IsPMAlpha() != ((flags & TEX_PMALPHA_REVERSE) != 0))
+        return E_FAIL;
+
+    for (size_t index = 0; index < nimages; ++index)
+    {
+        const Image& img = images[index];
+
+        HRESULT hr;
+        if (flags & TEX_PMALPHA_REVERSE)
+        {
+            hr = (flags & TEX_PMALPHA_IGNORE_SRGB) ? DemultiplyAlpha(img, img) : DemultiplyAlphaLinear(img, flags, img);
+        }
+        else
+        {
+            hr = (flags & TEX_PMALPHA_IGNORE_SRGB) ? PremultiplyAlpha_(img, img) : PremultiplyAlphaLinear(img, flags, img);
+        }
+        if (FAILED(hr))
+            return hr;
+    }
+
+    if (!image.OverrideAlphaMode((flags & TEX_PMALPHA_REVERSE) ? TEX_ALPHA_MODE_STRAIGHT : TEX_ALPHA_MODE_PREMULTIPLIED))
+        return E_FAIL;
+
+    return S_OK;
+}
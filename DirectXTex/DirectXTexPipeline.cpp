@@ -0,0 +1,950 @@
+//-------------------------------------------------------------------------------------
+// DirectXTexPipeline.cpp
+//  
+// DirectX Texture Library - Fused image operation pipeline
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248926
+//-------------------------------------------------------------------------------------
+
+#include "DirectXTexp.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#pragma warning(disable : 4616 6993)
+#endif
+
+#include "filters.h"
+
+using namespace DirectX;
+
+namespace
+{
+    // Each band of destination rows is sized so its output fits in roughly this many bytes of XMVECTOR data
+    const size_t c_BandSizeInBytes = 256 * 1024;
+
+    // Smallest band handed to a thread, which bounds how often filtered source rows are reloaded at band edges
+    const size_t c_MinBandRows = 16;
+
+    enum PIPELINE_OP
+    {
+        PIPELINE_OP_PREMULTIPLY = 0,
+        PIPELINE_OP_DEMULTIPLY,
+        PIPELINE_OP_SWIZZLE,
+        PIPELINE_OP_COLOR_TRANSFORM,
+        PIPELINE_OP_CUSTOM,
+    };
+
+    typedef std::function<void __cdecl(XMVECTOR* outPixels, const XMVECTOR* inPixels, size_t width, size_t y)> PixelFunction;
+
+    struct PipelineOperation
+    {
+        PIPELINE_OP     op;
+        uint32_t        swizzle[4];
+        XMFLOAT4X4      transform;
+        PixelFunction   pixelFunc;
+    };
+
+    struct ResizeFilters
+    {
+        DWORD                           mode;   // TEX_FILTER_POINT, TEX_FILTER_BOX, TEX_FILTER_LINEAR, or TEX_FILTER_CUBIC
+        size_t                          taps;   // Number of source rows that contribute to each destination row
+        size_t                          xinc;
+        size_t                          yinc;
+        std::unique_ptr<LinearFilter[]> lf;
+        std::unique_ptr<CubicFilter[]>  cf;
+        const LinearFilter*             lfX;
+        const LinearFilter*             lfY;
+        const CubicFilter*              cfX;
+        const CubicFilter*              cfY;
+    };
+
+    //-------------------------------------------------------------------------------------
+    bool IsSupportedFormat(DXGI_FORMAT format)
+    {
+        return IsValid(format)
+            && !IsCompressed(format)
+            && !IsPlanar(format)
+            && !IsPalettized(format)
+            && !IsTypeless(format);
+    }
+
+    // The pipeline always operates on linear data, so _ConvertScanline must not apply sRGB curves itself
+    DXGI_FORMAT MakeLinear(DXGI_FORMAT format)
+    {
+        switch (format)
+        {
+        case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:   return DXGI_FORMAT_R8G8B8A8_UNORM;
+        case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:   return DXGI_FORMAT_B8G8R8A8_UNORM;
+        case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:   return DXGI_FORMAT_B8G8R8X8_UNORM;
+        default:                                return format;
+        }
+    }
+
+    // Dithered stores do not go through _StoreScanlineLinear, so this mirrors its sRGB eligibility rules
+    bool UseSRGBOut(DXGI_FORMAT format, DWORD filter)
+    {
+        if (IsSRGB(format))
+            return true;
+
+        if (!(filter & TEX_FILTER_SRGB_OUT) || (format == DXGI_FORMAT_A8_UNORM))
+            return false;
+
+        return !(_GetConvertFlags(format) & (CONVF_UINT | CONVF_SNORM | CONVF_SINT | CONVF_DEPTH | CONVF_XR | CONVF_YUV));
+    }
+
+    //-------------------------------------------------------------------------------------
+    // Runs a sequence of per-pixel operations in-place on a scanline
+    //-------------------------------------------------------------------------------------
+    void ApplyOperations(
+        _In_reads_(count) const PipelineOperation* ops,
+        size_t count,
+        _Inout_updates_all_(width) XMVECTOR* pixels,
+        _Out_writes_(width) XMVECTOR* temp,
+        size_t width,
+        size_t y)
+    {
+        for (size_t j = 0; j < count; ++j)
+        {
+            const PipelineOperation& op = ops[j];
+
+            switch (op.op)
+            {
+            case PIPELINE_OP_PREMULTIPLY:
+                {
+                    XMVECTOR* ptr = pixels;
+                    for (size_t i = 0; i < width; ++i)
+                    {
+                        XMVECTOR v = *ptr;
+                        XMVECTOR alpha = XMVectorSplatW(v);
+                        alpha = XMVectorMultiply(v, alpha);
+                        *(ptr++) = XMVectorSelect(v, alpha, g_XMSelect1110);
+                    }
+                }
+                break;
+
+            case PIPELINE_OP_DEMULTIPLY:
+                {
+                    XMVECTOR* ptr = pixels;
+                    for (size_t i = 0; i < width; ++i)
+                    {
+                        XMVECTOR v = *ptr;
+                        XMVECTOR alpha = XMVectorSplatW(v);
+                        alpha = XMVectorDivide(v, alpha);
+                        *(ptr++) = XMVectorSelect(v, alpha, g_XMSelect1110);
+                    }
+                }
+                break;
+
+            case PIPELINE_OP_SWIZZLE:
+                {
+                    XMVECTOR* ptr = pixels;
+                    for (size_t i = 0; i < width; ++i, ++ptr)
+                    {
+                        *ptr = XMVectorSwizzle(*ptr, op.swizzle[0], op.swizzle[1], op.swizzle[2], op.swizzle[3]);
+                    }
+                }
+                break;
+
+            case PIPELINE_OP_COLOR_TRANSFORM:
+                {
+                    XMMATRIX m = XMLoadFloat4x4(&op.transform);
+
+                    XMVECTOR* ptr = pixels;
+                    for (size_t i = 0; i < width; ++i)
+                    {
+                        XMVECTOR v = *ptr;
+                        XMVECTOR nv = XMVector3Transform(v, m);
+                        *(ptr++) = XMVectorSelect(v, nv, g_XMSelect1110);
+                    }
+                }
+                break;
+
+            case PIPELINE_OP_CUSTOM:
+                op.pixelFunc(temp, pixels, width, y);
+                memcpy_s(pixels, sizeof(XMVECTOR)*width, temp, sizeof(XMVECTOR)*width);
+                break;
+
+            default:
+                assert(false);
+                break;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------------------
+    // Horizontal pass of the separable resize (one source row -> one destination-width row)
+    //-------------------------------------------------------------------------------------
+    void FilterRow(
+        const ResizeFilters& rf,
+        _In_ const XMVECTOR* row,
+        _Out_writes_(width) XMVECTOR* out,
+        size_t width)
+    {
+        switch (rf.mode)
+        {
+        case TEX_FILTER_POINT:
+            {
+                size_t sx = 0;
+                for (size_t x = 0; x < width; ++x)
+                {
+                    out[x] = row[sx >> 16];
+                    sx += rf.xinc;
+                }
+            }
+            break;
+
+        case TEX_FILTER_BOX:
+            for (size_t x = 0; x < width; ++x)
+            {
+                size_t x2 = x << 1;
+                out[x] = XMVectorScale(XMVectorAdd(row[x2], row[x2 + 1]), 0.5f);
+            }
+            break;
+
+        case TEX_FILTER_LINEAR:
+            for (size_t x = 0; x < width; ++x)
+            {
+                auto& toX = rf.lfX[x];
+                out[x] = XMVectorAdd(XMVectorScale(row[toX.u0], toX.weight0), XMVectorScale(row[toX.u1], toX.weight1));
+            }
+            break;
+
+        case TEX_FILTER_CUBIC:
+            for (size_t x = 0; x < width; ++x)
+            {
+                auto& toX = rf.cfX[x];
+                CUBIC_INTERPOLATE(out[x], toX.x, row[toX.u0], row[toX.u1], row[toX.u2], row[toX.u3]);
+            }
+            break;
+
+        default:
+            assert(false);
+            break;
+        }
+    }
+
+    //-------------------------------------------------------------------------------------
+    HRESULT SetupResizeFilters(size_t srcWidth, size_t srcHeight, size_t destWidth, size_t destHeight, DWORD filter, ResizeFilters& rf)
+    {
+        static_assert(TEX_FILTER_POINT == 0x100000, "TEX_FILTER_ flag values don't match TEX_FILTER_MASK");
+
+        DWORD filter_select = (filter & TEX_FILTER_MASK);
+        if (!filter_select)
+        {
+            // Default filter choice
+            filter_select = (((destWidth << 1) == srcWidth) && ((destHeight << 1) == srcHeight))
+                ? TEX_FILTER_BOX : TEX_FILTER_LINEAR;
+        }
+
+        rf.mode = filter_select;
+        rf.xinc = rf.yinc = 0;
+        rf.lfX = rf.lfY = nullptr;
+        rf.cfX = rf.cfY = nullptr;
+
+        switch (filter_select)
+        {
+        case TEX_FILTER_POINT:
+            rf.taps = 1;
+            rf.xinc = (srcWidth << 16) / destWidth;
+            rf.yinc = (srcHeight << 16) / destHeight;
+            break;
+
+        case TEX_FILTER_BOX:
+            if (((destWidth << 1) != srcWidth) || ((destHeight << 1) != srcHeight))
+                return E_FAIL;
+
+            rf.taps = 2;
+            break;
+
+        case TEX_FILTER_LINEAR:
+            rf.taps = 2;
+            rf.lf.reset(new (std::nothrow) LinearFilter[destWidth + destHeight]);
+            if (!rf.lf)
+                return E_OUTOFMEMORY;
+
+            rf.lfX = rf.lf.get();
+            rf.lfY = rf.lf.get() + destWidth;
+
+            _CreateLinearFilter(srcWidth, destWidth, (filter & TEX_FILTER_WRAP_U) != 0, rf.lf.get());
+            _CreateLinearFilter(srcHeight, destHeight, (filter & TEX_FILTER_WRAP_V) != 0, rf.lf.get() + destWidth);
+            break;
+
+        case TEX_FILTER_CUBIC:
+            rf.taps = 4;
+            rf.cf.reset(new (std::nothrow) CubicFilter[destWidth + destHeight]);
+            if (!rf.cf)
+                return E_OUTOFMEMORY;
+
+            rf.cfX = rf.cf.get();
+            rf.cfY = rf.cf.get() + destWidth;
+
+            _CreateCubicFilter(srcWidth, destWidth, (filter & TEX_FILTER_WRAP_U) != 0, (filter & TEX_FILTER_MIRROR_U) != 0, rf.cf.get());
+            _CreateCubicFilter(srcHeight, destHeight, (filter & TEX_FILTER_WRAP_V) != 0, (filter & TEX_FILTER_MIRROR_V) != 0, rf.cf.get() + destWidth);
+            break;
+
+        default:
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+        }
+
+        return S_OK;
+    }
+}
+
+
+//=====================================================================================
+// ImagePipeline private implementation
+//=====================================================================================
+
+struct ImagePipeline::Impl
+{
+    Impl() noexcept :
+        inFilter(0),
+        resize(false),
+        resizeIndex(0),
+        width(0),
+        height(0),
+        resizeFilter(0),
+        outFormat(DXGI_FORMAT_UNKNOWN),
+        outFilter(0),
+        threshold(TEX_THRESHOLD_DEFAULT),
+        alphaMode(TEX_ALPHA_MODE_UNKNOWN) {}
+
+    DWORD                           inFilter;
+
+    std::vector<PipelineOperation>  ops;
+
+    bool                            resize;
+    size_t                          resizeIndex;    // Operations before this index run on source rows, the rest on destination rows
+    size_t                          width;
+    size_t                          height;
+    DWORD                           resizeFilter;
+
+    DXGI_FORMAT                     outFormat;
+    DWORD                           outFilter;
+    float                           threshold;
+
+    TEX_ALPHA_MODE                  alphaMode;      // Set by the last premultiply operation, if any
+
+    HRESULT ProcessImage(const Image& srcImage, const Image& destImage, size_t z, bool parallel) const;
+
+    HRESULT ProcessBand(const Image& srcImage, const Image& destImage, const ResizeFilters& rf, size_t y0, size_t y1, size_t z) const;
+};
+
+
+//-------------------------------------------------------------------------------------
+// Processes the destination rows [y0, y1) from decode through encode. Horizontally
+// filtered source rows are kept in a small tagged cache so each source row in the band
+// is decoded, transformed, and filtered only once, and the working set stays in cache.
+//-------------------------------------------------------------------------------------
+HRESULT ImagePipeline::Impl::ProcessBand(
+    const Image& srcImage,
+    const Image& destImage,
+    const ResizeFilters& rf,
+    size_t y0,
+    size_t y1,
+    size_t z) const
+{
+    assert(srcImage.pixels && destImage.pixels);
+    assert(y0 < y1 && y1 <= destImage.height);
+
+    const size_t srcWidth = srcImage.width;
+    const size_t destWidth = destImage.width;
+    const size_t maxWidth = std::max(srcWidth, destWidth);
+    const size_t taps = (resize) ? rf.taps : 0;
+    assert(taps <= 4);
+
+    const bool diffusion = (outFilter & TEX_FILTER_DITHER_DIFFUSION) != 0;
+
+    // Allocate temporary space (source row, target row, custom operation row, filtered row cache, and diffusion errors)
+    const size_t nvectors = ((resize) ? srcWidth : 0) + destWidth + maxWidth + (destWidth * taps) + ((diffusion) ? (destWidth + 2) : 0);
+
+    ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * nvectors, 16)));
+    if (!scanline)
+        return E_OUTOFMEMORY;
+
+    XMVECTOR* target = scanline.get();
+    XMVECTOR* temp = target + destWidth;
+    XMVECTOR* row = temp + maxWidth;
+    XMVECTOR* cache = row + ((resize) ? srcWidth : 0);
+    XMVECTOR* pDiffusionErrors = (diffusion) ? (cache + destWidth * taps) : nullptr;
+
+#ifdef _DEBUG
+    memset(scanline.get(), 0xCD, sizeof(XMVECTOR) * nvectors);
+#endif
+
+    if (pDiffusionErrors)
+    {
+        memset(pDiffusionErrors, 0, sizeof(XMVECTOR) * (destWidth + 2));
+    }
+
+    XMVECTOR* slots[4] = {};
+    size_t tags[4] = { size_t(-1), size_t(-1), size_t(-1), size_t(-1) };
+    for (size_t s = 0; s < taps; ++s)
+    {
+        slots[s] = cache + destWidth * s;
+    }
+
+    const size_t npre = (resize) ? resizeIndex : ops.size();
+    const PipelineOperation* preOps = ops.data();
+    const PipelineOperation* postOps = ops.data() + npre;
+    const size_t npost = ops.size() - npre;
+
+    const DXGI_FORMAT convIn = MakeLinear(srcImage.format);
+    const DXGI_FORMAT convOut = MakeLinear(destImage.format);
+    const DWORD convFlags = outFilter & ~TEX_FILTER_SRGB;
+
+    const bool dither = (outFilter & (TEX_FILTER_DITHER | TEX_FILTER_DITHER_DIFFUSION)) != 0;
+    const bool srgbOut = dither && UseSRGBOut(destImage.format, outFilter);
+    const DWORD storeFlags = outFilter & TEX_FILTER_SRGB_OUT;
+
+    const uint8_t* pSrc = srcImage.pixels;
+    const size_t rowPitch = srcImage.rowPitch;
+
+    uint8_t* pDest = destImage.pixels + (destImage.rowPitch * y0);
+
+    for (size_t y = y0; y < y1; ++y)
+    {
+        if (!resize)
+        {
+            if (!_LoadScanlineLinear(target, srcWidth, pSrc + (rowPitch * y), rowPitch, srcImage.format, inFilter))
+                return E_FAIL;
+
+            ApplyOperations(preOps, npre, target, temp, srcWidth, y);
+        }
+        else
+        {
+            // Determine the source rows which contribute to this destination row
+            size_t needed[4] = {};
+            switch (rf.mode)
+            {
+            case TEX_FILTER_POINT:
+                needed[0] = (y * rf.yinc) >> 16;
+                break;
+
+            case TEX_FILTER_BOX:
+                needed[0] = y << 1;
+                needed[1] = needed[0] + 1;
+                break;
+
+            case TEX_FILTER_LINEAR:
+                needed[0] = rf.lfY[y].u0;
+                needed[1] = rf.lfY[y].u1;
+                break;
+
+            default:
+                needed[0] = rf.cfY[y].u0;
+                needed[1] = rf.cfY[y].u1;
+                needed[2] = rf.cfY[y].u2;
+                needed[3] = rf.cfY[y].u3;
+                break;
+            }
+
+            // Reuse any rows already in the cache
+            const XMVECTOR* rows[4] = {};
+            bool used[4] = {};
+            for (size_t k = 0; k < taps; ++k)
+            {
+                for (size_t s = 0; s < taps; ++s)
+                {
+                    if (tags[s] == needed[k])
+                    {
+                        rows[k] = slots[s];
+                        used[s] = true;
+                        break;
+                    }
+                }
+            }
+
+            // Decode, transform, and horizontally filter the rest into free slots
+            for (size_t k = 0; k < taps; ++k)
+            {
+                if (rows[k])
+                    continue;
+
+                size_t s = 0;
+                for (; s < taps; ++s)
+                {
+                    if (used[s] && tags[s] == needed[k])
+                        break;
+                }
+
+                if (s >= taps)
+                {
+                    for (s = 0; s < taps && used[s]; ++s) {}
+                    assert(s < taps);
+
+                    if (!_LoadScanlineLinear(row, srcWidth, pSrc + (rowPitch * needed[k]), rowPitch, srcImage.format, inFilter))
+                        return E_FAIL;
+
+                    ApplyOperations(preOps, npre, row, temp, srcWidth, needed[k]);
+
+                    FilterRow(rf, row, slots[s], destWidth);
+
+                    tags[s] = needed[k];
+                    used[s] = true;
+                }
+
+                rows[k] = slots[s];
+            }
+
+            // Vertical pass
+            switch (rf.mode)
+            {
+            case TEX_FILTER_POINT:
+                memcpy_s(target, sizeof(XMVECTOR) * destWidth, rows[0], sizeof(XMVECTOR) * destWidth);
+                break;
+
+            case TEX_FILTER_BOX:
+                for (size_t x = 0; x < destWidth; ++x)
+                {
+                    target[x] = XMVectorScale(XMVectorAdd(rows[0][x], rows[1][x]), 0.5f);
+                }
+                break;
+
+            case TEX_FILTER_LINEAR:
+                {
+                    auto& toY = rf.lfY[y];
+                    for (size_t x = 0; x < destWidth; ++x)
+                    {
+                        target[x] = XMVectorAdd(XMVectorScale(rows[0][x], toY.weight0), XMVectorScale(rows[1][x], toY.weight1));
+                    }
+                }
+                break;
+
+            default:
+                {
+                    auto& toY = rf.cfY[y];
+                    for (size_t x = 0; x < destWidth; ++x)
+                    {
+                        CUBIC_INTERPOLATE(target[x], toY.x, rows[0][x], rows[1][x], rows[2][x], rows[3][x]);
+                    }
+                }
+                break;
+            }
+        }
+
+        ApplyOperations(postOps, npost, target, temp, destWidth, y);
+
+        // Encode
+        if (convIn != convOut)
+        {
+            _ConvertScanline(target, destWidth, convOut, convIn, convFlags);
+        }
+
+        if (dither)
+        {
+            if (srgbOut)
+            {
+                XMVECTOR* ptr = target;
+                for (size_t i = 0; i < destWidth; ++i, ++ptr)
+                {
+                    *ptr = XMColorRGBToSRGB(*ptr);
+                }
+            }
+
+            if (!_StoreScanlineDither(pDest, destImage.rowPitch, destImage.format, target, destWidth, threshold, y, z, pDiffusionErrors))
+                return E_FAIL;
+        }
+        else
+        {
+            if (!_StoreScanlineLinear(pDest, destImage.rowPitch, destImage.format, target, destWidth, storeFlags, threshold))
+                return E_FAIL;
+        }
+
+        pDest += destImage.rowPitch;
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+HRESULT ImagePipeline::Impl::ProcessImage(
+    const Image& srcImage,
+    const Image& destImage,
+    size_t z,
+    bool parallel) const
+{
+    if (!srcImage.pixels || !destImage.pixels)
+        return E_POINTER;
+
+    ResizeFilters rf = {};
+    if (resize)
+    {
+        assert(destImage.width == width && destImage.height == height);
+
+        HRESULT hr = SetupResizeFilters(srcImage.width, srcImage.height, destImage.width, destImage.height, resizeFilter, rf);
+        if (FAILED(hr))
+            return hr;
+    }
+    else
+    {
+        assert(srcImage.width == destImage.width && srcImage.height == destImage.height);
+    }
+
+    // Error diffusion carries state from one row to the next, so it always runs as a single band
+    if (!parallel || (outFilter & TEX_FILTER_DITHER_DIFFUSION))
+    {
+        return ProcessBand(srcImage, destImage, rf, 0, destImage.height, z);
+    }
+
+#ifndef _OPENMP
+    return E_NOTIMPL;
+#else
+    const size_t bandRows = std::max<size_t>(c_MinBandRows, c_BandSizeInBytes / (sizeof(XMVECTOR) * destImage.width));
+    const size_t nBands = (destImage.height + bandRows - 1) / bandRows;
+
+    bool fail = false;
+
+#pragma omp parallel for
+    for (int nb = 0; nb < static_cast<int>(nBands); ++nb)
+    {
+        size_t y0 = size_t(nb) * bandRows;
+        size_t y1 = std::min<size_t>(y0 + bandRows, destImage.height);
+
+        if (FAILED(ProcessBand(srcImage, destImage, rf, y0, y1, z)))
+            fail = true;
+    }
+
+    return (fail) ? E_FAIL : S_OK;
+#endif // _OPENMP
+}
+
+
+//=====================================================================================
+// Entry-points
+//=====================================================================================
+
+ImagePipeline::ImagePipeline() noexcept
+{
+}
+
+ImagePipeline::ImagePipeline(ImagePipeline&& moveFrom) noexcept :
+    pImpl(std::move(moveFrom.pImpl))
+{
+}
+
+ImagePipeline& ImagePipeline::operator= (ImagePipeline&& moveFrom) noexcept
+{
+    pImpl = std::move(moveFrom.pImpl);
+    return *this;
+}
+
+ImagePipeline::~ImagePipeline()
+{
+}
+
+HRESULT ImagePipeline::CreateImpl()
+{
+    if (!pImpl)
+    {
+        pImpl.reset(new (std::nothrow) Impl);
+        if (!pImpl)
+            return E_OUTOFMEMORY;
+    }
+
+    return S_OK;
+}
+
+void ImagePipeline::Reset()
+{
+    pImpl.reset();
+}
+
+
+//-------------------------------------------------------------------------------------
+// Pipeline construction
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT ImagePipeline::SetInput(DWORD filter)
+{
+    HRESULT hr = CreateImpl();
+    if (FAILED(hr))
+        return hr;
+
+    pImpl->inFilter = filter & TEX_FILTER_SRGB_IN;
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT ImagePipeline::AddPremultiplyAlpha(DWORD flags)
+{
+    HRESULT hr = CreateImpl();
+    if (FAILED(hr))
+        return hr;
+
+    PipelineOperation op = {};
+    op.op = (flags & TEX_PMALPHA_REVERSE) ? PIPELINE_OP_DEMULTIPLY : PIPELINE_OP_PREMULTIPLY;
+    pImpl->ops.emplace_back(std::move(op));
+
+    pImpl->alphaMode = (flags & TEX_PMALPHA_REVERSE) ? TEX_ALPHA_MODE_STRAIGHT : TEX_ALPHA_MODE_PREMULTIPLIED;
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT ImagePipeline::AddSwizzle(uint32_t e0, uint32_t e1, uint32_t e2, uint32_t e3)
+{
+    if (e0 > 3 || e1 > 3 || e2 > 3 || e3 > 3)
+        return E_INVALIDARG;
+
+    HRESULT hr = CreateImpl();
+    if (FAILED(hr))
+        return hr;
+
+    PipelineOperation op = {};
+    op.op = PIPELINE_OP_SWIZZLE;
+    op.swizzle[0] = e0;
+    op.swizzle[1] = e1;
+    op.swizzle[2] = e2;
+    op.swizzle[3] = e3;
+    pImpl->ops.emplace_back(std::move(op));
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT ImagePipeline::AddColorTransform(const XMMATRIX& transform)
+{
+    HRESULT hr = CreateImpl();
+    if (FAILED(hr))
+        return hr;
+
+    PipelineOperation op = {};
+    op.op = PIPELINE_OP_COLOR_TRANSFORM;
+    XMStoreFloat4x4(&op.transform, transform);
+    pImpl->ops.emplace_back(std::move(op));
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT ImagePipeline::AddTransform(std::function<void __cdecl(XMVECTOR* outPixels, const XMVECTOR* inPixels, size_t width, size_t y)> pixelFunc)
+{
+    if (!pixelFunc)
+        return E_INVALIDARG;
+
+    HRESULT hr = CreateImpl();
+    if (FAILED(hr))
+        return hr;
+
+    PipelineOperation op = {};
+    op.op = PIPELINE_OP_CUSTOM;
+    op.pixelFunc = std::move(pixelFunc);
+    pImpl->ops.emplace_back(std::move(op));
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT ImagePipeline::AddResize(size_t width, size_t height, DWORD filter)
+{
+    if (width == 0 || height == 0)
+        return E_INVALIDARG;
+
+    if ((width > UINT32_MAX) || (height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    switch (filter & TEX_FILTER_MASK)
+    {
+    case 0:
+    case TEX_FILTER_POINT:
+    case TEX_FILTER_BOX:
+    case TEX_FILTER_LINEAR:
+    case TEX_FILTER_CUBIC:
+        break;
+
+    default:
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    HRESULT hr = CreateImpl();
+    if (FAILED(hr))
+        return hr;
+
+    if (pImpl->resize)
+        return E_UNEXPECTED;
+
+    pImpl->resize = true;
+    pImpl->resizeIndex = pImpl->ops.size();
+    pImpl->width = width;
+    pImpl->height = height;
+    pImpl->resizeFilter = filter;
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT ImagePipeline::SetOutput(DXGI_FORMAT format, DWORD filter, float threshold)
+{
+    if ((format != DXGI_FORMAT_UNKNOWN) && !IsValid(format))
+        return E_INVALIDARG;
+
+    if ((format != DXGI_FORMAT_UNKNOWN) && !IsSupportedFormat(format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    HRESULT hr = CreateImpl();
+    if (FAILED(hr))
+        return hr;
+
+    pImpl->outFormat = format;
+    pImpl->outFilter = filter & ~TEX_FILTER_SRGB_IN;
+    pImpl->threshold = threshold;
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Run pipeline (single image)
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT ImagePipeline::Process(const Image& srcImage, ScratchImage& image, DWORD flags) const
+{
+    if (!srcImage.pixels)
+        return E_POINTER;
+
+    if (!IsSupportedFormat(srcImage.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if ((srcImage.width > UINT32_MAX) || (srcImage.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+#ifndef _OPENMP
+    if (flags & TEX_PIPELINE_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    Impl defaults;
+    const Impl& pipeline = (pImpl) ? *pImpl : defaults;
+
+    DXGI_FORMAT format = (pipeline.outFormat != DXGI_FORMAT_UNKNOWN) ? pipeline.outFormat : srcImage.format;
+    size_t width = (pipeline.resize) ? pipeline.width : srcImage.width;
+    size_t height = (pipeline.resize) ? pipeline.height : srcImage.height;
+
+    HRESULT hr = image.Initialize2D(format, width, height, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    const Image *rimage = image.GetImage(0, 0, 0);
+    if (!rimage)
+    {
+        image.Release();
+        return E_POINTER;
+    }
+
+    hr = pipeline.ProcessImage(srcImage, *rimage, 0, (flags & TEX_PIPELINE_PARALLEL) != 0);
+    if (FAILED(hr))
+    {
+        image.Release();
+        return hr;
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Run pipeline (complex)
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT ImagePipeline::Process(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    ScratchImage& result,
+    DWORD flags) const
+{
+    if (!srcImages || !nimages)
+        return E_INVALIDARG;
+
+    if (!IsSupportedFormat(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if ((metadata.width > UINT32_MAX) || (metadata.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+#ifndef _OPENMP
+    if (flags & TEX_PIPELINE_PARALLEL)
+        return E_NOTIMPL;
+#endif
+
+    Impl defaults;
+    const Impl& pipeline = (pImpl) ? *pImpl : defaults;
+
+    TexMetadata mdata2 = metadata;
+    if (pipeline.outFormat != DXGI_FORMAT_UNKNOWN)
+    {
+        mdata2.format = pipeline.outFormat;
+    }
+
+    if (pipeline.resize)
+    {
+        mdata2.width = pipeline.width;
+        mdata2.height = pipeline.height;
+        mdata2.mipLevels = 1;
+    }
+
+    if (pipeline.alphaMode != TEX_ALPHA_MODE_UNKNOWN)
+    {
+        mdata2.SetAlphaMode(pipeline.alphaMode);
+    }
+
+    HRESULT hr = result.Initialize(mdata2);
+    if (FAILED(hr))
+        return hr;
+
+    const bool parallel = (flags & TEX_PIPELINE_PARALLEL) != 0;
+
+    for (size_t item = 0; item < mdata2.arraySize; ++item)
+    {
+        size_t d = mdata2.depth;
+        for (size_t level = 0; level < mdata2.mipLevels; ++level)
+        {
+            for (size_t slice = 0; slice < d; ++slice)
+            {
+                size_t srcIndex = metadata.ComputeIndex(level, item, slice);
+                if (srcIndex >= nimages)
+                {
+                    result.Release();
+                    return E_FAIL;
+                }
+
+                const Image& src = srcImages[srcIndex];
+                const Image* dest = result.GetImage(level, item, slice);
+                if (!dest)
+                {
+                    result.Release();
+                    return E_POINTER;
+                }
+
+                if (src.format != metadata.format)
+                {
+                    result.Release();
+                    return E_FAIL;
+                }
+
+                if ((src.width > UINT32_MAX) || (src.height > UINT32_MAX))
+                {
+                    result.Release();
+                    return E_FAIL;
+                }
+
+                if (!pipeline.resize && (src.width != dest->width || src.height != dest->height))
+                {
+                    result.Release();
+                    return E_FAIL;
+                }
+
+                hr = pipeline.ProcessImage(src, *dest, slice, parallel);
+                if (FAILED(hr))
+                {
+                    result.Release();
+                    return hr;
+                }
+            }
+
+            if (d > 1)
+                d >>= 1;
+        }
+    }
+
+    return S_OK;
+}
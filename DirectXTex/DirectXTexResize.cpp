@@ -13,6 +13,11 @@
 
 #include "filters.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#pragma warning(disable : 4616 6993)
+#endif
+
 using namespace DirectX;
 using Microsoft::WRL::ComPtr;
 
@@ -20,6 +25,8 @@ namespace DirectX
 {
     extern HRESULT _ResizeSeparateColorAndAlpha(_In_ IWICImagingFactory* pWIC, _In_ bool iswic2, _In_ IWICBitmap* original,
         _In_ size_t newWidth, _In_ size_t newHeight, _In_ DWORD filter, _Inout_ const Image* img);
+    extern bool _UseNativeFant(_In_ DWORD filter);
+    extern HRESULT _ResizeUsingNativeFant(_In_ const Image& srcImage, _In_ DWORD filter, _In_ const Image& destImage);
 }
 
 namespace
@@ -232,76 +239,34 @@ namespace
             break;
 
         case TEX_FILTER_TRIANGLE:
-            // WIC does not implement this filter
+        case TEX_FILTER_LANCZOS3:
+        case TEX_FILTER_MITCHELL:
+            // WIC does not implement these filters
             return false;
         }
 
         return true;
     }
 
-
-    //-------------------------------------------------------------------------------------
-    // Resize custom filters
-    //-------------------------------------------------------------------------------------
-
-    //--- Point Filter ---
-    HRESULT ResizePointFilter(const Image& srcImage, const Image& destImage)
+    //--- filters which must not be silently replaced by the WIC Fant scaler ---
+    bool IsNativeOnlyFilter(_In_ DWORD filter)
     {
-        assert(srcImage.pixels && destImage.pixels);
-        assert(srcImage.format == destImage.format);
-
-        // Allocate temporary space (2 scanlines)
-        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(
-            (sizeof(XMVECTOR) * (srcImage.width + destImage.width)), 16)));
-        if (!scanline)
-            return E_OUTOFMEMORY;
-
-        XMVECTOR* target = scanline.get();
-
-        XMVECTOR* row = target + destImage.width;
-
-#ifdef _DEBUG
-        memset(row, 0xCD, sizeof(XMVECTOR)*srcImage.width);
-#endif
-
-        const uint8_t* pSrc = srcImage.pixels;
-        uint8_t* pDest = destImage.pixels;
-
-        size_t rowPitch = srcImage.rowPitch;
-
-        size_t xinc = (srcImage.width << 16) / destImage.width;
-        size_t yinc = (srcImage.height << 16) / destImage.height;
-
-        size_t lasty = size_t(-1);
-
-        size_t sy = 0;
-        for (size_t y = 0; y < destImage.height; ++y)
+        switch (filter & TEX_FILTER_MASK)
         {
-            if ((lasty ^ sy) >> 16)
-            {
-                if (!_LoadScanline(row, srcImage.width, pSrc + (rowPitch * (sy >> 16)), rowPitch, srcImage.format))
-                    return E_FAIL;
-                lasty = sy;
-            }
-
-            size_t sx = 0;
-            for (size_t x = 0; x < destImage.width; ++x)
-            {
-                target[x] = row[sx >> 16];
-                sx += xinc;
-            }
-
-            if (!_StoreScanline(pDest, destImage.rowPitch, destImage.format, target, destImage.width))
-                return E_FAIL;
-            pDest += destImage.rowPitch;
+        case TEX_FILTER_LANCZOS3:
+        case TEX_FILTER_MITCHELL:
+            return true;
 
-            sy += yinc;
+        default:
+            return false;
         }
-
-        return S_OK;
     }
 
 
+    //-------------------------------------------------------------------------------------
+    // Resize custom filters
+    //-------------------------------------------------------------------------------------
+
     //--- Box Filter ---
     HRESULT ResizeBoxFilter(const Image& srcImage, DWORD filter, const Image& destImage)
     {
@@ -364,245 +329,229 @@ namespace
     }
 
 
-    //--- Linear Filter ---
-    HRESULT ResizeLinearFilter(const Image& srcImage, DWORD filter, const Image& destImage)
+    //--- Fixed-point Separable Filter (8-bit UNORM) ---
+    // Packed pixels are filtered directly with 2.14 fixed-point weights and 32-bit integer accumulators
+    // rather than being expanded to XMVECTOR, so each channel is one int32 lane in simple loops. The
+    // horizontal pass keeps 8 fractional bits for the vertical one.
+    //
+    // Worst case against the float path, within the _QuantizeSeparableFilter limits (32 taps, absolute
+    // weight sum below 1.4): each weight is off by at most 2^-15 plus the residual put on the largest one,
+    // so the weights of a sample are off by at most (2 * 32 + 1) * 2^-15 in total. That moves a horizontal
+    // result by under 0.26 LSB. The vertical pass scales that by up to 1.4 (0.37 LSB) and adds under 0.36 LSB
+    // of its own, so before the final rounding both paths differ by less than 0.75 LSB and the stored values
+    // by at most 1 LSB.
+    //
+    // 16-bit UNORM formats stay on the float path: the same weight error is about 190 LSB at 16 bits.
+    bool GetFixedPointLayout(DXGI_FORMAT format, size_t& channels, bool& setAlpha) noexcept
     {
-        assert(srcImage.pixels && destImage.pixels);
-        assert(srcImage.format == destImage.format);
+        setAlpha = false;
 
-        // Allocate temporary space (3 scanlines, plus X and Y filters)
-        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(
-            (sizeof(XMVECTOR) * (srcImage.width * 2 + destImage.width)), 16)));
-        if (!scanline)
-            return E_OUTOFMEMORY;
-
-        std::unique_ptr<LinearFilter[]> lf(new (std::nothrow) LinearFilter[destImage.width + destImage.height]);
-        if (!lf)
-            return E_OUTOFMEMORY;
-
-        LinearFilter* lfX = lf.get();
-        LinearFilter* lfY = lf.get() + destImage.width;
-
-        _CreateLinearFilter(srcImage.width, destImage.width, (filter & TEX_FILTER_WRAP_U) != 0, lfX);
-        _CreateLinearFilter(srcImage.height, destImage.height, (filter & TEX_FILTER_WRAP_V) != 0, lfY);
-
-        XMVECTOR* target = scanline.get();
-
-        XMVECTOR* row0 = target + destImage.width;
-        XMVECTOR* row1 = row0 + srcImage.width;
-
-#ifdef _DEBUG
-        memset(row0, 0xCD, sizeof(XMVECTOR)*srcImage.width);
-        memset(row1, 0xDD, sizeof(XMVECTOR)*srcImage.width);
-#endif
-
-        const uint8_t* pSrc = srcImage.pixels;
-        uint8_t* pDest = destImage.pixels;
-
-        size_t rowPitch = srcImage.rowPitch;
-
-        size_t u0 = size_t(-1);
-        size_t u1 = size_t(-1);
-
-        for (size_t y = 0; y < destImage.height; ++y)
+        switch (format)
         {
-            auto& toY = lfY[y];
-
-            if (toY.u0 != u0)
-            {
-                if (toY.u0 != u1)
-                {
-                    u0 = toY.u0;
-
-                    if (!_LoadScanlineLinear(row0, srcImage.width, pSrc + (rowPitch * u0), rowPitch, srcImage.format, filter))
-                        return E_FAIL;
-                }
-                else
-                {
-                    u0 = u1;
-                    u1 = size_t(-1);
-
-                    std::swap(row0, row1);
-                }
-            }
-
-            if (toY.u1 != u1)
-            {
-                u1 = toY.u1;
+        case DXGI_FORMAT_R8G8B8A8_UNORM:
+        case DXGI_FORMAT_B8G8R8A8_UNORM:
+            channels = 4;
+            return true;
 
-                if (!_LoadScanlineLinear(row1, srcImage.width, pSrc + (rowPitch * u1), rowPitch, srcImage.format, filter))
-                    return E_FAIL;
-            }
+        case DXGI_FORMAT_B8G8R8X8_UNORM:
+            channels = 4;
+            setAlpha = true;
+            return true;
 
-            for (size_t x = 0; x < destImage.width; ++x)
-            {
-                auto& toX = lfX[x];
+        case DXGI_FORMAT_R8G8_UNORM:
+            channels = 2;
+            return true;
 
-                BILINEAR_INTERPOLATE(target[x], toX, toY, row0, row1);
-            }
+        case DXGI_FORMAT_R8_UNORM:
+        case DXGI_FORMAT_A8_UNORM:
+            channels = 1;
+            return true;
 
-            if (!_StoreScanlineLinear(pDest, destImage.rowPitch, destImage.format, target, destImage.width, filter))
-                return E_FAIL;
-            pDest += destImage.rowPitch;
+        default:
+            return false;
         }
-
-        return S_OK;
     }
 
-
-    //--- Cubic Filter ---
-    HRESULT ResizeCubicFilter(const Image& srcImage, DWORD filter, const Image& destImage)
+    bool UseFixedPointFilters(
+        DXGI_FORMAT format,
+        DWORD filter,
+        const SeparableFilter& sfX,
+        const SeparableFilter& sfY,
+        size_t& channels,
+        bool& setAlpha) noexcept
     {
-        assert(srcImage.pixels && destImage.pixels);
-        assert(srcImage.format == destImage.format);
+        if (!sfX.fixedWeight || !sfY.fixedWeight)
+            return false;
 
-        // Allocate temporary space (5 scanlines, plus X and Y filters)
-        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(
-            (sizeof(XMVECTOR) * (srcImage.width * 4 + destImage.width)), 16)));
-        if (!scanline)
-            return E_OUTOFMEMORY;
+        // sRGB content needs the linear color space conversion of the float path
+        if (filter & TEX_FILTER_SRGB)
+            return false;
 
-        std::unique_ptr<CubicFilter[]> cf(new (std::nothrow) CubicFilter[destImage.width + destImage.height]);
-        if (!cf)
-            return E_OUTOFMEMORY;
+        return GetFixedPointLayout(format, channels, setAlpha);
+    }
+
+    HRESULT ResizeFixedPointRows(
+        const Image& srcImage,
+        size_t channels,
+        bool setAlpha,
+        const SeparableFilter& sfX,
+        const SeparableFilter& sfY,
+        const Image& destImage,
+        size_t yStart,
+        size_t yEnd)
+    {
+        assert(sfX.fixedWeight && sfY.fixedWeight);
+        assert(yStart <= yEnd && yEnd <= destImage.height);
 
-        CubicFilter* cfX = cf.get();
-        CubicFilter* cfY = cf.get() + destImage.width;
+        const int hshift = c_FixedWeightBits - 8;
+        const int vshift = c_FixedWeightBits * 2 - hshift;
+        const int32_t maxValue = UINT8_MAX;
 
-        _CreateCubicFilter(srcImage.width, destImage.width, (filter & TEX_FILTER_WRAP_U) != 0, (filter & TEX_FILTER_MIRROR_U) != 0, cfX);
-        _CreateCubicFilter(srcImage.height, destImage.height, (filter & TEX_FILTER_WRAP_V) != 0, (filter & TEX_FILTER_MIRROR_V) != 0, cfY);
+        const size_t slots = sfY.taps;
+        const size_t rowSize = destImage.width * channels;
 
-        XMVECTOR* target = scanline.get();
+        // Allocate temporary space (1 target row and the cached horizontally filtered rows)
+        std::unique_ptr<int32_t[]> buffer(new (std::nothrow) int32_t[rowSize * (slots + 1)]);
+        if (!buffer)
+            return E_OUTOFMEMORY;
 
-        XMVECTOR* row0 = target + destImage.width;
-        XMVECTOR* row1 = row0 + srcImage.width;
-        XMVECTOR* row2 = row0 + srcImage.width * 2;
-        XMVECTOR* row3 = row0 + srcImage.width * 3;
+        std::unique_ptr<size_t[]> cache(new (std::nothrow) size_t[slots * 3]);
+        if (!cache)
+            return E_OUTOFMEMORY;
 
-#ifdef _DEBUG
-        memset(row0, 0xCD, sizeof(XMVECTOR)*srcImage.width);
-        memset(row1, 0xDD, sizeof(XMVECTOR)*srcImage.width);
-        memset(row2, 0xED, sizeof(XMVECTOR)*srcImage.width);
-        memset(row3, 0xFD, sizeof(XMVECTOR)*srcImage.width);
-#endif
+        int32_t* target = buffer.get();
+        int32_t* cacheRows = target + rowSize;
 
-        const uint8_t* pSrc = srcImage.pixels;
-        uint8_t* pDest = destImage.pixels;
+        size_t* tags = cache.get();
+        size_t* lastUsed = tags + slots;
+        size_t* tapSlot = lastUsed + slots;
 
-        size_t rowPitch = srcImage.rowPitch;
+        for (size_t j = 0; j < slots; ++j)
+        {
+            tags[j] = size_t(-1);
+            lastUsed[j] = size_t(-1);
+        }
 
-        size_t u0 = size_t(-1);
-        size_t u1 = size_t(-1);
-        size_t u2 = size_t(-1);
-        size_t u3 = size_t(-1);
+        uint8_t* pDest = destImage.pixels + destImage.rowPitch * yStart;
 
-        for (size_t y = 0; y < destImage.height; ++y)
+        for (size_t y = yStart; y < yEnd; ++y)
         {
-            auto& toY = cfY[y];
+            const size_t count = sfY.count[y];
+            const size_t* yIndex = &sfY.index[y * sfY.taps];
+            const int16_t* yWeight = &sfY.fixedWeight[y * sfY.taps];
 
-            // Scanline 1
-            if (toY.u0 != u0)
+            // Find cached rows, marking them as in use by this output row
+            for (size_t k = 0; k < count; ++k)
             {
-                if (toY.u0 != u1 && toY.u0 != u2 && toY.u0 != u3)
+                tapSlot[k] = size_t(-1);
+                for (size_t j = 0; j < slots; ++j)
                 {
-                    u0 = toY.u0;
-
-                    if (!_LoadScanlineLinear(row0, srcImage.width, pSrc + (rowPitch * u0), rowPitch, srcImage.format, filter))
-                        return E_FAIL;
+                    if (tags[j] == yIndex[k])
+                    {
+                        tapSlot[k] = j;
+                        lastUsed[j] = y;
+                        break;
+                    }
                 }
-                else if (toY.u0 == u1)
-                {
-                    u0 = u1;
-                    u1 = size_t(-1);
+            }
 
-                    std::swap(row0, row1);
-                }
-                else if (toY.u0 == u2)
-                {
-                    u0 = u2;
-                    u2 = size_t(-1);
+            // Horizontally filter any missing rows into slots not used by this output row
+            for (size_t k = 0; k < count; ++k)
+            {
+                if (tapSlot[k] != size_t(-1))
+                    continue;
 
-                    std::swap(row0, row2);
-                }
-                else if (toY.u0 == u3)
+                size_t j = 0;
+                for (; j < slots; ++j)
                 {
-                    u0 = u3;
-                    u3 = size_t(-1);
-
-                    std::swap(row0, row3);
+                    if (tags[j] == yIndex[k])
+                        break;
                 }
-            }
 
-            // Scanline 2
-            if (toY.u1 != u1)
-            {
-                if (toY.u1 != u2 && toY.u1 != u3)
+                if (j >= slots)
                 {
-                    u1 = toY.u1;
+                    for (j = 0; j < slots; ++j)
+                    {
+                        if (lastUsed[j] != y)
+                            break;
+                    }
+
+                    if (j >= slots)
+                        return E_UNEXPECTED;
 
-                    if (!_LoadScanlineLinear(row1, srcImage.width, pSrc + (rowPitch * u1), rowPitch, srcImage.format, filter))
+                    const size_t sy = yIndex[k];
+                    if (sy >= srcImage.height)
                         return E_FAIL;
-                }
-                else if (toY.u1 == u2)
-                {
-                    u1 = u2;
-                    u2 = size_t(-1);
 
-                    std::swap(row1, row2);
-                }
-                else if (toY.u1 == u3)
-                {
-                    u1 = u3;
-                    u3 = size_t(-1);
+                    const uint8_t* sRow = srcImage.pixels + srcImage.rowPitch * sy;
+
+                    int32_t* hrow = cacheRows + rowSize * j;
+                    for (size_t x = 0; x < destImage.width; ++x)
+                    {
+                        const size_t* xIndex = &sfX.index[x * sfX.taps];
+                        const int16_t* xWeight = &sfX.fixedWeight[x * sfX.taps];
+                        const size_t xcount = sfX.count[x];
 
-                    std::swap(row1, row3);
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            int32_t acc = 1 << (hshift - 1);
+                            for (size_t t = 0; t < xcount; ++t)
+                            {
+                                acc += int32_t(sRow[xIndex[t] * channels + c]) * int32_t(xWeight[t]);
+                            }
+                            hrow[x * channels + c] = acc >> hshift;
+                        }
+                    }
+
+                    tags[j] = sy;
                 }
+
+                tapSlot[k] = j;
+                lastUsed[j] = y;
             }
 
-            // Scanline 3
-            if (toY.u2 != u2)
+            // Vertical pass
+            if (!count)
             {
-                if (toY.u2 != u3)
+                memset(target, 0, sizeof(int32_t) * rowSize);
+            }
+            else
+            {
+                const int32_t* hrow = cacheRows + rowSize * tapSlot[0];
+                const int32_t w0 = yWeight[0];
+                const int32_t round = 1 << (vshift - 1);
+                for (size_t i = 0; i < rowSize; ++i)
                 {
-                    u2 = toY.u2;
-
-                    if (!_LoadScanlineLinear(row2, srcImage.width, pSrc + (rowPitch * u2), rowPitch, srcImage.format, filter))
-                        return E_FAIL;
+                    target[i] = hrow[i] * w0 + round;
                 }
-                else
-                {
-                    u2 = u3;
-                    u3 = size_t(-1);
 
-                    std::swap(row2, row3);
+                for (size_t k = 1; k < count; ++k)
+                {
+                    hrow = cacheRows + rowSize * tapSlot[k];
+                    const int32_t w = yWeight[k];
+                    for (size_t i = 0; i < rowSize; ++i)
+                    {
+                        target[i] += hrow[i] * w;
+                    }
                 }
             }
 
-            // Scanline 4
-            if (toY.u3 != u3)
+            uint8_t* dRow = pDest;
+            for (size_t i = 0; i < rowSize; ++i)
             {
-                u3 = toY.u3;
-
-                if (!_LoadScanlineLinear(row3, srcImage.width, pSrc + (rowPitch * u3), rowPitch, srcImage.format, filter))
-                    return E_FAIL;
+                int32_t v = target[i] >> vshift;
+                v = std::min<int32_t>(std::max<int32_t>(v, 0), maxValue);
+                dRow[i] = static_cast<uint8_t>(v);
             }
 
-            for (size_t x = 0; x < destImage.width; ++x)
+            if (setAlpha)
             {
-                auto& toX = cfX[x];
-
-                XMVECTOR C0, C1, C2, C3;
-
-                CUBIC_INTERPOLATE(C0, toX.x, row0[toX.u0], row0[toX.u1], row0[toX.u2], row0[toX.u3]);
-                CUBIC_INTERPOLATE(C1, toX.x, row1[toX.u0], row1[toX.u1], row1[toX.u2], row1[toX.u3]);
-                CUBIC_INTERPOLATE(C2, toX.x, row2[toX.u0], row2[toX.u1], row2[toX.u2], row2[toX.u3]);
-                CUBIC_INTERPOLATE(C3, toX.x, row3[toX.u0], row3[toX.u1], row3[toX.u2], row3[toX.u3]);
-
-                CUBIC_INTERPOLATE(target[x], toY.x, C0, C1, C2, C3);
+                for (size_t x = 0; x < destImage.width; ++x)
+                {
+                    dRow[x * channels + channels - 1] = static_cast<uint8_t>(maxValue);
+                }
             }
 
-            if (!_StoreScanlineLinear(pDest, destImage.rowPitch, destImage.format, target, destImage.width, filter))
-                return E_FAIL;
             pDest += destImage.rowPitch;
         }
 
@@ -610,147 +559,183 @@ namespace
     }
 
 
-    //--- Triangle Filter ---
-    HRESULT ResizeTriangleFilter(const Image& srcImage, DWORD filter, const Image& destImage)
+    //--- Separable Filter (point, linear, cubic, triangle, Lanczos-3, and Mitchell-Netravali) ---
+    // Each source row is filtered horizontally once into a small cache of rows keyed by source
+    // row index, then the vertical pass combines cached rows for each output row. Only output
+    // rows [yStart, yEnd) are written, and each call has its own cache so row bands are independent.
+    HRESULT ResizeSeparableFilterRows(
+        const Image& srcImage,
+        DWORD filter,
+        DWORD filter_select,
+        const SeparableFilter& sfX,
+        const SeparableFilter& sfY,
+        const Image& destImage,
+        size_t yStart,
+        size_t yEnd)
     {
         assert(srcImage.pixels && destImage.pixels);
         assert(srcImage.format == destImage.format);
+        assert(yStart <= yEnd && yEnd <= destImage.height);
+
+        size_t channels;
+        bool setAlpha;
+        if (UseFixedPointFilters(srcImage.format, filter, sfX, sfY, channels, setAlpha))
+            return ResizeFixedPointRows(srcImage, channels, setAlpha, sfX, sfY, destImage, yStart, yEnd);
+
+        // Point filtering does not blend, so it uses the raw values rather than linear color space
+        const bool point = (filter_select == TEX_FILTER_POINT);
 
-        using namespace TriangleFilter;
+        const size_t slots = sfY.taps;
 
-        // Allocate initial temporary space (1 scanline, accumulation rows, plus X and Y filters)
-        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * srcImage.width, 16)));
+        // Allocate temporary space (1 source scanline, 1 target scanline, and the cached rows)
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(
+            (sizeof(XMVECTOR) * (srcImage.width + destImage.width * (slots + 1))), 16)));
         if (!scanline)
             return E_OUTOFMEMORY;
 
-        std::unique_ptr<TriangleRow[]> rowActive(new (std::nothrow) TriangleRow[destImage.height]);
-        if (!rowActive)
+        std::unique_ptr<size_t[]> cache(new (std::nothrow) size_t[slots * 3]);
+        if (!cache)
             return E_OUTOFMEMORY;
 
-        TriangleRow * rowFree = nullptr;
-
-        std::unique_ptr<Filter> tfX;
-        HRESULT hr = _Create(srcImage.width, destImage.width, (filter & TEX_FILTER_WRAP_U) != 0, tfX);
-        if (FAILED(hr))
-            return hr;
-
-        std::unique_ptr<Filter> tfY;
-        hr = _Create(srcImage.height, destImage.height, (filter & TEX_FILTER_WRAP_V) != 0, tfY);
-        if (FAILED(hr))
-            return hr;
-
-        XMVECTOR* row = scanline.get();
+        XMVECTOR* target = scanline.get();
+        XMVECTOR* row = target + destImage.width;
+        XMVECTOR* cacheRows = row + srcImage.width;
 
 #ifdef _DEBUG
         memset(row, 0xCD, sizeof(XMVECTOR)*srcImage.width);
+        memset(cacheRows, 0xDD, sizeof(XMVECTOR)*destImage.width*slots);
 #endif
 
-        auto xFromEnd = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(tfX.get()) + tfX->sizeInBytes);
-        auto yFromEnd = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(tfY.get()) + tfY->sizeInBytes);
+        size_t* tags = cache.get();
+        size_t* lastUsed = tags + slots;
+        size_t* tapSlot = lastUsed + slots;
 
-        // Count times rows get written
-        for (FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
+        for (size_t j = 0; j < slots; ++j)
         {
-            for (size_t j = 0; j < yFrom->count; ++j)
-            {
-                size_t v = yFrom->to[j].u;
-                assert(v < destImage.height);
-                ++rowActive[v].remaining;
-            }
-
-            yFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(yFrom) + yFrom->sizeInBytes);
+            tags[j] = size_t(-1);
+            lastUsed[j] = size_t(-1);
         }
 
-        // Filter image
         const uint8_t* pSrc = srcImage.pixels;
-        size_t rowPitch = srcImage.rowPitch;
-        const uint8_t* pEndSrc = pSrc + rowPitch * srcImage.height;
+        uint8_t* pDest = destImage.pixels + destImage.rowPitch * yStart;
 
-        uint8_t* pDest = destImage.pixels;
+        size_t rowPitch = srcImage.rowPitch;
 
-        for (FilterFrom* yFrom = tfY->from; yFrom < yFromEnd; )
+        for (size_t y = yStart; y < yEnd; ++y)
         {
-            // Create accumulation rows as needed
-            for (size_t j = 0; j < yFrom->count; ++j)
-            {
-                size_t v = yFrom->to[j].u;
-                assert(v < destImage.height);
-                TriangleRow* rowAcc = &rowActive[v];
+            const size_t count = sfY.count[y];
+            const size_t* yIndex = &sfY.index[y * sfY.taps];
+            const float* yWeight = &sfY.weight[y * sfY.taps];
 
-                if (!rowAcc->scanline)
+            // Find cached rows, marking them as in use by this output row
+            for (size_t k = 0; k < count; ++k)
+            {
+                tapSlot[k] = size_t(-1);
+                for (size_t j = 0; j < slots; ++j)
                 {
-                    if (rowFree)
-                    {
-                        // Steal and reuse scanline from 'free row' list
-                        assert(rowFree->scanline != nullptr);
-                        rowAcc->scanline.reset(rowFree->scanline.release());
-                        rowFree = rowFree->next;
-                    }
-                    else
+                    if (tags[j] == yIndex[k])
                     {
-                        rowAcc->scanline.reset(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * destImage.width, 16)));
-                        if (!rowAcc->scanline)
-                            return E_OUTOFMEMORY;
+                        tapSlot[k] = j;
+                        lastUsed[j] = y;
+                        break;
                     }
-
-                    memset(rowAcc->scanline.get(), 0, sizeof(XMVECTOR) * destImage.width);
                 }
             }
 
-            // Load source scanline
-            if ((pSrc + rowPitch) > pEndSrc)
-                return E_FAIL;
-
-            if (!_LoadScanlineLinear(row, srcImage.width, pSrc, rowPitch, srcImage.format, filter))
-                return E_FAIL;
+            // Horizontally filter any missing rows into slots not used by this output row
+            for (size_t k = 0; k < count; ++k)
+            {
+                if (tapSlot[k] != size_t(-1))
+                    continue;
 
-            pSrc += rowPitch;
+                size_t j = 0;
+                for (; j < slots; ++j)
+                {
+                    if (tags[j] == yIndex[k])
+                        break;
+                }
 
-            // Process row
-            size_t x = 0;
-            for (FilterFrom* xFrom = tfX->from; xFrom < xFromEnd; ++x)
-            {
-                for (size_t j = 0; j < yFrom->count; ++j)
+                if (j >= slots)
                 {
-                    size_t v = yFrom->to[j].u;
-                    assert(v < destImage.height);
-                    float yweight = yFrom->to[j].weight;
+                    for (j = 0; j < slots; ++j)
+                    {
+                        if (lastUsed[j] != y)
+                            break;
+                    }
+
+                    if (j >= slots)
+                        return E_UNEXPECTED;
 
-                    XMVECTOR* accPtr = rowActive[v].scanline.get();
-                    if (!accPtr)
-                        return E_POINTER;
+                    const size_t sy = yIndex[k];
+                    if (sy >= srcImage.height)
+                        return E_FAIL;
 
-                    for (size_t k = 0; k < xFrom->count; ++k)
+                    if (point)
+                    {
+                        if (!_LoadScanline(row, srcImage.width, pSrc + (rowPitch * sy), rowPitch, srcImage.format))
+                            return E_FAIL;
+                    }
+                    else
                     {
-                        size_t u = xFrom->to[k].u;
-                        assert(u < destImage.width);
+                        if (!_LoadScanlineLinear(row, srcImage.width, pSrc + (rowPitch * sy), rowPitch, srcImage.format, filter))
+                            return E_FAIL;
+                    }
 
-                        XMVECTOR weight = XMVectorReplicate(yweight * xFrom->to[k].weight);
+                    XMVECTOR* hrow = cacheRows + destImage.width * j;
+                    for (size_t x = 0; x < destImage.width; ++x)
+                    {
+                        const size_t* xIndex = &sfX.index[x * sfX.taps];
+                        const float* xWeight = &sfX.weight[x * sfX.taps];
 
-                        assert(x < srcImage.width);
-                        accPtr[u] = XMVectorMultiplyAdd(row[x], weight, accPtr[u]);
+                        XMVECTOR v = XMVectorScale(row[xIndex[0]], xWeight[0]);
+                        for (size_t t = 1; t < sfX.count[x]; ++t)
+                        {
+                            v = XMVectorMultiplyAdd(row[xIndex[t]], XMVectorReplicate(xWeight[t]), v);
+                        }
+                        hrow[x] = v;
                     }
+
+                    tags[j] = sy;
                 }
 
-                xFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(xFrom) + xFrom->sizeInBytes);
+                tapSlot[k] = j;
+                lastUsed[j] = y;
             }
 
-            // Write completed accumulation rows
-            for (size_t j = 0; j < yFrom->count; ++j)
+            // Vertical pass
+            if (!count)
             {
-                size_t v = yFrom->to[j].u;
-                assert(v < destImage.height);
-                TriangleRow* rowAcc = &rowActive[v];
-
-                assert(rowAcc->remaining > 0);
-                --rowAcc->remaining;
+                memset(target, 0, sizeof(XMVECTOR) * destImage.width);
+            }
+            else
+            {
+                const XMVECTOR* hrow = cacheRows + destImage.width * tapSlot[0];
+                const float w0 = yWeight[0];
+                for (size_t x = 0; x < destImage.width; ++x)
+                {
+                    target[x] = XMVectorScale(hrow[x], w0);
+                }
 
-                if (!rowAcc->remaining)
+                for (size_t k = 1; k < count; ++k)
                 {
-                    XMVECTOR* pAccSrc = rowAcc->scanline.get();
-                    if (!pAccSrc)
-                        return E_POINTER;
+                    hrow = cacheRows + destImage.width * tapSlot[k];
+                    XMVECTOR w = XMVectorReplicate(yWeight[k]);
+                    for (size_t x = 0; x < destImage.width; ++x)
+                    {
+                        target[x] = XMVectorMultiplyAdd(hrow[x], w, target[x]);
+                    }
+                }
+            }
 
+            if (point)
+            {
+                if (!_StoreScanline(pDest, destImage.rowPitch, destImage.format, target, destImage.width))
+                    return E_FAIL;
+            }
+            else
+            {
+                if (filter_select == TEX_FILTER_TRIANGLE)
+                {
                     switch (destImage.format)
                     {
                     case DXGI_FORMAT_R10G10B10A2_UNORM:
@@ -760,7 +745,7 @@ namespace
                         // be visible with harshly quantized values
                         static const XMVECTORF32 Bias = { { { 0.f, 0.f, 0.f, 0.1f } } };
 
-                        XMVECTOR* ptr = pAccSrc;
+                        XMVECTOR* ptr = target;
                         for (size_t i = 0; i < destImage.width; ++i, ++ptr)
                         {
                             *ptr = XMVectorAdd(*ptr, Bias);
@@ -771,30 +756,39 @@ namespace
                     default:
                         break;
                     }
-
-                    // This performs any required clamping
-                    if (!_StoreScanlineLinear(pDest + (destImage.rowPitch * v), destImage.rowPitch, destImage.format, pAccSrc, destImage.width, filter))
-                        return E_FAIL;
-
-                    // Put row on freelist to reuse it's allocated scanline
-                    rowAcc->next = rowFree;
-                    rowFree = rowAcc;
                 }
-            }
 
-            yFrom = reinterpret_cast<FilterFrom*>(reinterpret_cast<uint8_t*>(yFrom) + yFrom->sizeInBytes);
+                if (!_StoreScanlineLinear(pDest, destImage.rowPitch, destImage.format, target, destImage.width, filter))
+                    return E_FAIL;
+            }
+            pDest += destImage.rowPitch;
         }
 
         return S_OK;
     }
 
 
-    //--- Custom filter resize ---
-    HRESULT PerformResizeUsingCustomFilters(const Image& srcImage, DWORD filter, const Image& destImage)
+    HRESULT ResizeSeparableFilter(const Image& srcImage, DWORD filter, DWORD filter_select, const Image& destImage)
     {
-        if (!srcImage.pixels || !destImage.pixels)
-            return E_POINTER;
+        std::shared_ptr<const SeparableFilter> sfX;
+        HRESULT hr = _GetCachedSeparableFilter(srcImage.width, destImage.width, filter_select,
+            (filter & TEX_FILTER_WRAP_U) != 0, (filter & TEX_FILTER_MIRROR_U) != 0, sfX);
+        if (FAILED(hr))
+            return hr;
+
+        std::shared_ptr<const SeparableFilter> sfY;
+        hr = _GetCachedSeparableFilter(srcImage.height, destImage.height, filter_select,
+            (filter & TEX_FILTER_WRAP_V) != 0, (filter & TEX_FILTER_MIRROR_V) != 0, sfY);
+        if (FAILED(hr))
+            return hr;
+
+        return ResizeSeparableFilterRows(srcImage, filter, filter_select, *sfX, *sfY, destImage, 0, destImage.height);
+    }
 
+
+    //--- Custom filter selection ---
+    DWORD SelectCustomFilter(const Image& srcImage, DWORD filter, const Image& destImage)
+    {
         static_assert(TEX_FILTER_POINT == 0x100000, "TEX_FILTER_ flag values don't match TEX_FILTER_MASK");
 
         DWORD filter_select = (filter & TEX_FILTER_MASK);
@@ -805,27 +799,152 @@ namespace
                 ? TEX_FILTER_BOX : TEX_FILTER_LINEAR;
         }
 
+        return filter_select;
+    }
+
+
+    //--- Custom filter resize ---
+    HRESULT PerformResizeUsingCustomFilters(const Image& srcImage, DWORD filter, const Image& destImage)
+    {
+        if (!srcImage.pixels || !destImage.pixels)
+            return E_POINTER;
+
+        DWORD filter_select = SelectCustomFilter(srcImage, filter, destImage);
+
         switch (filter_select)
         {
-        case TEX_FILTER_POINT:
-            return ResizePointFilter(srcImage, destImage);
-
         case TEX_FILTER_BOX:
             return ResizeBoxFilter(srcImage, filter, destImage);
 
+        case TEX_FILTER_POINT:
         case TEX_FILTER_LINEAR:
-            return ResizeLinearFilter(srcImage, filter, destImage);
-
         case TEX_FILTER_CUBIC:
-            return ResizeCubicFilter(srcImage, filter, destImage);
+        case TEX_FILTER_TRIANGLE:
+        case TEX_FILTER_LANCZOS3:
+        case TEX_FILTER_MITCHELL:
+            return ResizeSeparableFilter(srcImage, filter, filter_select, destImage);
+
+        default:
+            return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+        }
+    }
 
+
+#ifdef _OPENMP
+    //--- Custom filter resize (parallel) ---
+    // Output rows of every image are split into bands, and all bands of all images are processed
+    // as a single parallel loop. The images must all have the same dimensions and format.
+    HRESULT PerformResizeUsingCustomFiltersParallel(
+        _In_reads_(nimages) const Image* const* srcImages,
+        _In_reads_(nimages) const Image* const* destImages,
+        size_t nimages,
+        DWORD filter)
+    {
+        if (!srcImages || !destImages || !nimages)
+            return E_INVALIDARG;
+
+        const Image& src0 = *srcImages[0];
+        const Image& dest0 = *destImages[0];
+
+        for (size_t index = 0; index < nimages; ++index)
+        {
+            const Image& src = *srcImages[index];
+            const Image& dest = *destImages[index];
+
+            if (!src.pixels || !dest.pixels)
+                return E_POINTER;
+
+            if (src.width != src0.width || src.height != src0.height || src.format != src0.format
+                || dest.width != dest0.width || dest.height != dest0.height || dest.format != dest0.format)
+                return E_FAIL;
+        }
+
+        DWORD filter_select = SelectCustomFilter(src0, filter, dest0);
+
+        std::shared_ptr<const SeparableFilter> sfX;
+        std::shared_ptr<const SeparableFilter> sfY;
+
+        switch (filter_select)
+        {
+        case TEX_FILTER_BOX:
+            if (((dest0.width << 1) != src0.width) || ((dest0.height << 1) != src0.height))
+                return E_FAIL;
+            break;
+
+        case TEX_FILTER_POINT:
+        case TEX_FILTER_LINEAR:
+        case TEX_FILTER_CUBIC:
         case TEX_FILTER_TRIANGLE:
-            return ResizeTriangleFilter(srcImage, filter, destImage);
+        case TEX_FILTER_LANCZOS3:
+        case TEX_FILTER_MITCHELL:
+        {
+            HRESULT hr = _GetCachedSeparableFilter(src0.width, dest0.width, filter_select,
+                (filter & TEX_FILTER_WRAP_U) != 0, (filter & TEX_FILTER_MIRROR_U) != 0, sfX);
+            if (FAILED(hr))
+                return hr;
+
+            hr = _GetCachedSeparableFilter(src0.height, dest0.height, filter_select,
+                (filter & TEX_FILTER_WRAP_V) != 0, (filter & TEX_FILTER_MIRROR_V) != 0, sfY);
+            if (FAILED(hr))
+                return hr;
+        }
+        break;
 
         default:
             return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
         }
+
+        // Aim for a few bands per thread, but not so small that reloading rows at band edges dominates
+        static const size_t c_MinBandRows = 16;
+
+        const size_t nthreads = static_cast<size_t>(std::max<int>(1, omp_get_max_threads()));
+        const size_t targetBands = std::max<size_t>(1, (nthreads * 4 + nimages - 1) / nimages);
+        const size_t bandRows = std::max<size_t>(c_MinBandRows, (dest0.height + targetBands - 1) / targetBands);
+        const size_t nbands = (dest0.height + bandRows - 1) / bandRows;
+        const size_t njobs = nbands * nimages;
+
+        if (njobs > INT32_MAX)
+            return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
+
+        bool fail = false;
+
+#pragma omp parallel for
+        for (int job = 0; job < static_cast<int>(njobs); ++job)
+        {
+            const Image& src = *srcImages[size_t(job) / nbands];
+            const Image& dest = *destImages[size_t(job) / nbands];
+
+            const size_t yStart = (size_t(job) % nbands) * bandRows;
+            const size_t yEnd = std::min<size_t>(yStart + bandRows, dest.height);
+
+            HRESULT hr;
+            if (filter_select == TEX_FILTER_BOX)
+            {
+                // Box filtering is a plain 2:1 reduction, so each band is simply a sub-image
+                Image srcBand = src;
+                srcBand.pixels = src.pixels + src.rowPitch * yStart * 2;
+                srcBand.height = (yEnd - yStart) * 2;
+                srcBand.slicePitch = src.rowPitch * srcBand.height;
+
+                Image destBand = dest;
+                destBand.pixels = dest.pixels + dest.rowPitch * yStart;
+                destBand.height = yEnd - yStart;
+                destBand.slicePitch = dest.rowPitch * destBand.height;
+
+                hr = ResizeBoxFilter(srcBand, filter, destBand);
+            }
+            else
+            {
+                hr = ResizeSeparableFilterRows(src, filter, filter_select, *sfX, *sfY, dest, yStart, yEnd);
+            }
+
+            if (FAILED(hr))
+                fail = true;
+        }
+
+        return (fail) ? E_FAIL : S_OK;
     }
+#endif // _OPENMP
 }
 
 
@@ -863,6 +982,16 @@ HRESULT DirectX::Resize(
     }
 
     bool usewic = UseWICFiltering(srcImage.format, filter);
+    if (usewic && IsNativeOnlyFilter(filter))
+    {
+        // TEX_FILTER_FORCE_WIC was requested with a filter WIC does not implement
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    // With TEX_FILTER_NATIVE_FANT, the WIC Fant scaler is replaced by the native implementation
+    const bool usefant = usewic && _UseNativeFant(filter);
+    if (usefant)
+        usewic = false;
 
     WICPixelFormatGUID pfGUID = {};
     bool wicpf = (usewic) ? _DXGIToWIC(srcImage.format, pfGUID, true) : false;
@@ -889,7 +1018,12 @@ HRESULT DirectX::Resize(
     if (!rimage)
         return E_POINTER;
 
-    if (usewic)
+    if (usefant)
+    {
+        // Case 0: WIC Fant resizing done natively
+        hr = _ResizeUsingNativeFant(srcImage, filter, *rimage);
+    }
+    else if (usewic)
     {
         if (wicpf)
         {
@@ -902,6 +1036,16 @@ HRESULT DirectX::Resize(
             hr = PerformResizeViaF32(srcImage, filter, *rimage);
         }
     }
+    else if (filter & TEX_FILTER_PARALLEL)
+    {
+        // Case 3: not using WIC resizing, multi-threaded
+#ifndef _OPENMP
+        hr = E_NOTIMPL;
+#else
+        const Image* simage = &srcImage;
+        hr = PerformResizeUsingCustomFiltersParallel(&simage, &rimage, 1, filter);
+#endif
+    }
     else
     {
         // Case 3: not using WIC resizing
@@ -946,6 +1090,17 @@ HRESULT DirectX::Resize(
         return hr;
 
     bool usewic = !metadata.IsPMAlpha() && UseWICFiltering(metadata.format, filter);
+    if (usewic && IsNativeOnlyFilter(filter))
+    {
+        // TEX_FILTER_FORCE_WIC was requested with a filter WIC does not implement
+        result.Release();
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    // With TEX_FILTER_NATIVE_FANT, the WIC Fant scaler is replaced by the native implementation
+    const bool usefant = usewic && _UseNativeFant(filter);
+    if (usefant)
+        usewic = false;
 
     WICPixelFormatGUID pfGUID = {};
     bool wicpf = (usewic) ? _DXGIToWIC(metadata.format, pfGUID, true) : false;
@@ -964,6 +1119,18 @@ HRESULT DirectX::Resize(
         }
     }
 
+#ifndef _OPENMP
+    if (!usewic && (filter & TEX_FILTER_PARALLEL))
+    {
+        result.Release();
+        return E_NOTIMPL;
+    }
+#endif
+
+    // Multi-threaded custom filtering processes all the images together once they are validated
+    std::vector<const Image*> parallelSrc;
+    std::vector<const Image*> parallelDest;
+
     switch (metadata.dimension)
     {
     case TEX_DIMENSION_TEXTURE1D:
@@ -999,7 +1166,12 @@ HRESULT DirectX::Resize(
                 return E_FAIL;
             }
 
-            if (usewic)
+            if (usefant)
+            {
+                // Case 0: WIC Fant resizing done natively
+                hr = _ResizeUsingNativeFant(*srcimg, filter, *destimg);
+            }
+            else if (usewic)
             {
                 if (wicpf)
                 {
@@ -1012,6 +1184,13 @@ HRESULT DirectX::Resize(
                     hr = PerformResizeViaF32(*srcimg, filter, *destimg);
                 }
             }
+            else if (filter & TEX_FILTER_PARALLEL)
+            {
+                // Case 3: not using WIC resizing, multi-threaded
+                parallelSrc.push_back(srcimg);
+                parallelDest.push_back(destimg);
+                hr = S_OK;
+            }
             else
             {
                 // Case 3: not using WIC resizing
@@ -1058,7 +1237,12 @@ HRESULT DirectX::Resize(
                 return E_FAIL;
             }
 
-            if (usewic)
+            if (usefant)
+            {
+                // Case 0: WIC Fant resizing done natively
+                hr = _ResizeUsingNativeFant(*srcimg, filter, *destimg);
+            }
+            else if (usewic)
             {
                 if (wicpf)
                 {
@@ -1071,6 +1255,13 @@ HRESULT DirectX::Resize(
                     hr = PerformResizeViaF32(*srcimg, filter, *destimg);
                 }
             }
+            else if (filter & TEX_FILTER_PARALLEL)
+            {
+                // Case 3: not using WIC resizing, multi-threaded
+                parallelSrc.push_back(srcimg);
+                parallelDest.push_back(destimg);
+                hr = S_OK;
+            }
             else
             {
                 // Case 3: not using WIC resizing
@@ -1090,5 +1281,217 @@ HRESULT DirectX::Resize(
         return E_FAIL;
     }
 
+#ifdef _OPENMP
+    if (!parallelSrc.empty())
+    {
+        hr = PerformResizeUsingCustomFiltersParallel(parallelSrc.data(), parallelDest.data(), parallelSrc.size(), filter);
+        if (FAILED(hr))
+        {
+            result.Release();
+            return hr;
+        }
+    }
+#endif
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Resize image (tiled)
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::ResizeTiled(
+    DXGI_FORMAT format,
+    size_t srcWidth,
+    size_t srcHeight,
+    size_t width,
+    size_t height,
+    DWORD filter,
+    std::function<HRESULT __cdecl(size_t y, const Image& rows)> readRows,
+    std::function<HRESULT __cdecl(size_t y, const Image& rows)> writeRows,
+    size_t bandRows)
+{
+    if (!srcWidth || !srcHeight || !width || !height || !readRows || !writeRows)
+        return E_INVALIDARG;
+
+    if ((srcWidth > UINT32_MAX) || (srcHeight > UINT32_MAX) || (width > UINT32_MAX) || (height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    if (IsCompressed(format) || IsPlanar(format) || IsPalettized(format) || IsTypeless(format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (filter & TEX_FILTER_FORCE_WIC)
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    static const size_t c_DefaultBandRows = 64;
+
+    if (!bandRows)
+        bandRows = c_DefaultBandRows;
+
+    static_assert(TEX_FILTER_POINT == 0x100000, "TEX_FILTER_ flag values don't match TEX_FILTER_MASK");
+
+    DWORD filter_select = (filter & TEX_FILTER_MASK);
+    if (!filter_select)
+    {
+        // Default filter choice
+        filter_select = (((width << 1) == srcWidth) && ((height << 1) == srcHeight))
+            ? TEX_FILTER_BOX : TEX_FILTER_LINEAR;
+    }
+
+    switch (filter_select)
+    {
+    case TEX_FILTER_BOX:
+        if (((width << 1) != srcWidth) || ((height << 1) != srcHeight))
+            return E_FAIL;
+
+        // A 2:1 linear filter samples the same 2x2 footprint with equal weights as the box filter
+        filter_select = TEX_FILTER_LINEAR;
+        break;
+
+    case TEX_FILTER_POINT:
+    case TEX_FILTER_LINEAR:
+    case TEX_FILTER_CUBIC:
+    case TEX_FILTER_TRIANGLE:
+    case TEX_FILTER_LANCZOS3:
+    case TEX_FILTER_MITCHELL:
+        break;
+
+    default:
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    std::shared_ptr<const SeparableFilter> sfX;
+    HRESULT hr = _GetCachedSeparableFilter(srcWidth, width, filter_select,
+        (filter & TEX_FILTER_WRAP_U) != 0, (filter & TEX_FILTER_MIRROR_U) != 0, sfX);
+    if (FAILED(hr))
+        return hr;
+
+    std::shared_ptr<const SeparableFilter> sfY;
+    hr = _GetCachedSeparableFilter(srcHeight, height, filter_select,
+        (filter & TEX_FILTER_WRAP_V) != 0, (filter & TEX_FILTER_MIRROR_V) != 0, sfY);
+    if (FAILED(hr))
+        return hr;
+
+    // Any one destination row needs at most sfY->taps source rows, so the source staging always fits at least one
+    const size_t srcCapacity = std::max<size_t>(bandRows, sfY->taps);
+
+    ScratchImage srcBand;
+    hr = srcBand.Initialize2D(format, srcWidth, srcCapacity, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    ScratchImage destBand;
+    hr = destBand.Initialize2D(format, width, bandRows, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    const Image* srcStaging = srcBand.GetImage(0, 0, 0);
+    const Image* destStaging = destBand.GetImage(0, 0, 0);
+    if (!srcStaging || !destStaging)
+        return E_POINTER;
+
+    // Band-local copy of the vertical filter with source rows renumbered into the staging image
+    SeparableFilter sfBand;
+    hr = _AllocateSeparableFilter(bandRows, sfY->taps, sfBand);
+    if (FAILED(hr))
+        return hr;
+
+    if (sfY->fixedWeight)
+    {
+        sfBand.fixedWeight.reset(new (std::nothrow) int16_t[bandRows * sfY->taps]);
+        if (!sfBand.fixedWeight)
+            return E_OUTOFMEMORY;
+    }
+
+    std::vector<size_t> rows;
+    std::vector<size_t> candidate;
+    rows.reserve(srcCapacity + sfY->taps);
+    candidate.reserve(srcCapacity + sfY->taps);
+
+    const size_t taps = sfY->taps;
+
+    for (size_t y = 0; y < height; )
+    {
+        // Grow the band while its unique source rows fit in the staging image
+        rows.clear();
+
+        size_t yEnd = y;
+        while (yEnd < height && (yEnd - y) < bandRows)
+        {
+            const size_t* index = &sfY->index[yEnd * taps];
+
+            candidate.assign(rows.cbegin(), rows.cend());
+            candidate.insert(candidate.end(), index, index + sfY->count[yEnd]);
+            std::sort(candidate.begin(), candidate.end());
+            candidate.erase(std::unique(candidate.begin(), candidate.end()), candidate.end());
+
+            // Leave this row for the next band if its source rows don't fit
+            if (candidate.size() > srcCapacity)
+                break;
+
+            rows.swap(candidate);
+            ++yEnd;
+        }
+
+        if (yEnd == y)
+            return E_UNEXPECTED;
+
+        // Read each contiguous run of source rows into the staging image
+        for (size_t j = 0; j < rows.size(); )
+        {
+            size_t k = j + 1;
+            while (k < rows.size() && rows[k] == rows[k - 1] + 1)
+                ++k;
+
+            Image run = *srcStaging;
+            run.pixels = srcStaging->pixels + srcStaging->rowPitch * j;
+            run.height = k - j;
+            run.slicePitch = run.rowPitch * run.height;
+
+            hr = readRows(rows[j], run);
+            if (FAILED(hr))
+                return hr;
+
+            j = k;
+        }
+
+        // Renumber the vertical taps for this band
+        for (size_t v = y; v < yEnd; ++v)
+        {
+            const size_t b = v - y;
+            sfBand.count[b] = sfY->count[v];
+            for (size_t k = 0; k < sfY->count[v]; ++k)
+            {
+                auto it = std::lower_bound(rows.cbegin(), rows.cend(), sfY->index[v * taps + k]);
+                assert(it != rows.cend());
+                sfBand.index[b * taps + k] = static_cast<size_t>(it - rows.cbegin());
+                sfBand.weight[b * taps + k] = sfY->weight[v * taps + k];
+                if (sfBand.fixedWeight)
+                {
+                    sfBand.fixedWeight[b * taps + k] = sfY->fixedWeight[v * taps + k];
+                }
+            }
+        }
+
+        Image srcView = *srcStaging;
+        srcView.height = rows.size();
+        srcView.slicePitch = srcView.rowPitch * srcView.height;
+
+        Image destView = *destStaging;
+        destView.height = yEnd - y;
+        destView.slicePitch = destView.rowPitch * destView.height;
+
+        hr = ResizeSeparableFilterRows(srcView, filter, filter_select, *sfX, sfBand, destView, 0, destView.height);
+        if (FAILED(hr))
+            return hr;
+
+        hr = writeRows(y, destView);
+        if (FAILED(hr))
+            return hr;
+
+        y = yEnd;
+    }
+
     return S_OK;
 }
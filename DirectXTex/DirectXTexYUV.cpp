@@ -0,0 +1,758 @@
+//-------------------------------------------------------------------------------------
+// DirectXTexYUV.cpp
+//  
+// DirectX Texture Library - YUV video format conversion
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248926
+//-------------------------------------------------------------------------------------
+
+#include "DirectXTexp.h"
+
+using namespace DirectX;
+using namespace DirectX::PackedVector;
+
+namespace
+{
+    struct YUVFormat
+    {
+        DXGI_FORMAT format;
+        DXGI_FORMAT packedFormat;   // Single-plane equivalent used for _ConvertScanline
+        bool        planar;         // 4:2:0 luma plane followed by interleaved chroma plane, otherwise packed 4:2:2
+        bool        wide;           // 16-bit components, otherwise 8-bit
+        float       quantize;       // Step between codes in the container (10-bit data is stored in the most significant bits)
+        float       maxCode;        // Largest code in units of quantize
+    };
+
+    const YUVFormat g_YUVFormats[] =
+    {
+        { DXGI_FORMAT_YUY2, DXGI_FORMAT_YUY2, false, false, 1.f,  255.f },
+        { DXGI_FORMAT_Y210, DXGI_FORMAT_Y210, false, true,  64.f, 1023.f },
+        { DXGI_FORMAT_Y216, DXGI_FORMAT_Y216, false, true,  1.f,  65535.f },
+        { DXGI_FORMAT_NV12, DXGI_FORMAT_YUY2, true,  false, 1.f,  255.f },
+        { DXGI_FORMAT_P010, DXGI_FORMAT_Y210, true,  true,  64.f, 1023.f },
+        { DXGI_FORMAT_P016, DXGI_FORMAT_Y216, true,  true,  1.f,  65535.f },
+    };
+
+    const YUVFormat* FindYUVFormat(DXGI_FORMAT format)
+    {
+        for (size_t j = 0; j < _countof(g_YUVFormats); ++j)
+        {
+            if (g_YUVFormats[j].format == format)
+                return &g_YUVFormats[j];
+        }
+
+        return nullptr;
+    }
+
+    //-------------------------------------------------------------------------------------
+    // Splatted constants for processing four pixels at a time in structure-of-arrays form
+    //
+    // Studio range: Y = 16..235, Cb/Cr = 16..240 centered on 128 (scaled by 256 for 16-bit)
+    //
+    //   R = Y' + 2(1 - Kr)Cr
+    //   G = Y' - (2Kb(1 - Kb) / Kg)Cb - (2Kr(1 - Kr) / Kg)Cr
+    //   B = Y' + 2(1 - Kb)Cb
+    //-------------------------------------------------------------------------------------
+    struct YUVConstants
+    {
+        XMVECTOR yOffset;
+        XMVECTOR yRange;
+        XMVECTOR cOffset;
+
+        // YUV -> RGB
+        XMVECTOR yScale;
+        XMVECTOR cScale;
+        XMVECTOR crToR;
+        XMVECTOR cbToG;
+        XMVECTOR crToG;
+        XMVECTOR cbToB;
+
+        // RGB -> YUV
+        XMVECTOR kr;
+        XMVECTOR kg;
+        XMVECTOR kb;
+        XMVECTOR cbScale;
+        XMVECTOR crScale;
+
+        XMVECTOR quantize;
+        XMVECTOR invQuantize;
+        XMVECTOR maxCode;
+    };
+
+    bool SetupYUVConstants(DWORD yuvFlags, const YUVFormat& fmt, YUVConstants& c)
+    {
+        float kr, kb;
+        switch (yuvFlags)
+        {
+        case TEX_YUV_BT601:     kr = 0.299f;  kb = 0.114f;  break;
+        case TEX_YUV_BT709:     kr = 0.2126f; kb = 0.0722f; break;
+        case TEX_YUV_BT2020:    kr = 0.2627f; kb = 0.0593f; break;
+        default:                return false;
+        }
+
+        const float kg = 1.f - kr - kb;
+        const float scale = (fmt.wide) ? 256.f : 1.f;
+
+        c.yOffset = XMVectorReplicate(16.f * scale);
+        c.yRange = XMVectorReplicate(219.f * scale);
+        c.cOffset = XMVectorReplicate(128.f * scale);
+
+        c.yScale = XMVectorReplicate(1.f / (219.f * scale));
+        c.cScale = XMVectorReplicate(1.f / (224.f * scale));
+        c.crToR = XMVectorReplicate(2.f * (1.f - kr));
+        c.cbToG = XMVectorReplicate(-2.f * kb * (1.f - kb) / kg);
+        c.crToG = XMVectorReplicate(-2.f * kr * (1.f - kr) / kg);
+        c.cbToB = XMVectorReplicate(2.f * (1.f - kb));
+
+        c.kr = XMVectorReplicate(kr);
+        c.kg = XMVectorReplicate(kg);
+        c.kb = XMVectorReplicate(kb);
+        c.cbScale = XMVectorReplicate(224.f * scale / (2.f * (1.f - kb)));
+        c.crScale = XMVectorReplicate(224.f * scale / (2.f * (1.f - kr)));
+
+        c.quantize = XMVectorReplicate(fmt.quantize);
+        c.invQuantize = XMVectorReplicate(1.f / fmt.quantize);
+        c.maxCode = XMVectorReplicate(fmt.maxCode);
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------------------
+    // Four pixels of Y, Cb, Cr codes -> four RGBA pixels
+    inline void YUVToRGB4(const YUVConstants& c, FXMVECTOR y, FXMVECTOR u, FXMVECTOR v, _Out_writes_(4) XMVECTOR* pDestination)
+    {
+        XMVECTOR yp = XMVectorMultiply(XMVectorSubtract(y, c.yOffset), c.yScale);
+        XMVECTOR cb = XMVectorMultiply(XMVectorSubtract(u, c.cOffset), c.cScale);
+        XMVECTOR cr = XMVectorMultiply(XMVectorSubtract(v, c.cOffset), c.cScale);
+
+        XMMATRIX m;
+        m.r[0] = XMVectorSaturate(XMVectorMultiplyAdd(cr, c.crToR, yp));
+        m.r[1] = XMVectorSaturate(XMVectorMultiplyAdd(cr, c.crToG, XMVectorMultiplyAdd(cb, c.cbToG, yp)));
+        m.r[2] = XMVectorSaturate(XMVectorMultiplyAdd(cb, c.cbToB, yp));
+        m.r[3] = g_XMOne;
+
+        // Structure-of-arrays -> array-of-structures
+        m = XMMatrixTranspose(m);
+        pDestination[0] = m.r[0];
+        pDestination[1] = m.r[1];
+        pDestination[2] = m.r[2];
+        pDestination[3] = m.r[3];
+    }
+
+    // Four RGBA pixels -> four pixels of Y, Cb, Cr codes (unquantized)
+    inline void RGBToYUV4(const YUVConstants& c, _In_reads_(4) const XMVECTOR* pSource, XMVECTOR& y, XMVECTOR& u, XMVECTOR& v)
+    {
+        XMMATRIX m(pSource[0], pSource[1], pSource[2], pSource[3]);
+        m = XMMatrixTranspose(m);
+
+        XMVECTOR r = XMVectorSaturate(m.r[0]);
+        XMVECTOR g = XMVectorSaturate(m.r[1]);
+        XMVECTOR b = XMVectorSaturate(m.r[2]);
+
+        XMVECTOR yp = XMVectorMultiplyAdd(r, c.kr, XMVectorMultiplyAdd(g, c.kg, XMVectorMultiply(b, c.kb)));
+
+        y = XMVectorMultiplyAdd(yp, c.yRange, c.yOffset);
+        u = XMVectorMultiplyAdd(XMVectorSubtract(b, yp), c.cbScale, c.cOffset);
+        v = XMVectorMultiplyAdd(XMVectorSubtract(r, yp), c.crScale, c.cOffset);
+    }
+
+    inline XMVECTOR QuantizeYUV(const YUVConstants& c, FXMVECTOR value)
+    {
+        XMVECTOR v = XMVectorRound(XMVectorMultiply(value, c.invQuantize));
+        v = XMVectorClamp(v, g_XMZero, c.maxCode);
+        return XMVectorMultiply(v, c.quantize);
+    }
+
+    inline XMVECTOR LoadYUVComponents(bool wide, _In_reads_bytes_(8) const uint8_t* pSource)
+    {
+        return (wide)
+            ? XMLoadUShort4(reinterpret_cast<const XMUSHORT4*>(pSource))
+            : XMLoadUByte4(reinterpret_cast<const XMUBYTE4*>(pSource));
+    }
+
+    inline void StoreYUVComponents(bool wide, _Out_writes_bytes_(8) uint8_t* pDestination, FXMVECTOR value)
+    {
+        if (wide)
+        {
+            XMStoreUShort4(reinterpret_cast<XMUSHORT4*>(pDestination), value);
+        }
+        else
+        {
+            XMStoreUByte4(reinterpret_cast<XMUBYTE4*>(pDestination), value);
+        }
+    }
+
+    //-------------------------------------------------------------------------------------
+    // Decodes one row of a YUV image into RGBA, four pixels at a time
+    // (pDestination must have room for the width rounded up to a multiple of 4)
+    //-------------------------------------------------------------------------------------
+    void LoadYUVScanline(
+        _Out_ XMVECTOR* pDestination,
+        const Image& image,
+        const YUVFormat& fmt,
+        const YUVConstants& c,
+        size_t y)
+    {
+        const size_t width = image.width;
+        const size_t csize = (fmt.wide) ? 2 : 1;
+
+        const uint8_t* pRow = image.pixels + (image.rowPitch * y);
+
+        if (fmt.planar)
+        {
+            // Chroma for each 2x2 block is shared (nearest, like ConvertToSinglePlane)
+            const uint8_t* pUV = image.pixels + (image.rowPitch * image.height) + (image.rowPitch * (y >> 1));
+
+            for (size_t x = 0; x < width; x += 4, pDestination += 4)
+            {
+                const uint8_t* pY = pRow + x * csize;
+                const uint8_t* pC = pUV + x * csize;
+
+                uint8_t tmpY[8];
+                uint8_t tmpC[8];
+
+                size_t remaining = width - x;
+                if (remaining < 4)
+                {
+                    memset(tmpY, 0, sizeof(tmpY));
+                    memset(tmpC, 0, sizeof(tmpC));
+                    memcpy_s(tmpY, sizeof(tmpY), pY, remaining * csize);
+                    memcpy_s(tmpC, sizeof(tmpC), pC, ((remaining + 1) >> 1) * 2 * csize);
+                    pY = tmpY;
+                    pC = tmpC;
+                }
+
+                XMVECTOR luma = LoadYUVComponents(fmt.wide, pY);
+                XMVECTOR chroma = LoadYUVComponents(fmt.wide, pC);
+
+                YUVToRGB4(c, luma, XMVectorSwizzle<0, 0, 2, 2>(chroma), XMVectorSwizzle<1, 1, 3, 3>(chroma), pDestination);
+            }
+        }
+        else
+        {
+            // Each 4-component element holds Y0 U Y1 V for a pair of pixels
+            for (size_t x = 0; x < width; x += 4, pDestination += 4)
+            {
+                const uint8_t* pSrc = pRow + x * 2 * csize;
+
+                uint8_t tmp[16];
+
+                size_t remaining = width - x;
+                if (remaining < 4)
+                {
+                    memset(tmp, 0, sizeof(tmp));
+                    memcpy_s(tmp, sizeof(tmp), pSrc, ((remaining + 1) >> 1) * 4 * csize);
+                    pSrc = tmp;
+                }
+
+                XMVECTOR p0 = LoadYUVComponents(fmt.wide, pSrc);
+                XMVECTOR p1 = LoadYUVComponents(fmt.wide, pSrc + 4 * csize);
+
+                YUVToRGB4(c,
+                    XMVectorPermute<0, 2, 4, 6>(p0, p1),
+                    XMVectorPermute<1, 1, 5, 5>(p0, p1),
+                    XMVectorPermute<3, 3, 7, 7>(p0, p1),
+                    pDestination);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------------------
+    // Encodes one row of a packed 4:2:2 image, or one pair of rows of a planar 4:2:0 image
+    // (source rows must be padded to a multiple of 4 pixels)
+    //-------------------------------------------------------------------------------------
+    void StoreYUVScanline(
+        const Image& image,
+        const YUVFormat& fmt,
+        const YUVConstants& c,
+        size_t y,
+        _In_ const XMVECTOR* pRow0,
+        _In_opt_ const XMVECTOR* pRow1)
+    {
+        const size_t width = image.width;
+        const size_t csize = (fmt.wide) ? 2 : 1;
+
+        static const XMVECTORF32 s_Quarter = { { { 0.25f, 0.25f, 0.25f, 0.25f } } };
+
+        uint8_t* pDest0 = image.pixels + (image.rowPitch * y);
+
+        if (fmt.planar)
+        {
+            assert(pRow1 != nullptr);
+
+            const bool hasRow1 = (y + 1) < image.height;
+            uint8_t* pDest1 = pDest0 + image.rowPitch;
+            uint8_t* pUV = image.pixels + (image.rowPitch * image.height) + (image.rowPitch * (y >> 1));
+
+            for (size_t x = 0; x < width; x += 4, pRow0 += 4, pRow1 += 4)
+            {
+                XMVECTOR y0, u0, v0;
+                RGBToYUV4(c, pRow0, y0, u0, v0);
+
+                XMVECTOR y1, u1, v1;
+                RGBToYUV4(c, pRow1, y1, u1, v1);
+
+                // Average each 2x2 block of chroma
+                XMVECTOR u = XMVectorAdd(u0, u1);
+                u = XMVectorMultiply(XMVectorAdd(u, XMVectorSwizzle<1, 0, 3, 2>(u)), s_Quarter);
+
+                XMVECTOR v = XMVectorAdd(v0, v1);
+                v = XMVectorMultiply(XMVectorAdd(v, XMVectorSwizzle<1, 0, 3, 2>(v)), s_Quarter);
+
+                XMVECTOR uv = XMVectorPermute<0, 4, 2, 6>(u, v);
+
+                uint8_t tmpY0[8];
+                uint8_t tmpY1[8];
+                uint8_t tmpC[8];
+
+                StoreYUVComponents(fmt.wide, tmpY0, QuantizeYUV(c, y0));
+                StoreYUVComponents(fmt.wide, tmpY1, QuantizeYUV(c, y1));
+                StoreYUVComponents(fmt.wide, tmpC, QuantizeYUV(c, uv));
+
+                size_t count = std::min<size_t>(4, width - x);
+                memcpy_s(pDest0 + x * csize, count * csize, tmpY0, count * csize);
+                if (hasRow1)
+                {
+                    memcpy_s(pDest1 + x * csize, count * csize, tmpY1, count * csize);
+                }
+
+                size_t ccount = ((count + 1) >> 1) * 2;
+                memcpy_s(pUV + x * csize, ccount * csize, tmpC, ccount * csize);
+            }
+        }
+        else
+        {
+            for (size_t x = 0; x < width; x += 4, pRow0 += 4)
+            {
+                XMVECTOR luma, u, v;
+                RGBToYUV4(c, pRow0, luma, u, v);
+
+                // Average each horizontal pair of chroma
+                u = XMVectorMultiply(XMVectorAdd(u, XMVectorSwizzle<1, 0, 3, 2>(u)), g_XMOneHalf);
+                v = XMVectorMultiply(XMVectorAdd(v, XMVectorSwizzle<1, 0, 3, 2>(v)), g_XMOneHalf);
+
+                luma = QuantizeYUV(c, luma);
+                XMVECTOR uv = QuantizeYUV(c, XMVectorPermute<0, 4, 2, 6>(u, v));
+
+                uint8_t tmp[16];
+                StoreYUVComponents(fmt.wide, tmp, XMVectorPermute<0, 4, 1, 5>(luma, uv));
+                StoreYUVComponents(fmt.wide, tmp + 4 * csize, XMVectorPermute<2, 6, 3, 7>(luma, uv));
+
+                size_t count = std::min<size_t>(4, width - x);
+                size_t bytes = ((count + 1) >> 1) * 4 * csize;
+                memcpy_s(pDest0 + x * 2 * csize, bytes, tmp, bytes);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------------------
+    HRESULT ConvertFromYUV_(
+        const Image& srcImage,
+        const YUVFormat& fmt,
+        const YUVConstants& c,
+        DWORD filter,
+        float threshold,
+        const Image& destImage)
+    {
+        assert(srcImage.width == destImage.width);
+        assert(srcImage.height == destImage.height);
+
+        if (!srcImage.pixels || !destImage.pixels)
+            return E_POINTER;
+
+        const size_t width = srcImage.width;
+        const size_t paddedWidth = (width + 3) & ~size_t(3);
+
+        const bool diffusion = (filter & TEX_FILTER_DITHER_DIFFUSION) != 0;
+
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(
+            sizeof(XMVECTOR) * (paddedWidth + ((diffusion) ? (width + 2) : 0)), 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        XMVECTOR* pDiffusionErrors = nullptr;
+        if (diffusion)
+        {
+            pDiffusionErrors = scanline.get() + paddedWidth;
+            memset(pDiffusionErrors, 0, sizeof(XMVECTOR)*(width + 2));
+        }
+
+        uint8_t *pDest = destImage.pixels;
+
+        for (size_t h = 0; h < srcImage.height; ++h)
+        {
+            LoadYUVScanline(scanline.get(), srcImage, fmt, c, h);
+
+            _ConvertScanline(scanline.get(), width, destImage.format, fmt.packedFormat, filter);
+
+            if (filter & (TEX_FILTER_DITHER | TEX_FILTER_DITHER_DIFFUSION))
+            {
+                if (!_StoreScanlineDither(pDest, destImage.rowPitch, destImage.format, scanline.get(), width, threshold, h, 0, pDiffusionErrors))
+                    return E_FAIL;
+            }
+            else
+            {
+                if (!_StoreScanline(pDest, destImage.rowPitch, destImage.format, scanline.get(), width, threshold))
+                    return E_FAIL;
+            }
+
+            pDest += destImage.rowPitch;
+        }
+
+        return S_OK;
+    }
+
+    //-------------------------------------------------------------------------------------
+    HRESULT ConvertToYUV_(
+        const Image& srcImage,
+        const YUVFormat& fmt,
+        const YUVConstants& c,
+        DWORD filter,
+        const Image& destImage)
+    {
+        assert(srcImage.width == destImage.width);
+        assert(srcImage.height == destImage.height);
+
+        if (!srcImage.pixels || !destImage.pixels)
+            return E_POINTER;
+
+        const size_t width = srcImage.width;
+        const size_t paddedWidth = (width + 3) & ~size_t(3);
+
+        // Allocate temporary space (2 scanlines)
+        ScopedAlignedArrayXMVECTOR scanline(static_cast<XMVECTOR*>(_aligned_malloc(sizeof(XMVECTOR) * paddedWidth * 2, 16)));
+        if (!scanline)
+            return E_OUTOFMEMORY;
+
+        XMVECTOR* row0 = scanline.get();
+        XMVECTOR* row1 = row0 + paddedWidth;
+
+        const size_t rowPitch = srcImage.rowPitch;
+
+        auto loadRow = [&](XMVECTOR* row, size_t y) -> bool
+        {
+            if (!_LoadScanline(row, width, srcImage.pixels + (rowPitch * y), rowPitch, srcImage.format))
+                return false;
+
+            _ConvertScanline(row, width, fmt.packedFormat, srcImage.format, filter);
+
+            // Replicate the last pixel so partial chroma blocks average real data
+            for (size_t x = width; x < paddedWidth; ++x)
+            {
+                row[x] = row[width - 1];
+            }
+
+            return true;
+        };
+
+        const size_t step = (fmt.planar) ? 2 : 1;
+        for (size_t h = 0; h < srcImage.height; h += step)
+        {
+            if (!loadRow(row0, h))
+                return E_FAIL;
+
+            if (fmt.planar)
+            {
+                if ((h + 1) < srcImage.height)
+                {
+                    if (!loadRow(row1, h + 1))
+                        return E_FAIL;
+                }
+                else
+                {
+                    memcpy_s(row1, sizeof(XMVECTOR) * paddedWidth, row0, sizeof(XMVECTOR) * paddedWidth);
+                }
+            }
+
+            StoreYUVScanline(destImage, fmt, c, h, row0, (fmt.planar) ? row1 : nullptr);
+        }
+
+        return S_OK;
+    }
+}
+
+
+//=====================================================================================
+// Entry-points
+//=====================================================================================
+
+//-------------------------------------------------------------------------------------
+// Convert YUV video image to RGB
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::ConvertFromYUV(
+    const Image& srcImage,
+    DXGI_FORMAT format,
+    DWORD yuvFlags,
+    DWORD filter,
+    float threshold,
+    ScratchImage& image)
+{
+    if (!IsValid(format))
+        return E_INVALIDARG;
+
+    if (!srcImage.pixels)
+        return E_POINTER;
+
+    const YUVFormat* fmt = FindYUVFormat(srcImage.format);
+    if (!fmt)
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (IsCompressed(format) || IsPlanar(format) || IsPalettized(format) || IsTypeless(format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    YUVConstants c;
+    if (!SetupYUVConstants(yuvFlags, *fmt, c))
+        return E_INVALIDARG;
+
+    if ((srcImage.width > UINT32_MAX) || (srcImage.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    HRESULT hr = image.Initialize2D(format, srcImage.width, srcImage.height, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    const Image *rimage = image.GetImage(0, 0, 0);
+    if (!rimage)
+    {
+        image.Release();
+        return E_POINTER;
+    }
+
+    hr = ConvertFromYUV_(srcImage, *fmt, c, filter, threshold, *rimage);
+    if (FAILED(hr))
+    {
+        image.Release();
+        return hr;
+    }
+
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT DirectX::ConvertFromYUV(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DXGI_FORMAT format,
+    DWORD yuvFlags,
+    DWORD filter,
+    float threshold,
+    ScratchImage& result)
+{
+    if (!srcImages || !nimages || !IsValid(format))
+        return E_INVALIDARG;
+
+    if (metadata.IsVolumemap())
+    {
+        // Direct3D does not support any video formats for Texture3D
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    const YUVFormat* fmt = FindYUVFormat(metadata.format);
+    if (!fmt)
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (IsCompressed(format) || IsPlanar(format) || IsPalettized(format) || IsTypeless(format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    YUVConstants c;
+    if (!SetupYUVConstants(yuvFlags, *fmt, c))
+        return E_INVALIDARG;
+
+    if ((metadata.width > UINT32_MAX) || (metadata.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    TexMetadata mdata2 = metadata;
+    mdata2.format = format;
+    HRESULT hr = result.Initialize(mdata2);
+    if (FAILED(hr))
+        return hr;
+
+    if (nimages != result.GetImageCount())
+    {
+        result.Release();
+        return E_FAIL;
+    }
+
+    const Image* dest = result.GetImages();
+    if (!dest)
+    {
+        result.Release();
+        return E_POINTER;
+    }
+
+    for (size_t index = 0; index < nimages; ++index)
+    {
+        const Image& src = srcImages[index];
+        if (src.format != metadata.format)
+        {
+            result.Release();
+            return E_FAIL;
+        }
+
+        if ((src.width > UINT32_MAX) || (src.height > UINT32_MAX))
+        {
+            result.Release();
+            return E_FAIL;
+        }
+
+        const Image& dst = dest[index];
+        assert(dst.format == format);
+
+        if (src.width != dst.width || src.height != dst.height)
+        {
+            result.Release();
+            return E_FAIL;
+        }
+
+        hr = ConvertFromYUV_(src, *fmt, c, filter, threshold, dst);
+        if (FAILED(hr))
+        {
+            result.Release();
+            return hr;
+        }
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Convert RGB image to YUV video format
+//-------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::ConvertToYUV(
+    const Image& srcImage,
+    DXGI_FORMAT format,
+    DWORD yuvFlags,
+    DWORD filter,
+    ScratchImage& image)
+{
+    if (!srcImage.pixels)
+        return E_POINTER;
+
+    const YUVFormat* fmt = FindYUVFormat(format);
+    if (!fmt)
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (IsCompressed(srcImage.format) || IsPlanar(srcImage.format) || IsPalettized(srcImage.format) || IsTypeless(srcImage.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    YUVConstants c;
+    if (!SetupYUVConstants(yuvFlags, *fmt, c))
+        return E_INVALIDARG;
+
+    if ((srcImage.width > UINT32_MAX) || (srcImage.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    HRESULT hr = image.Initialize2D(format, srcImage.width, srcImage.height, 1, 1);
+    if (FAILED(hr))
+        return hr;
+
+    const Image *rimage = image.GetImage(0, 0, 0);
+    if (!rimage)
+    {
+        image.Release();
+        return E_POINTER;
+    }
+
+    hr = ConvertToYUV_(srcImage, *fmt, c, filter, *rimage);
+    if (FAILED(hr))
+    {
+        image.Release();
+        return hr;
+    }
+
+    return S_OK;
+}
+
+_Use_decl_annotations_
+HRESULT DirectX::ConvertToYUV(
+    const Image* srcImages,
+    size_t nimages,
+    const TexMetadata& metadata,
+    DXGI_FORMAT format,
+    DWORD yuvFlags,
+    DWORD filter,
+    ScratchImage& result)
+{
+    if (!srcImages || !nimages)
+        return E_INVALIDARG;
+
+    if (metadata.IsVolumemap())
+    {
+        // Direct3D does not support any video formats for Texture3D
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    const YUVFormat* fmt = FindYUVFormat(format);
+    if (!fmt)
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    if (IsCompressed(metadata.format) || IsPlanar(metadata.format) || IsPalettized(metadata.format) || IsTypeless(metadata.format))
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+
+    YUVConstants c;
+    if (!SetupYUVConstants(yuvFlags, *fmt, c))
+        return E_INVALIDARG;
+
+    if ((metadata.width > UINT32_MAX) || (metadata.height > UINT32_MAX))
+        return E_INVALIDARG;
+
+    TexMetadata mdata2 = metadata;
+    mdata2.format = format;
+    HRESULT hr = result.Initialize(mdata2);
+    if (FAILED(hr))
+        return hr;
+
+    if (nimages != result.GetImageCount())
+    {
+        result.Release();
+        return E_FAIL;
+    }
+
+    const Image* dest = result.GetImages();
+    if (!dest)
+    {
+        result.Release();
+        return E_POINTER;
+    }
+
+    for (size_t index = 0; index < nimages; ++index)
+    {
+        const Image& src = srcImages[index];
+        if (src.format != metadata.format)
+        {
+            result.Release();
+            return E_FAIL;
+        }
+
+        if ((src.width > UINT32_MAX) || (src.height > UINT32_MAX))
+        {
+            result.Release();
+            return E_FAIL;
+        }
+
+        const Image& dst = dest[index];
+        assert(dst.format == format);
+
+        if (src.width != dst.width || src.height != dst.height)
+        {
+            result.Release();
+            return E_FAIL;
+        }
+
+        hr = ConvertToYUV_(src, *fmt, c, filter, dst);
+        if (FAILED(hr))
+        {
+            result.Release();
+            return hr;
+        }
+    }
+
+    return S_OK;
+}
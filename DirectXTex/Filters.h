@@ -420,4 +420,495 @@ namespace TriangleFilter
 
 } // namespace TriangleFilter
 
+
+//-------------------------------------------------------------------------------------
+// Separable filtering helpers
+//-------------------------------------------------------------------------------------
+
+struct SeparableFilter
+{
+    size_t                      taps;       // Maximum number of taps for any destination sample
+    std::unique_ptr<size_t[]>   count;      // Number of taps used by each destination sample
+    std::unique_ptr<size_t[]>   index;      // Source index of each tap (dest * taps entries)
+    std::unique_ptr<float[]>    weight;     // Weight of each tap (dest * taps entries)
+    std::unique_ptr<int16_t[]>  fixedWeight;// Optional 2.14 fixed-point weights (see _QuantizeSeparableFilter)
+
+    SeparableFilter() noexcept : taps(0) {}
+};
+
+inline HRESULT _AllocateSeparableFilter(_In_ size_t dest, _In_ size_t taps, _Inout_ SeparableFilter& sf)
+{
+    assert(dest > 0);
+    assert(taps > 0);
+
+    sf.taps = taps;
+    sf.count.reset(new (std::nothrow) size_t[dest]);
+    sf.index.reset(new (std::nothrow) size_t[dest * taps]);
+    sf.weight.reset(new (std::nothrow) float[dest * taps]);
+    if (!sf.count || !sf.index || !sf.weight)
+        return E_OUTOFMEMORY;
+
+    memset(sf.count.get(), 0, sizeof(size_t) * dest);
+    memset(sf.index.get(), 0, sizeof(size_t) * dest * taps);
+    memset(sf.weight.get(), 0, sizeof(float) * dest * taps);
+
+    return S_OK;
+}
+
+//-------------------------------------------------------------------------------------
+// Windowed filters (Lanczos-3 and Mitchell-Netravali)
+//-------------------------------------------------------------------------------------
+
+inline float _Lanczos3(float x) noexcept
+{
+    x = fabsf(x);
+    if (x < 1e-6f)
+        return 1.f;
+
+    if (x >= 3.f)
+        return 0.f;
+
+    const float px = XM_PI * x;
+    return 3.f * sinf(px) * sinf(px / 3.f) / (px * px);
+}
+
+inline float _MitchellNetravali(float x) noexcept
+{
+    // B = C = 1/3
+    x = fabsf(x);
+    const float x2 = x * x;
+    const float x3 = x2 * x;
+
+    if (x < 1.f)
+        return (7.f * x3 - 12.f * x2 + 16.f / 3.f) / 6.f;
+
+    if (x < 2.f)
+        return (-7.f / 3.f * x3 + 12.f * x2 - 20.f * x + 32.f / 3.f) / 6.f;
+
+    return 0.f;
+}
+
+inline HRESULT _CreateWindowedFilter(
+    _In_ size_t source, _In_ size_t dest, _In_ float radius, _In_ float (*kernel)(float), _In_ bool wrap, _In_ bool mirror,
+    _Inout_ SeparableFilter& sf)
+{
+    assert(source > 0);
+    assert(dest > 0);
+    assert(kernel != nullptr);
+
+    // When minifying, the kernel is stretched to cover the source footprint of each destination sample
+    const float scale = (dest < source) ? float(source) / float(dest) : 1.f;
+    const float support = radius * scale;
+    const size_t taps = static_cast<size_t>(ceilf(support * 2.f)) + 1;
+
+    HRESULT hr = _AllocateSeparableFilter(dest, taps, sf);
+    if (FAILED(hr))
+        return hr;
+
+    // The weights only depend on the phase of the destination sample relative to the source grid, which
+    // repeats every dest / gcd(source, dest) samples (shifted by source / gcd source samples each period)
+    size_t gcd = source;
+    for (size_t b = dest; b != 0; )
+    {
+        const size_t t = gcd % b;
+        gcd = b;
+        b = t;
+    }
+
+    const size_t phases = dest / gcd;
+    const ptrdiff_t step = static_cast<ptrdiff_t>(source / gcd);
+
+    std::unique_ptr<ptrdiff_t[]> phaseStart(new (std::nothrow) ptrdiff_t[phases]);
+    std::unique_ptr<float[]> phaseWeight(new (std::nothrow) float[phases * taps]);
+    if (!phaseStart || !phaseWeight)
+        return E_OUTOFMEMORY;
+
+    const double ratio = double(source) / double(dest);
+
+    for (size_t p = 0; p < phases; ++p)
+    {
+        const double center = (double(p) + 0.5) * ratio - 0.5;
+        const ptrdiff_t first = static_cast<ptrdiff_t>(floor(center - double(support))) + 1;
+
+        phaseStart[p] = first;
+
+        float* w = &phaseWeight[p * taps];
+        float total = 0.f;
+        for (size_t k = 0; k < taps; ++k)
+        {
+            w[k] = kernel(static_cast<float>((double(first + ptrdiff_t(k)) - center) / double(scale)));
+            total += w[k];
+        }
+
+        if (total != 0.f)
+        {
+            for (size_t k = 0; k < taps; ++k)
+            {
+                w[k] /= total;
+            }
+        }
+    }
+
+    const ptrdiff_t n = static_cast<ptrdiff_t>(source);
+
+    for (size_t u = 0; u < dest; ++u)
+    {
+        const size_t p = u % phases;
+        const ptrdiff_t first = phaseStart[p] + ptrdiff_t(u / phases) * step;
+        const float* w = &phaseWeight[p * taps];
+
+        size_t* index = &sf.index[u * taps];
+        float* weight = &sf.weight[u * taps];
+        size_t count = 0;
+
+        for (size_t k = 0; k < taps; ++k)
+        {
+            if (w[k] == 0.f)
+                continue;
+
+            ptrdiff_t i = first + ptrdiff_t(k);
+            if (wrap)
+            {
+                i %= n;
+                if (i < 0)
+                    i += n;
+            }
+            else if (mirror)
+            {
+                const ptrdiff_t period = n * 2;
+                i %= period;
+                if (i < 0)
+                    i += period;
+                if (i >= n)
+                    i = period - 1 - i;
+            }
+            else
+            {
+                i = std::min<ptrdiff_t>(std::max<ptrdiff_t>(i, 0), n - 1);
+            }
+
+            // Taps addressing the same source sample at the edges are merged
+            size_t j = 0;
+            for (; j < count; ++j)
+            {
+                if (index[j] == size_t(i))
+                    break;
+            }
+
+            if (j < count)
+            {
+                weight[j] += w[k];
+            }
+            else
+            {
+                index[count] = size_t(i);
+                weight[count] = w[k];
+                ++count;
+            }
+        }
+
+        sf.count[u] = count;
+    }
+
+    return S_OK;
+}
+
+//-------------------------------------------------------------------------------------
+// Area-averaging filter (equivalent to the WIC Fant scaler)
+//-------------------------------------------------------------------------------------
+
+inline HRESULT _CreateAreaFilter(_In_ size_t source, _In_ size_t dest, _Inout_ SeparableFilter& sf)
+{
+    assert(source > 0);
+    assert(dest > 0);
+
+    // Each destination sample averages the source samples its footprint covers, weighted by the overlap
+    const size_t taps = (source + dest - 1) / dest + 1;
+
+    HRESULT hr = _AllocateSeparableFilter(dest, taps, sf);
+    if (FAILED(hr))
+        return hr;
+
+    for (size_t u = 0; u < dest; ++u)
+    {
+        // Footprint in source units is [u * source, (u + 1) * source) / dest, so integer math keeps the edges exact
+        const size_t start = u * source;
+        const size_t end = start + source;
+
+        size_t* index = &sf.index[u * taps];
+        float* weight = &sf.weight[u * taps];
+        size_t count = 0;
+
+        for (size_t x = start / dest; x * dest < end && x < source; ++x)
+        {
+            const size_t lo = std::max<size_t>(x * dest, start);
+            const size_t hi = std::min<size_t>((x + 1) * dest, end);
+            if (hi <= lo)
+                continue;
+
+            assert(count < taps);
+            index[count] = x;
+            weight[count] = static_cast<float>(double(hi - lo) / double(source));
+            ++count;
+        }
+
+        sf.count[u] = count;
+    }
+
+    return S_OK;
+}
+
+inline HRESULT _CreateSeparableFilter(
+    _In_ size_t source, _In_ size_t dest, _In_ DWORD filter, _In_ bool wrap, _In_ bool mirror,
+    _Inout_ SeparableFilter& sf)
+{
+    assert(source > 0);
+    assert(dest > 0);
+
+    HRESULT hr;
+
+    switch (filter)
+    {
+    case TEX_FILTER_POINT:
+    {
+        hr = _AllocateSeparableFilter(dest, 1, sf);
+        if (FAILED(hr))
+            return hr;
+
+        size_t xinc = (source << 16) / dest;
+
+        size_t sx = 0;
+        for (size_t u = 0; u < dest; ++u)
+        {
+            sf.count[u] = 1;
+            sf.index[u] = sx >> 16;
+            sf.weight[u] = 1.f;
+            sx += xinc;
+        }
+    }
+    break;
+
+    case TEX_FILTER_LINEAR:
+    {
+        hr = _AllocateSeparableFilter(dest, 2, sf);
+        if (FAILED(hr))
+            return hr;
+
+        std::unique_ptr<LinearFilter[]> lf(new (std::nothrow) LinearFilter[dest]);
+        if (!lf)
+            return E_OUTOFMEMORY;
+
+        _CreateLinearFilter(source, dest, wrap, lf.get());
+
+        for (size_t u = 0; u < dest; ++u)
+        {
+            sf.count[u] = 2;
+            sf.index[u * 2] = lf[u].u0;
+            sf.weight[u * 2] = lf[u].weight0;
+            sf.index[u * 2 + 1] = lf[u].u1;
+            sf.weight[u * 2 + 1] = lf[u].weight1;
+        }
+    }
+    break;
+
+    case TEX_FILTER_CUBIC:
+    {
+        hr = _AllocateSeparableFilter(dest, 4, sf);
+        if (FAILED(hr))
+            return hr;
+
+        std::unique_ptr<CubicFilter[]> cf(new (std::nothrow) CubicFilter[dest]);
+        if (!cf)
+            return E_OUTOFMEMORY;
+
+        _CreateCubicFilter(source, dest, wrap, mirror, cf.get());
+
+        for (size_t u = 0; u < dest; ++u)
+        {
+            // Weights of p0...p3 equivalent to CUBIC_INTERPOLATE
+            const float x = cf[u].x;
+            const float x2 = x * x;
+            const float x3 = x2 * x;
+
+            const float w0 = -x / 3.f + x2 / 2.f - x3 / 6.f;
+            const float w2 = x + x2 / 2.f - x3 / 2.f;
+            const float w3 = -x / 6.f + x3 / 6.f;
+
+            sf.count[u] = 4;
+            sf.index[u * 4] = cf[u].u0;
+            sf.index[u * 4 + 1] = cf[u].u1;
+            sf.index[u * 4 + 2] = cf[u].u2;
+            sf.index[u * 4 + 3] = cf[u].u3;
+            sf.weight[u * 4] = w0;
+            sf.weight[u * 4 + 1] = 1.f - w0 - w2 - w3;
+            sf.weight[u * 4 + 2] = w2;
+            sf.weight[u * 4 + 3] = w3;
+        }
+    }
+    break;
+
+    case TEX_FILTER_TRIANGLE:
+    {
+        using namespace TriangleFilter;
+
+        std::unique_ptr<Filter> tf;
+        hr = _Create(source, dest, wrap, tf);
+        if (FAILED(hr))
+            return hr;
+
+        auto fromEnd = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(tf.get()) + tf->sizeInBytes);
+
+        // The triangle filter is built as source -> destination scatter lists, so invert it
+        std::unique_ptr<size_t[]> counts(new (std::nothrow) size_t[dest]);
+        if (!counts)
+            return E_OUTOFMEMORY;
+
+        memset(counts.get(), 0, sizeof(size_t) * dest);
+
+        for (auto from = tf->from; from < fromEnd; )
+        {
+            for (size_t j = 0; j < from->count; ++j)
+            {
+                assert(from->to[j].u < dest);
+                ++counts[from->to[j].u];
+            }
+
+            from = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(from) + from->sizeInBytes);
+        }
+
+        size_t taps = 1;
+        for (size_t u = 0; u < dest; ++u)
+        {
+            taps = std::max<size_t>(taps, counts[u]);
+        }
+
+        hr = _AllocateSeparableFilter(dest, taps, sf);
+        if (FAILED(hr))
+            return hr;
+
+        size_t x = 0;
+        for (auto from = tf->from; from < fromEnd; ++x)
+        {
+            for (size_t j = 0; j < from->count; ++j)
+            {
+                size_t u = from->to[j].u;
+                size_t k = sf.count[u]++;
+                sf.index[u * taps + k] = x;
+                sf.weight[u * taps + k] = from->to[j].weight;
+            }
+
+            from = reinterpret_cast<const FilterFrom*>(reinterpret_cast<const uint8_t*>(from) + from->sizeInBytes);
+        }
+    }
+    break;
+
+    case TEX_FILTER_FANT:
+        return _CreateAreaFilter(source, dest, sf);
+
+    case TEX_FILTER_LANCZOS3:
+        return _CreateWindowedFilter(source, dest, 3.f, _Lanczos3, wrap, mirror, sf);
+
+    case TEX_FILTER_MITCHELL:
+        return _CreateWindowedFilter(source, dest, 2.f, _MitchellNetravali, wrap, mirror, sf);
+
+    default:
+        return HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED);
+    }
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Fixed-point weights for integer resizing
+//-------------------------------------------------------------------------------------
+
+const int c_FixedWeightBits = 14;
+const int32_t c_FixedWeightOne = 1 << c_FixedWeightBits;
+
+// Limits that keep both integer passes within 32-bit accumulators and 8-bit results within 1 LSB of
+// the float path: the sum of absolute weights of any sample must be below 1.4, and the rounding error
+// of each weight (at most 2^-15) is only allowed to accumulate over a bounded number of taps.
+const size_t c_MaxFixedTaps = 32;
+const int32_t c_MaxFixedWeightSum = (c_FixedWeightOne * 7) / 5;
+
+inline HRESULT _QuantizeSeparableFilter(_In_ size_t dest, _Inout_ SeparableFilter& sf)
+{
+    // Returns S_FALSE if the kernel can't be represented, in which case the float path must be used
+    assert(dest > 0);
+
+    sf.fixedWeight.reset();
+
+    if (!sf.taps || sf.taps > c_MaxFixedTaps)
+        return S_FALSE;
+
+    std::unique_ptr<int16_t[]> fixedWeight(new (std::nothrow) int16_t[dest * sf.taps]);
+    if (!fixedWeight)
+        return E_OUTOFMEMORY;
+
+    memset(fixedWeight.get(), 0, sizeof(int16_t) * dest * sf.taps);
+
+    for (size_t u = 0; u < dest; ++u)
+    {
+        const float* weight = &sf.weight[u * sf.taps];
+        int16_t* fixed = &fixedWeight[u * sf.taps];
+
+        const size_t count = sf.count[u];
+        if (!count)
+            continue;
+
+        // Round each weight, then put the residual on the largest one so the sum is preserved
+        float total = 0.f;
+        int32_t fixedTotal = 0;
+        size_t largest = 0;
+        for (size_t k = 0; k < count; ++k)
+        {
+            const int32_t w = static_cast<int32_t>(floorf(weight[k] * float(c_FixedWeightOne) + 0.5f));
+            if (w > c_FixedWeightOne || w < -c_FixedWeightOne)
+                return S_FALSE;
+
+            fixed[k] = static_cast<int16_t>(w);
+            total += weight[k];
+            fixedTotal += w;
+
+            if (fabsf(weight[k]) > fabsf(weight[largest]))
+                largest = k;
+        }
+
+        const int32_t adjusted = fixed[largest] + static_cast<int32_t>(floorf(total * float(c_FixedWeightOne) + 0.5f)) - fixedTotal;
+        if (adjusted > c_FixedWeightOne || adjusted < -c_FixedWeightOne)
+            return S_FALSE;
+
+        fixed[largest] = static_cast<int16_t>(adjusted);
+
+        int32_t absTotal = 0;
+        for (size_t k = 0; k < count; ++k)
+        {
+            absTotal += abs(int32_t(fixed[k]));
+        }
+
+        if (absTotal >= c_MaxFixedWeightSum)
+            return S_FALSE;
+    }
+
+    sf.fixedWeight = std::move(fixedWeight);
+
+    return S_OK;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Shared filter cache (thread-safe, size-bounded)
+//-------------------------------------------------------------------------------------
+
+// Returns an immutable table for the given source size, destination size, and addressing, reusing one built by an
+// earlier call if available. Separable filters include fixed-point weights whenever _QuantizeSeparableFilter allows.
+HRESULT __cdecl _GetCachedSeparableFilter(
+    _In_ size_t source, _In_ size_t dest, _In_ DWORD filter, _In_ bool wrap, _In_ bool mirror,
+    _Inout_ std::shared_ptr<const SeparableFilter>& sf);
+
+HRESULT __cdecl _GetCachedTriangleFilter(
+    _In_ size_t source, _In_ size_t dest, _In_ bool wrap,
+    _Inout_ std::shared_ptr<const TriangleFilter::Filter>& tf);
+
 } // namespace DirectX
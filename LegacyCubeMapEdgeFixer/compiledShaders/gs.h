@@ -1,4116 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// POSITION                 0   xyzw        0     NONE   float   xyzw
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_POSITION              0   xyzw        0      POS   float   xyzw
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// SV_RenderTargetArrayIndex     0   x           2  RTINDEX    uint   x   
-//
-// Debug name: 5aac48e5b934c4f8d8da9cb6e8b30d5a.pdb
-gs_5_0
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_input v[3][0].xyzw
-dcl_temps 4
-dcl_inputprimitive triangle 
-dcl_stream m0
-dcl_outputtopology trianglestrip 
-dcl_output_siv o0.xyzw, position
-dcl_output o1.xyz
-dcl_output_siv o2.x, rendertarget_array_index
-dcl_maxout 18
-//
-// Initial variable locations:
-//   m0 <- outStream; 
-//   v[0][0].x <- input[0].position.x; v[0][0].y <- input[0].position.y; v[0][0].z <- input[0].position.z; v[0][0].w <- input[0].position.w; 
-//   v[1][0].x <- input[1].position.x; v[1][0].y <- input[1].position.y; v[1][0].z <- input[1].position.z; v[1][0].w <- input[1].position.w; 
-//   v[2][0].x <- input[2].position.x; v[2][0].y <- input[2].position.y; v[2][0].z <- input[2].position.z; v[2][0].w <- input[2].position.w
-//
-#line 57 "C:\dev\3rdParty\DirectXTex\LegacyCubeMapEdgeFixer\CubeStretcher.fx"
-mov r0.x, l(0)  // r0.x <- f
-mov r0.y, r0.x  // r0.y <- f
-loop 
-  ilt r0.z, r0.y, l(6)
-  breakc_z r0.z
-
-#line 60
-  mov r0.y, r0.y  // r0.y <- output.RTIndex
-
-#line 61
-  mov r0.z, l(0)  // r0.z <- v
-  mov r0.w, r0.z  // r0.w <- v
-  loop 
-    ilt r1.x, r0.w, l(3)
-    breakc_z r1.x
-
-#line 63
-    mov r1.xyzw, v[r0.w + 0][0].xyzw  // r1.x <- p.x; r1.y <- p.y; r1.z <- p.z; r1.w <- p.w
-
-#line 66
-    mov r1.xyzw, r1.xyzw  // r1.x <- output.position.x; r1.y <- output.position.y; r1.z <- output.position.z; r1.w <- output.position.w
-
-#line 67
-    nop 
-    mov r2.x, r0.y
-    mov r3.x, r1.x
-    mov r3.y, r1.y
-
-#line 34
-    switch r2.x
-
-#line 36
-      case l(0)
-
-#line 37
-      mov r3.y, r3.y  // r3.y <- <getVertexDirection return value>.y
-      mov r3.z, -r3.x  // r3.z <- <getVertexDirection return value>.z
-      itof r3.x, l(1)  // r3.x <- <getVertexDirection return value>.x
-      break   // r3.x <- u
-
-#line 38
-      case l(1)
-
-#line 39
-      mov r3.y, r3.y  // r3.y <- <getVertexDirection return value>.y
-      mov r3.z, r3.x  // r3.z <- <getVertexDirection return value>.z
-      itof r3.x, l(-1)  // r3.x <- <getVertexDirection return value>.x
-      break   // r3.x <- u
-
-#line 40
-      case l(2)
-
-#line 41
-      mov r3.x, r3.x  // r3.x <- <getVertexDirection return value>.x
-      mov r3.z, -r3.y  // r3.z <- <getVertexDirection return value>.z
-      itof r3.y, l(1)  // r3.y <- <getVertexDirection return value>.y
-      break   // r3.y <- v
-
-#line 42
-      case l(3)
-
-#line 43
-      mov r3.x, r3.x  // r3.x <- <getVertexDirection return value>.x
-      mov r3.z, r3.y  // r3.z <- <getVertexDirection return value>.z
-      itof r3.y, l(-1)  // r3.y <- <getVertexDirection return value>.y
-      break   // r3.y <- v
-
-#line 44
-      case l(4)
-
-#line 45
-      mov r3.x, r3.x  // r3.x <- <getVertexDirection return value>.x
-      mov r3.y, r3.y  // r3.y <- <getVertexDirection return value>.y
-      itof r3.z, l(1)  // r3.z <- <getVertexDirection return value>.z
-      break 
-
-#line 46
-      case l(5)
-
-#line 47
-      mov r3.x, -r3.x  // r3.x <- <getVertexDirection return value>.x
-      mov r3.y, r3.y  // r3.y <- <getVertexDirection return value>.y
-      itof r3.z, l(-1)  // r3.z <- <getVertexDirection return value>.z
-      break   // r3.x <- u
-
-#line 48
-      default 
-
-#line 49
-      itof r3.xyz, l(0, 0, 0, 0)  // r3.y <- <getVertexDirection return value>.y; r3.z <- <getVertexDirection return value>.z; r3.x <- <getVertexDirection return value>.x
-      break   // r3.x <- u; r3.y <- v
-
-#line 50
-    endswitch   // r3.y <- <getVertexDirection return value>.y; r3.z <- <getVertexDirection return value>.z; r3.x <- <getVertexDirection return value>.x
-
-#line 67
-    mov r3.xyz, r3.xyzx  // r3.x <- output.normal.x; r3.y <- output.normal.y; r3.z <- output.normal.z
-
-#line 68
-    mov o0.xyzw, r1.xyzw
-    mov o1.xyz, r3.xyzx
-    mov o2.x, r0.y
-    emit_stream m0
-
-#line 69
-    iadd r0.w, r0.w, l(1)
-  endloop 
-
-#line 70
-  cut_stream m0
-
-#line 71
-  iadd r0.y, r0.y, l(1)
-endloop 
-
-#line 72
-ret 
-// Approximately 63 instruction slots used
-#endif
-
-const BYTE g_gs[] =
-{
-     68,  88,  66,  67, 176,  44, 
-     10, 126, 181, 132,  90,  97, 
-    188, 121, 170, 211, 205, 229, 
-    104, 227,   1,   0,   0,   0, 
-    160,  92,   0,   0,   7,   0, 
-      0,   0,  60,   0,   0,   0, 
-    168,   0,   0,   0, 220,   0, 
-      0,   0, 112,   1,   0,   0, 
-    200,   5,   0,   0, 100,   6, 
-      0,   0, 108,  92,   0,   0, 
-     82,  68,  69,  70, 100,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  60,   0,   0,   0, 
-      0,   5,  83,  71,   5,   1, 
-     64,   0,  60,   0,   0,   0, 
-     82,  68,  49,  49,  60,   0, 
-      0,   0,  24,   0,   0,   0, 
-     32,   0,   0,   0,  40,   0, 
-      0,   0,  36,   0,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-     73,  83,  71,  78,  44,   0, 
-      0,   0,   1,   0,   0,   0, 
-      8,   0,   0,   0,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-     15,  15,   0,   0,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-      0, 171, 171, 171,  79,  83, 
-     71,  53, 140,   0,   0,   0, 
-      3,   0,   0,   0,   8,   0, 
-      0,   0,   0,   0,   0,   0, 
-     92,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,  15,   0,   0,   0, 
-      0,   0,   0,   0, 104,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-      7,   8,   0,   0,   0,   0, 
-      0,   0, 111,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-      2,   0,   0,   0,   1,  14, 
-      0,   0,  83,  86,  95,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,   0,  78,  79,  82,  77, 
-     65,  76,   0,  83,  86,  95, 
-     82, 101, 110, 100, 101, 114, 
-     84,  97, 114, 103, 101, 116, 
-     65, 114, 114,  97, 121,  73, 
-    110, 100, 101, 120,   0, 171, 
-    171, 171,  83,  72,  69,  88, 
-     80,   4,   0,   0,  80,   0, 
-      2,   0,  20,   1,   0,   0, 
-    106, 136,   0,   1,  95,   0, 
-      0,   4, 242,  16,  32,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0, 104,   0,   0,   2, 
-      4,   0,   0,   0,  93,  24, 
-      0,   1, 143,   0,   0,   3, 
-      0,   0,  17,   0,   0,   0, 
-      0,   0,  92,  40,   0,   1, 
-    103,   0,   0,   4, 242,  32, 
-     16,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 101,   0, 
-      0,   3, 114,  32,  16,   0, 
-      1,   0,   0,   0, 103,   0, 
-      0,   4,  18,  32,  16,   0, 
-      2,   0,   0,   0,   4,   0, 
-      0,   0,  94,   0,   0,   2, 
-     18,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  48,   0,   0,   1, 
-     34,   0,   0,   7,  66,   0, 
-     16,   0,   0,   0,   0,   0, 
-     26,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      6,   0,   0,   0,   3,   0, 
-      0,   3,  42,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      0,   0,   0,   0,  26,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  66,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  42,   0,  16,   0, 
-      0,   0,   0,   0,  48,   0, 
-      0,   1,  34,   0,   0,   7, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   3,   0,   0,   0, 
-      3,   0,   0,   3,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   7, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  30, 160,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,   0,   1,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      1,   0,   0,   0,  76,   0, 
-      0,   3,  10,   0,  16,   0, 
-      2,   0,   0,   0,   6,   0, 
-      0,   3,   1,  64,   0,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   6,  66,   0, 
-     16,   0,   3,   0,   0,   0, 
-     10,   0,  16, 128,  65,   0, 
-      0,   0,   3,   0,   0,   0, 
-     43,   0,   0,   5,  18,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   1, 
-      6,   0,   0,   3,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,   0,  16,   0,   3,   0, 
-      0,   0,  10,   0,  16,   0, 
-      3,   0,   0,   0,  43,   0, 
-      0,   5,  18,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0, 255, 255, 255, 255, 
-      2,   0,   0,   1,   6,   0, 
-      0,   3,   1,  64,   0,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   6,  66,   0, 
-     16,   0,   3,   0,   0,   0, 
-     26,   0,  16, 128,  65,   0, 
-      0,   0,   3,   0,   0,   0, 
-     43,   0,   0,   5,  34,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   1, 
-      6,   0,   0,   3,   1,  64, 
-      0,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  43,   0, 
-      0,   5,  34,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0, 255, 255, 255, 255, 
-      2,   0,   0,   1,   6,   0, 
-      0,   3,   1,  64,   0,   0, 
-      4,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  43,   0,   0,   5, 
-     66,   0,  16,   0,   3,   0, 
-      0,   0,   1,  64,   0,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   1,   6,   0,   0,   3, 
-      1,  64,   0,   0,   5,   0, 
-      0,   0,  54,   0,   0,   6, 
-     18,   0,  16,   0,   3,   0, 
-      0,   0,  10,   0,  16, 128, 
-     65,   0,   0,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  43,   0, 
-      0,   5,  66,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0, 255, 255, 255, 255, 
-      2,   0,   0,   1,  10,   0, 
-      0,   1,  43,   0,   0,   8, 
-    114,   0,  16,   0,   3,   0, 
-      0,   0,   2,  64,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   1,  23,   0,   0,   1, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-    242,  32,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 114,  32,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5,  18,  32, 
-     16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   0,   0, 
-      0,   0, 117,   0,   0,   3, 
-      0,   0,  17,   0,   0,   0, 
-      0,   0,  30,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     22,   0,   0,   1, 118,   0, 
-      0,   3,   0,   0,  17,   0, 
-      0,   0,   0,   0,  30,   0, 
-      0,   7,  34,   0,  16,   0, 
-      0,   0,   0,   0,  26,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   1,   0, 
-      0,   0,  22,   0,   0,   1, 
-     62,   0,   0,   1,  83,  84, 
-     65,  84, 148,   0,   0,   0, 
-     63,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      4,   0,   0,   0,   3,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,   8,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  20,   0, 
-      0,   0,   0,   0,   0,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      5,   0,   0,   0,  18,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  83,  80, 
-     68,  66,   0,  86,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  67,  47, 
-     67,  43,  43,  32,  77,  83, 
-     70,  32,  55,  46,  48,  48, 
-     13,  10,  26,  68,  83,   0, 
-      0,   0,   0,   2,   0,   0, 
-      2,   0,   0,   0,  43,   0, 
-      0,   0, 212,   0,   0,   0, 
-      0,   0,   0,   0,  42,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 192, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,  56,   0, 
-      0,   0,   0, 248, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-      5,   0,   0,   0,  32,   0, 
-      0,   0,  60,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      6,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1,  27,  69, 170,  91, 
-      1,   0,   0,   0,  93, 194, 
-    233,  60, 217,  26, 244,  67, 
-    153, 168, 246, 121, 190, 206, 
-    150, 213,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    114,  97, 121,  73, 110, 100, 
-    101, 120,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  79, 
-    117, 116,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99, 111, 108, 111, 114,  32, 
-     58,  32,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84,  48, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  32, 118, 115,  40,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,  32, 100,  97, 
-    116,  97,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 100,  97, 116,  97,  59, 
-     13,  10, 125,  13,  10,  13, 
-     10, 102, 108, 111,  97, 116, 
-     51,  32, 103, 101, 116,  86, 
-    101, 114, 116, 101, 120,  68, 
-    105, 114, 101,  99, 116, 105, 
-    111, 110,  40, 105, 110, 116, 
-     32, 102,  97,  99, 101,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 117,  44,  32, 102, 108, 
-    111,  97, 116,  32, 118,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 115, 119, 105, 
-    116,  99, 104,  32,  40, 102, 
-     97,  99, 101,  41,  13,  10, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  99,  97, 115, 
-    101,  32,  48,  58,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  43,  49,  44,  32, 
-     43, 118,  44,  32,  45, 117, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     99,  97, 115, 101,  32,  49, 
-     58,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  51,  40,  45, 
-     49,  44,  32,  43, 118,  44, 
-     32,  43, 117,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  99,  97, 115, 
-    101,  32,  50,  58,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  43, 117,  44,  32, 
-     43,  49,  44,  32,  45, 118, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     99,  97, 115, 101,  32,  51, 
-     58,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  51,  40,  43, 
-    117,  44,  32,  45,  49,  44, 
-     32,  43, 118,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  99,  97, 115, 
-    101,  32,  52,  58,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  43, 117,  44,  32, 
-     43, 118, 198,  90,   0,   0, 
-    199, 222,   2,   0, 209, 252, 
-      1,   0, 192, 226,   2,   0, 
-     76, 232,   3,   0, 142,   6, 
-      3,   0,  47,  63,   0,   0, 
-     16,  45,   1,   0, 138, 213, 
-      1,   0,  80, 133,   1,   0, 
-    100, 192,   3,   0,  24, 255, 
-      0,   0, 233,  36,   3,   0, 
-    221,   8,   3,   0, 157, 233, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  84, 101, 
-    120, 116, 117, 114, 101,  67, 
-    117,  98, 101,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     48,  41,  59,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  80, 101, 114, 
-     69, 110, 118, 105, 114, 111, 
-    110, 109, 101, 110, 116,  77, 
-     97, 112,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  48,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 117, 105, 110, 116, 
-     32,  67, 117, 114, 114, 101, 
-    110, 116,  77, 105, 112,  76, 
-    101, 118, 101, 108,  59,  13, 
-     10, 125,  59,  13,  10,  13, 
-     10,  83,  97, 109, 112, 108, 
-    101, 114,  83, 116,  97, 116, 
-    101,  32, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 115,  48,  41,  59, 
-     13,  10,  13,  10, 115, 116, 
-    114, 117,  99, 116,  32,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32, 112, 111, 115, 105, 116, 
-    105, 111, 110,  32,  58,  32, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 112, 111, 115, 105, 
-    116, 105, 111, 110,  32,  58, 
-     32,  83,  86,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 110, 111, 114, 109, 
-     97, 108,  32,  58,  32,  78, 
-     79,  82,  77,  65,  76,  59, 
-     13,  10,  32,  32,  32,  32, 
-    117, 105, 110, 116,  32,  82, 
-     84,  73, 110, 100, 101, 120, 
-     32,  58,  32,  83,  86,  95, 
-     82, 101, 110, 100, 101, 114, 
-     84,  97, 114, 103, 101, 116, 
-     65, 114, 114,  97, 121,  73, 
-    110, 100, 101, 120,  59,  13, 
-     10, 125,  59,  13,  10,  13, 
-     10, 115, 116, 114, 117,  99, 
-    116,  32,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  79, 117, 116,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32,  99, 111, 108, 111, 
-    114,  32,  58,  32,  83,  86, 
-     95,  84,  65,  82,  71,  69, 
-     84,  48,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,  32, 118, 115, 
-     40,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  68,  97, 116,  97,  32, 
-    100,  97, 116,  97,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 100,  97, 116, 
-     97,  59,  13,  10, 125,  13, 
-     10,  13,  10, 102, 108, 111, 
-     97, 116,  51,  32, 103, 101, 
-    116,  86, 101, 114, 116, 101, 
-    120,  68, 105, 114, 101,  99, 
-    116, 105, 111, 110,  40, 105, 
-    110, 116,  32, 102,  97,  99, 
-    101,  44,  32, 102, 108, 111, 
-     97, 116,  32, 117,  44,  32, 
-    102, 108, 111,  97, 116,  32, 
-    118,  41,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 115, 
-    119, 105, 116,  99, 104,  32, 
-     40, 102,  97,  99, 101,  41, 
-     13,  10,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  99, 
-     97, 115, 101,  32,  48,  58, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 102, 108, 111, 
-     97, 116,  51,  40,  43,  49, 
-     44,  32,  43, 118,  44,  32, 
-     45, 117,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  99,  97, 115, 101, 
-     32,  49,  58,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  45,  49,  44,  32,  43, 
-    118,  44,  32,  43, 117,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  99, 
-     97, 115, 101,  32,  50,  58, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 102, 108, 111, 
-     97, 116,  51,  40,  43, 117, 
-     44,  32,  43,  49,  44,  32, 
-     45, 118,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  99,  97, 115, 101, 
-     32,  51,  58,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  43, 117,  44,  32,  45, 
-     49,  44,  32,  43, 118,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  99, 
-     97, 115, 101,  32,  52,  58, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 102, 108, 111, 
-     97, 116,  51,  40,  43, 117, 
-     44,  32,  43, 118,  44,  32, 
-     43,  49,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  99,  97, 115, 101, 
-     32,  53,  58,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  45, 117,  44,  32,  43, 
-    118,  44,  32,  45,  49,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 100, 
-    101, 102,  97, 117, 108, 116, 
-     58,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32,  48,  59, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10, 125,  13,  10, 
-     13,  10,  91, 109,  97, 120, 
-    118, 101, 114, 116, 101, 120, 
-     99, 111, 117, 110, 116,  40, 
-     49,  56,  41,  93,  13,  10, 
-    118, 111, 105, 100,  32, 103, 
-    115,  40, 116, 114, 105,  97, 
-    110, 103, 108, 101,  32,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,  32, 105, 110, 
-    112, 117, 116,  91,  51,  93, 
-     44,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    105, 110, 111, 117, 116,  32, 
-     84, 114, 105,  97, 110, 103, 
-    108, 101,  83, 116, 114, 101, 
-     97, 109,  60,  80, 105, 120, 
-    101, 108,  83, 104,  97, 100, 
-    101, 114,  73, 110, 112, 117, 
-    116,  62,  32, 111, 117, 116, 
-     83, 116, 114, 101,  97, 109, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 102, 111, 
-    114,  32,  40, 105, 110, 116, 
-     32, 102,  32,  61,  32,  48, 
-     59,  32, 102,  32,  60,  32, 
-     54,  59,  32,  43,  43, 102, 
-     41,  13,  10,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,  32, 111, 
-    117, 116, 112, 117, 116,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 111, 117, 
-    116, 112, 117, 116,  46,  82, 
-     84,  73, 110, 100, 101, 120, 
-     32,  61,  32, 102,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 111, 114, 
-     32,  40, 105, 110, 116,  32, 
-    118,  32,  61,  32,  48,  59, 
-     32, 118,  32,  60,  32,  51, 
-     59,  32, 118,  43,  43,  41, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 112,  32,  61,  32, 
-    105, 110, 112, 117, 116,  91, 
-    118,  93,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  47,  47, 111, 117, 
-    116, 112, 117, 116,  46, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  61,  32, 109, 117, 
-    108,  40, 105, 110, 112, 117, 
-    116,  91, 118,  93,  46, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  44,  32,  67, 117,  98, 
-    101,  70,  97,  99, 101,  86, 
-    105, 101, 119,  80, 114, 111, 
-    106,  91, 102,  93,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  47,  47, 111, 117, 
-    116, 112, 117, 116,  46, 110, 
-    111, 114, 109,  97, 108,  32, 
-     61,  32, 109, 117, 108,  40, 
-    102, 108, 111,  97, 116,  52, 
-     40,  48,  44,  32,  48,  44, 
-     32,  49,  44,  32,  48,  41, 
-     44,  32,  67, 117,  98, 101, 
-     70,  97,  99, 101,  86, 105, 
-    101, 119,  80, 114, 111, 106, 
-     91, 102,  93,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 111, 117, 116, 112, 117, 
-    116,  46, 112, 111, 115, 105, 
-    116, 105, 111, 110,  32,  61, 
-     32, 112,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 111, 
-    117, 116, 112, 117, 116,  46, 
-    110, 111, 114, 109,  97, 108, 
-     32,  61,  32, 103, 101, 116, 
-     86, 101, 114, 116, 101, 120, 
-     68, 105, 114, 101,  99, 116, 
-    105, 111, 110,  40, 102,  44, 
-     32, 112,  46, 120,  44,  32, 
-    112,  46, 121,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 111, 117, 116,  83, 116, 
-    114, 101,  97, 109,  46,  65, 
-    112, 112, 101, 110, 100,  40, 
-    111, 117, 116, 112, 117, 116, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    125,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 111, 
-    117, 116,  83, 116, 114, 101, 
-     97, 109,  46,  82, 101, 115, 
-    116,  97, 114, 116,  83, 116, 
-    114, 105, 112,  40,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10, 125,  13,  10, 
-     13,  10, 102, 108, 111,  97, 
-    116,  51,  32, 102, 105, 120, 
-     95,  99, 117,  98, 101,  95, 
-    108, 111, 111, 107, 117, 112, 
-     40, 102, 108, 111,  97, 116, 
-     51,  32, 118,  44,  32, 102, 
-    108, 111,  97, 116,  32,  99, 
-    117,  98, 101,  83, 105, 122, 
-    101,  41,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 101, 
-    112, 115,  32,  61,  32,  49, 
-     32,  45,  32,  49, 101,  45, 
-     54,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  77,  32, 
-     61,  32, 109,  97, 120,  40, 
-    109,  97, 120,  40,  97,  98, 
-    115,  40, 118,  46, 120,  41, 
-     44,  32,  97,  98, 115,  40, 
-    118,  46, 121,  41,  41,  44, 
-     32,  97,  98, 115,  40, 118, 
-     46, 122,  41,  41,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 115,  99,  97, 108, 101, 
-     32,  61,  32,  99, 117,  98, 
-    101,  83, 105, 122, 101,  32, 
-     62,  32,  49,  32,  63,  32, 
-     99, 117,  98, 101,  83, 105, 
-    122, 101,  32,  47,  32,  40, 
-     99, 117,  98, 101,  83, 105, 
-    122, 101,  32,  45,  32,  49, 
-     41,  32,  58,  32,  49,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 118,  32,  47,  61, 
-     32,  77,  59,  13,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40,  97,  98, 115,  40, 118, 
-     46, 120,  41,  32,  60,  61, 
-     32, 101, 112, 115,  41,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 118,  46, 120, 
-     32,  42,  61,  32, 115,  99, 
-     97, 108, 101,  59,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40,  97,  98, 115,  40, 
-    118,  46, 121,  41,  32,  60, 
-     61,  32, 101, 112, 115,  41, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 118,  46, 
-    121,  32,  42,  61,  32, 115, 
-     99,  97, 108, 101,  59,  13, 
-     10,  32,  32,  32,  32, 105, 
-    102,  32,  40,  97,  98, 115, 
-     40, 118,  46, 122,  41,  32, 
-     60,  61,  32, 101, 112, 115, 
-     41,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 118, 
-     46, 122,  32,  42,  61,  32, 
-    115,  99,  97, 108, 101,  59, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  59,  13,  10, 125, 
-     13,  10,  13,  10,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  79, 117, 116, 
-     32, 112, 115,  40,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,  32, 112, 115, 105, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  79, 117, 116, 
-     32, 111, 117, 116, 112, 117, 
-    116,  59,  13,  10,  32,  32, 
-     32,  32,  47,  47, 111, 117, 
-    116, 112, 117, 116,  46,  99, 
-    111, 108, 111, 114,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     52,  40, 112, 115, 105,  46, 
-    110, 111, 114, 109,  97, 108, 
-     32,  42,  32,  48,  46,  53, 
-     32,  43,  32,  48,  46,  53, 
-     44,  32,  49,  41,  59,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47, 111, 117, 116, 112, 117, 
-    116,  46,  99, 111, 108, 111, 
-    114,  32,  61,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 112, 115, 105,  46, 
-    110, 111, 114, 109,  97, 108, 
-     44,  32,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  47,  47, 114, 101, 116, 
-    117, 114, 110,  32, 111, 117, 
-    116, 112, 117, 116,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    119, 105, 100, 116, 104,  44, 
-     32, 104, 101, 105, 103, 104, 
-    116,  44,  32, 109, 105, 112, 
-     67, 111, 117, 110, 116,  59, 
-     13,  10,  32,  32,  32,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  71, 101, 116,  68, 
-    105, 109, 101, 110, 115, 105, 
-    111, 110, 115,  40,  67, 117, 
-    114, 114, 101, 110, 116,  77, 
-    105, 112,  76, 101, 118, 101, 
-    108,  44,  32, 119, 105, 100, 
-    116, 104,  44,  32, 104, 101, 
-    105, 103, 104, 116,  44,  32, 
-    109, 105, 112,  67, 111, 117, 
-    110, 116,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32, 111, 117, 116,  67, 111, 
-    108, 111, 114,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    105, 102,  32,  40, 119, 105, 
-    100, 116, 104,  32,  60,  61, 
-     32,  49,  41,  13,  10,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32,  99,  49,  32, 
-     61,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  76, 101, 
-    118, 101, 108,  40, 105, 110, 
-    112, 117, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  43,  49,  44,  32,  48, 
-     44,  32,  48,  41,  44,  32, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32,  99,  50, 
-     32,  61,  32,  83, 111, 117, 
-    114,  99, 101,  67, 117,  98, 
-    101,  77,  97, 112,  46,  83, 
-     97, 109, 112, 108, 101,  76, 
-    101, 118, 101, 108,  40, 105, 
-    110, 112, 117, 116,  83,  97, 
-    109, 112, 108, 101, 114,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  45,  49,  44,  32, 
-     48,  44,  32,  48,  41,  44, 
-     32,  67, 117, 114, 114, 101, 
-    110, 116,  77, 105, 112,  76, 
-    101, 118, 101, 108,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-     51,  32,  61,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  40,  48,  44,  32, 
-     43,  49,  44,  32,  48,  41, 
-     44,  32,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99,  52,  32,  61,  32,  83, 
-    111, 117, 114,  99, 101,  67, 
-    117,  98, 101,  77,  97, 112, 
-     46,  83,  97, 109, 112, 108, 
-    101,  76, 101, 118, 101, 108, 
-     40, 105, 110, 112, 117, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  51,  40,  48,  44, 
-     32,  45,  49,  44,  32,  48, 
-     41,  44,  32,  67, 117, 114, 
-    114, 101, 110, 116,  77, 105, 
-    112,  76, 101, 118, 101, 108, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32,  99,  53,  32,  61,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40,  48, 
-     44,  32,  48,  44,  32,  43, 
-     49,  41,  44,  32,  67, 117, 
-    114, 114, 101, 110, 116,  77, 
-    105, 112,  76, 101, 118, 101, 
-    108,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32,  99,  54,  32,  61, 
-     32,  83, 111, 117, 114,  99, 
-    101,  67, 117,  98, 101,  77, 
-     97, 112,  46,  83,  97, 109, 
-    112, 108, 101,  76, 101, 118, 
-    101, 108,  40, 105, 110, 112, 
-    117, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  44,  32,  48,  44,  32, 
-     45,  49,  41,  44,  32,  67, 
-    117, 114, 114, 101, 110, 116, 
-     77, 105, 112,  76, 101, 118, 
-    101, 108,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 111, 117, 116,  67, 
-    111, 108, 111, 114,  32,  61, 
-     32,  40,  99,  49,  32,  43, 
-     32,  99,  50,  32,  43,  32, 
-     99,  51,  32,  43,  32,  99, 
-     52,  32,  43,  32,  99,  53, 
-     32,  43,  32,  99,  54,  41, 
-     32,  47,  32,  54,  46,  48, 
-     59,  13,  10,  32,  32,  32, 
-     32, 125,  13,  10,  32,  32, 
-     32,  32, 101, 108, 115, 101, 
-     13,  10,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    101, 110, 118,  68, 105, 102, 
-    102, 117, 115, 101,  67, 111, 
-    111, 114, 100,  32,  61,  32, 
-    102, 105, 120,  95,  99, 117, 
-     98, 101,  95, 108, 111, 111, 
-    107, 117, 112,  40, 112, 115, 
-    105,  46, 110, 111, 114, 109, 
-     97, 108,  44,  32, 119, 105, 
-    100, 116, 104,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 111, 117, 116, 
-     67, 111, 108, 111, 114,  32, 
-     61,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  76, 101, 
-    118, 101, 108,  40, 105, 110, 
-    112, 117, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    101, 110, 118,  68, 105, 102, 
-    102, 117, 115, 101,  67, 111, 
-    111, 114, 100,  44,  32,  67, 
-    117, 114, 114, 101, 110, 116, 
-     77, 105, 112,  76, 101, 118, 
-    101, 108,  41,  59,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32,  71,  97, 
-    109, 109,  97,  32,  99, 111, 
-    114, 114, 101,  99, 116,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32, 111, 117, 116,  67, 
-    111, 108, 111, 114,  46, 114, 
-    103,  98,  32,  61,  32, 112, 
-    111, 119,  40, 111, 117, 116, 
-     67, 111, 108, 111, 114,  46, 
-    114, 103,  98,  44,  32,  49, 
-     46,  48, 102,  32,  47,  32, 
-     50,  46,  50, 102,  41,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 111, 117, 116, 112, 
-    117, 116,  46,  99, 111, 108, 
-    111, 114,  32,  61,  32, 111, 
-    117, 116,  67, 111, 108, 111, 
-    114,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 111, 
-    117, 116, 112, 117, 116,  59, 
-     13,  10, 125,  13,  10,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0, 242,  13,   0,   0, 
-      0,  67,  58,  92, 100, 101, 
-    118,  92,  51, 114, 100,  80, 
-     97, 114, 116, 121,  92,  68, 
-    105, 114, 101,  99, 116,  88, 
-     84, 101, 120,  92,  76, 101, 
-    103,  97,  99, 121,  67, 117, 
-     98, 101,  77,  97, 112,  69, 
-    100, 103, 101,  70, 105, 120, 
-    101, 114,  92,  67, 117,  98, 
-    101,  83, 116, 114, 101, 116, 
-     99, 104, 101, 114,  46, 102, 
-    120,   0,   0,  99,  58,  92, 
-    100, 101, 118,  92,  51, 114, 
-    100, 112,  97, 114, 116, 121, 
-     92, 100, 105, 114, 101,  99, 
-    116, 120, 116, 101, 120,  92, 
-    108, 101, 103,  97,  99, 121, 
-     99, 117,  98, 101, 109,  97, 
-    112, 101, 100, 103, 101, 102, 
-    105, 120, 101, 114,  92,  99, 
-    117,  98, 101, 115, 116, 114, 
-    101, 116,  99, 104, 101, 114, 
-     46, 102, 120,   0,  84, 101, 
-    120, 116, 117, 114, 101,  67, 
-    117,  98, 101,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     48,  41,  59,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  80, 101, 114, 
-     69, 110, 118, 105, 114, 111, 
-    110, 109, 101, 110, 116,  77, 
-     97, 112,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  48,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 117, 105, 110, 116, 
-     32,  67, 117, 114, 114, 101, 
-    110, 116,  77, 105, 112,  76, 
-    101, 118, 101, 108,  59,  13, 
-     10, 125,  59,  13,  10,  13, 
-     10,  83,  97, 109, 112, 108, 
-    101, 114,  83, 116,  97, 116, 
-    101,  32, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 115,  48,  41,  59, 
-     13,  10,  13,  10, 115, 116, 
-    114, 117,  99, 116,  32,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32, 112, 111, 115, 105, 116, 
-    105, 111, 110,  32,  58,  32, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 112, 111, 115, 105, 
-    116, 105, 111, 110,  32,  58, 
-     32,  83,  86,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 110, 111, 114, 109, 
-     97, 108,  32,  58,  32,  78, 
-     79,  82,  77,  65,  76,  59, 
-     13,  10,  32,  32,  32,  32, 
-    117, 105, 110, 116,  32,  82, 
-     84,  73, 110, 100, 101, 120, 
-     32,  58,  32,  83,  86,  95, 
-     82, 101, 110, 100, 101, 114, 
-     84,  97, 114, 103, 101, 116, 
-     65, 114,  27, 226,  48,   1, 
-    128,   0,   0,   0, 166, 213, 
-     13, 119, 219,  84, 212,   1, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   0,  69,   0,   0,   0, 
-     40,   0,   0,   0,  27, 226, 
-     48,   1, 128,  80,  96,  86, 
-    105,  13,   0,   0,   1,   0, 
-      0,   0,  68,   0,   0,   0, 
-     69,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  66,   0,  60,  17, 
-     16,   1,   0,   0,   0,   1, 
-     10,   0,   1,   0,  12,   0, 
-    238,  66,  10,   0,   1,   0, 
-     12,   0, 238,  66,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  40,  82,  41,  32, 
-     72,  76,  83,  76,  32,  83, 
-    104,  97, 100, 101, 114,  32, 
-     67, 111, 109, 112, 105, 108, 
-    101, 114,  32,  49,  48,  46, 
-     49,   0,   0,   0,  54,   0, 
-     61,  17,   1, 104, 108, 115, 
-    108,  70, 108,  97, 103, 115, 
-      0,  48, 120,  52,  48,  48, 
-     48,  48,  53,   0, 104, 108, 
-    115, 108,  84,  97, 114, 103, 
-    101, 116,   0, 103, 115,  95, 
-     53,  95,  48,   0, 104, 108, 
-    115, 108,  69, 110, 116, 114, 
-    121,   0, 103, 115,   0,   0, 
-     42,   0,  16,  17,   0,   0, 
-      0,   0, 216,   7,   0,   0, 
-      0,   0,   0,   0, 228,   3, 
-      0,   0,   0,   0,   0,   0, 
-    228,   3,   0,   0,  10,  16, 
-      0,   0, 108,   0,   0,   0, 
-      1,   0, 160, 103, 115,   0, 
-      0,   0,  50,   0,  62,  17, 
-      7,  16,   0,   0,   1,   0, 
-    111, 117, 116,  83, 116, 114, 
-    101,  97, 109,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,  16,   0, 
-      1,   0,   0,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-    228,   3,   0,   0,   0,   0, 
-     46,   0,  62,  17,  11,  16, 
-      0,   0,   9,   0, 105, 110, 
-    112, 117, 116,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,  80,  17,   1,   0, 
-      6,   0,   0,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-    228,   3,   0,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   1,   0,   6,   0, 
-      4,   0,   4,   0, 108,   0, 
-      0,   0,   1,   0, 228,   3, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0,  26,   0,  80,  17, 
-      1,   0,   6,   0,   8,   0, 
-      4,   0, 108,   0,   0,   0, 
-      1,   0, 228,   3,   8,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,  80,  17,   1,   0, 
-      6,   0,  12,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-    228,   3,  12,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   1,   0,   6,   0, 
-     16,   0,   4,   0, 108,   0, 
-      0,   0,   1,   0, 228,   3, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,  26,   0,  80,  17, 
-      1,   0,   6,   0,  20,   0, 
-      4,   0, 108,   0,   0,   0, 
-      1,   0, 228,   3,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-     26,   0,  80,  17,   1,   0, 
-      6,   0,  24,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-    228,   3,   8,   0,   0,   0, 
-      1,   0,   0,   0,  26,   0, 
-     80,  17,   1,   0,   6,   0, 
-     28,   0,   4,   0, 108,   0, 
-      0,   0,   1,   0, 228,   3, 
-     12,   0,   0,   0,   1,   0, 
-      0,   0,  26,   0,  80,  17, 
-      1,   0,   6,   0,  32,   0, 
-      4,   0, 108,   0,   0,   0, 
-      1,   0, 228,   3,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-     26,   0,  80,  17,   1,   0, 
-      6,   0,  36,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-    228,   3,   4,   0,   0,   0, 
-      2,   0,   0,   0,  26,   0, 
-     80,  17,   1,   0,   6,   0, 
-     40,   0,   4,   0, 108,   0, 
-      0,   0,   1,   0, 228,   3, 
-      8,   0,   0,   0,   2,   0, 
-      0,   0,  26,   0,  80,  17, 
-      1,   0,   6,   0,  44,   0, 
-      4,   0, 108,   0,   0,   0, 
-      1,   0, 228,   3,  12,   0, 
-      0,   0,   2,   0,   0,   0, 
-     42,   0,  62,  17, 116,   0, 
-      0,   0,   0,   0, 102,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 128,   0,   0,   0, 
-      1,   0,  20,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 188,   3,   4,   0, 
-      0,   0,  46,   0,  62,  17, 
-      6,  16,   0,   0,   8,   0, 
-    111, 117, 116, 112, 117, 116, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  28,   0, 
-      4,   0, 212,   0,   0,   0, 
-      1,   0, 120,   3,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  88,   1,   0,   0, 
-      1,   0, 200,   2,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  88,   1,   0,   0, 
-      1,   0, 200,   2,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  88,   1,   0,   0, 
-      1,   0, 200,   2,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0,  88,   1,   0,   0, 
-      1,   0, 200,   2,  28,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  16,   0, 
-      4,   0, 184,   3,   0,   0, 
-      1,   0, 104,   0,  48,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  20,   0, 
-      4,   0, 184,   3,   0,   0, 
-      1,   0, 104,   0,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  24,   0, 
-      4,   0, 184,   3,   0,   0, 
-      1,   0, 104,   0,  56,   0, 
-      0,   0,  42,   0,  62,  17, 
-    116,   0,   0,   0,   0,   0, 
-    118,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 232,   0, 
-      0,   0,   1,   0,  20,   0, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 252,   0, 
-      0,   0,   1,   0,  80,   3, 
-     12,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 112,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     68,   1,   0,   0,   1,   0, 
-    220,   2,  16,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     68,   1,   0,   0,   1,   0, 
-    220,   2,  20,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     68,   1,   0,   0,   1,   0, 
-    220,   2,  24,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  12,   0,   4,   0, 
-     68,   1,   0,   0,   1,   0, 
-    220,   2,  28,   0,   0,   0, 
-     86,   1,  77,  17, 128,   0, 
-      0,   0, 212,   7,   0,   0, 
-      0,  16,   0,   0,   7,   0, 
-      9,   5,  13,  17,   6,   2, 
-      3, 129,  44,   9,   9,  13, 
-     15,  11,  76,   9,  13,  13, 
-     38,  11,  44,   9,   9,  13, 
-     15,   6,   2,   3,  68,   9, 
-     13,  13,  38,  11,  44,   9, 
-      9,  13,  15,   6,   2,   3, 
-     64,   9,  13,  13,  38,  11, 
-     44,   9,   9,  13,  15,   6, 
-      2,   3,  68,   9,  13,  13, 
-     38,  11,  44,   9,   9,  13, 
-     15,   6,   2,   3,  64,   9, 
-     13,  13,  38,  11,  44,   9, 
-      9,  13,  15,   6,   2,   3, 
-     64,   9,  13,  13,  38,  11, 
-     44,   9,   9,  13,  16,   6, 
-      2,   3,  68,   9,  13,  13, 
-     21,  11,  36,   9,   5,  13, 
-      5,   6,   2,  12,   4,  36, 
-      8,   0,  13,  17,   1, 129, 
-    152,   6,  33,   3,   0,   9, 
-      9,  13,  15,  11,  76,   9, 
-     31,  13,  32,  11,  44,   9, 
-     35,  13,  36,   3,  20,   9, 
-     20,  13,  37,   3,  24,   9, 
-     13,  13,  38,   3,  20,   9, 
-      9,  13,  15,  11,  36,   9, 
-     31,  13,  32,  11,  44,   9, 
-     35,  13,  36,   3,  20,   9, 
-     20,  13,  37,   3,  20,   9, 
-     13,  13,  38,   3,  20,   9, 
-      9,  13,  15,  11,  36,   9, 
-     27,  13,  28,  11,  44,   9, 
-     35,  13,  36,   3,  20,   9, 
-     20,  13,  37,   3,  24,   9, 
-     13,  13,  38,   3,  20,   9, 
-      9,  13,  15,  11,  36,   9, 
-     27,  13,  28,  11,  44,   9, 
-     35,  13,  36,   3,  20,   9, 
-     20,  13,  37,   3,  20,   9, 
-     13,  13,  38,   3,  20,   9, 
-      9,  13,  15,  11,  36,   9, 
-     27,  13,  28,  11,  44,   9, 
-     31,  13,  32,   3,  20,   9, 
-     20,  13,  37,   3,  20,   9, 
-     13,  13,  38,   3,  20,   9, 
-      9,  13,  15,  11,  36,   9, 
-     27,  13,  28,  11,  44,   9, 
-     31,  13,  32,   3,  24,   9, 
-     20,  13,  37,   3,  20,   9, 
-     13,  13,  38,   3,  20,   9, 
-      9,  13,  16,  11,  36,   9, 
-     13,  13,  21,  11,  36,   9, 
-      5,  13,   5,   6,   2,  12, 
-      4,  36,  74,   0,  62,  17, 
-     13,  16,   0,   0, 136,   0, 
-     60, 103, 101, 116,  86, 101, 
-    114, 116, 101, 120,  68, 105, 
-    114, 101,  99, 116, 105, 111, 
-    110,  32, 114, 101, 116, 117, 
-    114, 110,  32, 118,  97, 108, 
-    117, 101,  62,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     50,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    196,   1,   0,   0,   1,   0, 
-    244,   1,  48,   0,  32,   0, 
-    124,   0,  76,   0, 204,   0, 
-     72,   0,  24,   1,  52,   0, 
-    100,   1,  56,   0, 180,   1, 
-     36,   0, 220,   1,   4,   0, 
-     52,   0,   0,   0,  50,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 220,   1, 
-      0,   0,   1,   0, 220,   1, 
-     24,   0,  52,   0, 100,   0, 
-     56,   0, 180,   0,  52,   0, 
-      0,   1,  72,   0,  76,   1, 
-     76,   0, 156,   1,  36,   0, 
-    196,   1,   4,   0,  56,   0, 
-      0,   0,  50,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 240,   1,   0,   0, 
-      1,   0, 200,   1,   4,   0, 
-     72,   0,  80,   0,  32,   0, 
-    160,   0,  32,   0, 236,   0, 
-     32,   0,  56,   1,  36,   0, 
-    136,   1,  36,   0, 176,   1, 
-      4,   0,  48,   0,   0,   0, 
-     42,   0,  62,  17, 116,   0, 
-      0,   0,   1,   0, 102,  97, 
-     99, 101,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 152,   1,   0,   0, 
-      1,   0,  32,   2,  32,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   1,   0, 
-    117,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  38,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 152,   1, 
-      0,   0,   1,   0,  12,   2, 
-     88,   0,   4,   0, 164,   0, 
-      4,   0, 180,   1,  44,   0, 
-      4,   2,   4,   0,  48,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   1,   0, 
-    118,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  34,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 152,   1, 
-      0,   0,   1,   0,  12,   2, 
-    244,   0,   4,   0,  64,   1, 
-      4,   0,   4,   2,   4,   0, 
-     52,   0,   0,   0,   2,   0, 
-     78,  17,   2,   0,   6,   0, 
-    244,   0,   0,   0,  24,   0, 
-      0,   0,   1,   0,   0,   0, 
-     16,   1,   2,  28, 101,  54, 
-    199, 147, 181, 238,  44, 149, 
-    145, 117, 112, 209, 193,  82, 
-      0,   0, 242,   0,   0,   0, 
-      0,   6,   0,   0,   0,   0, 
-      0,   0,   1,   0,   1,   0, 
-     80,   4,   0,   0,   0,   0, 
-      0,   0, 126,   0,   0,   0, 
-    244,   5,   0,   0, 108,   0, 
-      0,   0,  57,   0,   0, 128, 
-    108,   0,   0,   0,  57,   0, 
-      0,   0, 128,   0,   0,   0, 
-     57,   0,   0, 128, 128,   0, 
-      0,   0,  57,   0,   0,   0, 
-    148,   0,   0,   0,  57,   0, 
-      0, 128, 148,   0,   0,   0, 
-     57,   0,   0,   0, 152,   0, 
-      0,   0,  57,   0,   0, 128, 
-    152,   0,   0,   0,  57,   0, 
-      0,   0, 180,   0,   0,   0, 
-     57,   0,   0, 128, 180,   0, 
-      0,   0,  57,   0,   0,   0, 
-    192,   0,   0,   0,  60,   0, 
-      0, 128, 192,   0,   0,   0, 
-     60,   0,   0,   0, 212,   0, 
-      0,   0,  61,   0,   0, 128, 
-    212,   0,   0,   0,  61,   0, 
-      0,   0, 232,   0,   0,   0, 
-     61,   0,   0, 128, 232,   0, 
-      0,   0,  61,   0,   0,   0, 
-    252,   0,   0,   0,  61,   0, 
-      0, 128, 252,   0,   0,   0, 
-     61,   0,   0,   0,   0,   1, 
-      0,   0,  61,   0,   0, 128, 
-      0,   1,   0,   0,  61,   0, 
-      0,   0,  28,   1,   0,   0, 
-     61,   0,   0, 128,  28,   1, 
-      0,   0,  61,   0,   0,   0, 
-     40,   1,   0,   0,  63,   0, 
-      0, 128,  40,   1,   0,   0, 
-     63,   0,   0,   0,  68,   1, 
-      0,   0,  66,   0,   0, 128, 
-     68,   1,   0,   0,  66,   0, 
-      0,   0,  88,   1,   0,   0, 
-     67,   0,   0, 128,  88,   1, 
-      0,   0,  67,   0,   0,   0, 
-     92,   1,   0,   0,  67,   0, 
-      0, 128,  92,   1,   0,   0, 
-     67,   0,   0,   0, 112,   1, 
-      0,   0,  67,   0,   0, 128, 
-    112,   1,   0,   0,  67,   0, 
-      0,   0, 132,   1,   0,   0, 
-     67,   0,   0, 128, 132,   1, 
-      0,   0,  67,   0,   0,   0, 
-    152,   1,   0,   0,  67,   0, 
-      0, 128, 152,   1,   0,   0, 
-     67,   0,   0,   0, 164,   1, 
-      0,   0,  67,   0,   0, 128, 
-    164,   1,   0,   0,  67,   0, 
-      0,   0, 176,   1,   0,   0, 
-     67,   0,   0, 128, 176,   1, 
-      0,   0,  67,   0,   0,   0, 
-    196,   1,   0,   0,  67,   0, 
-      0, 128, 196,   1,   0,   0, 
-     67,   0,   0,   0, 220,   1, 
-      0,   0,  67,   0,   0, 128, 
-    220,   1,   0,   0,  67,   0, 
-      0,   0, 240,   1,   0,   0, 
-     67,   0,   0, 128, 240,   1, 
-      0,   0,  67,   0,   0,   0, 
-    244,   1,   0,   0,  67,   0, 
-      0, 128, 244,   1,   0,   0, 
-     67,   0,   0,   0,   0,   2, 
-      0,   0,  67,   0,   0, 128, 
-      0,   2,   0,   0,  67,   0, 
-      0,   0,  20,   2,   0,   0, 
-     67,   0,   0, 128,  20,   2, 
-      0,   0,  67,   0,   0,   0, 
-     40,   2,   0,   0,  67,   0, 
-      0, 128,  40,   2,   0,   0, 
-     67,   0,   0,   0,  60,   2, 
-      0,   0,  67,   0,   0, 128, 
-     60,   2,   0,   0,  67,   0, 
-      0,   0,  64,   2,   0,   0, 
-     67,   0,   0, 128,  64,   2, 
-      0,   0,  67,   0,   0,   0, 
-     76,   2,   0,   0,  67,   0, 
-      0, 128,  76,   2,   0,   0, 
-     67,   0,   0,   0,  96,   2, 
-      0,   0,  67,   0,   0, 128, 
-     96,   2,   0,   0,  67,   0, 
-      0,   0, 120,   2,   0,   0, 
-     67,   0,   0, 128, 120,   2, 
-      0,   0,  67,   0,   0,   0, 
-    140,   2,   0,   0,  67,   0, 
-      0, 128, 140,   2,   0,   0, 
-     67,   0,   0,   0, 144,   2, 
-      0,   0,  67,   0,   0, 128, 
-    144,   2,   0,   0,  67,   0, 
-      0,   0, 156,   2,   0,   0, 
-     67,   0,   0, 128, 156,   2, 
-      0,   0,  67,   0,   0,   0, 
-    176,   2,   0,   0,  67,   0, 
-      0, 128, 176,   2,   0,   0, 
-     67,   0,   0,   0, 196,   2, 
-      0,   0,  67,   0,   0, 128, 
-    196,   2,   0,   0,  67,   0, 
-      0,   0, 216,   2,   0,   0, 
-     67,   0,   0, 128, 216,   2, 
-      0,   0,  67,   0,   0,   0, 
-    220,   2,   0,   0,  67,   0, 
-      0, 128, 220,   2,   0,   0, 
-     67,   0,   0,   0, 232,   2, 
-      0,   0,  67,   0,   0, 128, 
-    232,   2,   0,   0,  67,   0, 
-      0,   0, 252,   2,   0,   0, 
-     67,   0,   0, 128, 252,   2, 
-      0,   0,  67,   0,   0,   0, 
-     16,   3,   0,   0,  67,   0, 
-      0, 128,  16,   3,   0,   0, 
-     67,   0,   0,   0,  36,   3, 
-      0,   0,  67,   0,   0, 128, 
-     36,   3,   0,   0,  67,   0, 
-      0,   0,  40,   3,   0,   0, 
-     67,   0,   0, 128,  40,   3, 
-      0,   0,  67,   0,   0,   0, 
-     52,   3,   0,   0,  67,   0, 
-      0, 128,  52,   3,   0,   0, 
-     67,   0,   0,   0,  76,   3, 
-      0,   0,  67,   0,   0, 128, 
-     76,   3,   0,   0,  67,   0, 
-      0,   0,  96,   3,   0,   0, 
-     67,   0,   0, 128,  96,   3, 
-      0,   0,  67,   0,   0,   0, 
-    116,   3,   0,   0,  67,   0, 
-      0, 128, 116,   3,   0,   0, 
-     67,   0,   0,   0, 120,   3, 
-      0,   0,  67,   0,   0, 128, 
-    120,   3,   0,   0,  67,   0, 
-      0,   0, 124,   3,   0,   0, 
-     67,   0,   0, 128, 124,   3, 
-      0,   0,  67,   0,   0,   0, 
-    156,   3,   0,   0,  67,   0, 
-      0, 128, 156,   3,   0,   0, 
-     67,   0,   0,   0, 160,   3, 
-      0,   0,  67,   0,   0, 128, 
-    160,   3,   0,   0,  67,   0, 
-      0,   0, 164,   3,   0,   0, 
-     67,   0,   0, 128, 164,   3, 
-      0,   0,  67,   0,   0,   0, 
-    184,   3,   0,   0,  68,   0, 
-      0, 128, 184,   3,   0,   0, 
-     68,   0,   0,   0, 204,   3, 
-      0,   0,  68,   0,   0, 128, 
-    204,   3,   0,   0,  68,   0, 
-      0,   0, 224,   3,   0,   0, 
-     68,   0,   0, 128, 224,   3, 
-      0,   0,  68,   0,   0,   0, 
-    244,   3,   0,   0,  68,   0, 
-      0, 128, 244,   3,   0,   0, 
-     68,   0,   0,   0,   0,   4, 
-      0,   0,  69,   0,   0, 128, 
-      0,   4,   0,   0,  61,   0, 
-      0,   0,  28,   4,   0,   0, 
-     69,   0,   0, 128,  28,   4, 
-      0,   0,  69,   0,   0,   0, 
-     32,   4,   0,   0,  70,   0, 
-      0, 128,  32,   4,   0,   0, 
-     70,   0,   0,   0,  44,   4, 
-      0,   0,  71,   0,   0, 128, 
-     44,   4,   0,   0,  57,   0, 
-      0,   0,  72,   4,   0,   0, 
-     71,   0,   0, 128,  72,   4, 
-      0,   0,  71,   0,   0,   0, 
-     76,   4,   0,   0,  72,   0, 
-      0, 128,  76,   4,   0,   0, 
-     72,   0,   0,   0,   5,   0, 
-     31,   0,  14,   0,  18,   0, 
-      5,   0,  31,   0,   5,   0, 
-     31,   0,   5,   0,  31,   0, 
-      5,   0,  31,   0,   5,   0, 
-     31,   0,  21,   0,  25,   0, 
-      5,   0,  31,   0,  21,   0, 
-     25,   0,   9,   0,  27,   0, 
-      9,   0,  26,   0,   9,   0, 
-     35,   0,  18,   0,  22,   0, 
-      9,   0,  35,   0,   9,   0, 
-     35,   0,   9,   0,  35,   0, 
-      9,   0,  35,   0,   9,   0, 
-     35,   0,  25,   0,  29,   0, 
-      9,   0,  35,   0,  25,   0, 
-     29,   0,  13,   0,  41,   0, 
-     20,   0,  40,   0,  13,   0, 
-     32,   0,  13,   0,  31,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  29,   0, 
-     59,   0,  13,   0,  60,   0, 
-     29,   0,  59,   0,  13,   0, 
-     60,   0,  29,   0,  59,   0, 
-     13,   0,  60,   0,  13,   0, 
-     59,   0,  13,   0,  37,   0, 
-     13,   0,  36,   0,  13,   0, 
-     37,   0,  13,   0,  36,   0, 
-     13,   0,  37,   0,  13,   0, 
-     36,   0,  13,   0,  37,   0, 
-     13,   0,  36,   0,   9,   0, 
-      9,   0,  32,   0,  34,   0, 
-      9,   0,   9,   0,   9,   0, 
-      9,   0,   9,   0,  33,   0, 
-      9,   0,  32,   0,   5,   0, 
-      5,   0,  28,   0,  30,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   1,   0,   1,   0, 
-      1,   0,   1,   0, 246,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     33,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  15,  16,   0,   0, 
-    100,   1,   0,   0,  10,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,  60,   0,   0,   0, 
-     60,   0,   0,   0,   8,   0, 
-      0,   0,  68,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241,  22,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,   0, 241,  38,   0, 
-      5,  21,   1,   0,   0,   0, 
-      1,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,  68,  97, 116,  97, 
-      0, 241,  18,   0,  22,  21, 
-      2,  16,   0,   0,  34,   0, 
-      0,   0,  16,   0,   0,   0, 
-     48,   0,   0, 241,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      3,   0,   0,   0,  12,   0, 
-    102, 108, 111,  97, 116,  51, 
-      0, 243, 242, 241,  62,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,   0, 241,  13,  21, 
-      3,   0,   4,  16,   0,   0, 
-     16,   0, 110, 111, 114, 109, 
-     97, 108,   0, 243, 242, 241, 
-     13,  21,   3,   0, 117,   0, 
-      0,   0,  28,   0,  82,  84, 
-     73, 110, 100, 101, 120,   0, 
-    242, 241,  38,   0,   5,  21, 
-      3,   0,   0,   0,   5,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,   0, 241, 
-     14,   0,  23,  21,   6,  16, 
-      0,   0,  15,   2,  96,   3, 
-      0,   0, 242, 241,  14,   0, 
-      1,  18,   2,   0,   0,   0, 
-      3,  16,   0,   0,   7,  16, 
-      0,   0,  10,   0,  24,  21, 
-      3,   0,   0,   0,   1,   0, 
-      1,   0,  14,   0,   8,  16, 
-      9,  16,   0,   0,  23,   0, 
-      2,   0,   8,  16,   0,   0, 
-     10,   0,  24,  21,   3,  16, 
-      0,   0,   1,   0,   2,   2, 
-     18,   0,   1,  18,   3,   0, 
-      0,   0, 116,   0,   0,   0, 
-     64,   0,   0,   0,  64,   0, 
-      0,   0,  10,   0,  24,  21, 
-      4,  16,   0,   0,   1,   0, 
-      1,   0,  14,   0,   8,  16, 
-     13,  16,   0,   0,  23,   0, 
-      3,   0,  12,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  55,  20, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     44,  32,  43,  49,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  99,  97, 
-    115, 101,  32,  53,  58,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 102, 108, 111,  97, 
-    116,  51,  40,  45, 117,  44, 
-     32,  43, 118,  44,  32,  45, 
-     49,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 100, 101, 102,  97, 117, 
-    108, 116,  58,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-     48,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10, 125, 
-     13,  10,  13,  10,  91, 109, 
-     97, 120, 118, 101, 114, 116, 
-    101, 120,  99, 111, 117, 110, 
-    116,  40,  49,  56,  41,  93, 
-     13,  10, 118, 111, 105, 100, 
-     32, 103, 115,  40, 116, 114, 
-    105,  97, 110, 103, 108, 101, 
-     32,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  68,  97, 116,  97,  32, 
-    105, 110, 112, 117, 116,  91, 
-     51,  93,  44,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 105, 110, 111, 117, 
-    116,  32,  84, 114, 105,  97, 
-    110, 103, 108, 101,  83, 116, 
-    114, 101,  97, 109,  60,  80, 
-    105, 120, 101, 108,  83, 104, 
-     97, 100, 101, 114,  73, 110, 
-    112, 117, 116,  62,  32, 111, 
-    117, 116,  83, 116, 114, 101, 
-     97, 109,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    102, 111, 114,  32,  40, 105, 
-    110, 116,  32, 102,  32,  61, 
-     32,  48,  59,  32, 102,  32, 
-     60,  32,  54,  59,  32,  43, 
-     43, 102,  41,  13,  10,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-     32, 111, 117, 116, 112, 117, 
-    116,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    111, 117, 116, 112, 117, 116, 
-     46,  82,  84,  73, 110, 100, 
-    101, 120,  32,  61,  32, 102, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    111, 114,  32,  40, 105, 110, 
-    116,  32, 118,  32,  61,  32, 
-     48,  59,  32, 118,  32,  60, 
-     32,  51,  59,  32, 118,  43, 
-     43,  41,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32, 112,  32, 
-     61,  32, 105, 110, 112, 117, 
-    116,  91, 118,  93,  46, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-    111, 117, 116, 112, 117, 116, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  32,  61,  32, 
-    109, 117, 108,  40, 105, 110, 
-    112, 117, 116,  91, 118,  93, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  44,  32,  67, 
-    117,  98, 101,  70,  97,  99, 
-    101,  86, 105, 101, 119,  80, 
-    114, 111, 106,  91, 102,  93, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-    111, 117, 116, 112, 117, 116, 
-     46, 110, 111, 114, 109,  97, 
-    108,  32,  61,  32, 109, 117, 
-    108,  40, 102, 108, 111,  97, 
-    116,  52,  40,  48,  44,  32, 
-     48,  44,  32,  49,  44,  32, 
-     48,  41,  44,  32,  67, 117, 
-     98, 101,  70,  97,  99, 101, 
-     86, 105, 101, 119,  80, 114, 
-    111, 106,  91, 102,  93,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 111, 117, 116, 
-    112, 117, 116,  46, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-     32,  61,  32, 112,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 111, 117, 116, 112, 117, 
-    116,  46, 110, 111, 114, 109, 
-     97, 108,  32,  61,  32, 103, 
-    101, 116,  86, 101, 114, 116, 
-    101, 120,  68, 105, 114, 101, 
-     99, 116, 105, 111, 110,  40, 
-    102,  44,  32, 112,  46, 120, 
-     44,  32, 112,  46, 121,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 111, 117, 116, 
-     83, 116, 114, 101,  97, 109, 
-     46,  65, 112, 112, 101, 110, 
-    100,  40, 111, 117, 116, 112, 
-    117, 116,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 125,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 111, 117, 116,  83, 116, 
-    114, 101,  97, 109,  46,  82, 
-    101, 115, 116,  97, 114, 116, 
-     83, 116, 114, 105, 112,  40, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10, 125, 
-     13,  10,  13,  10, 102, 108, 
-    111,  97, 116,  51,  32, 102, 
-    105, 120,  95,  99, 117,  98, 
-    101,  95, 108, 111, 111, 107, 
-    117, 112,  40, 102, 108, 111, 
-     97, 116,  51,  32, 118,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32,  99, 117,  98, 101,  83, 
-    105, 122, 101,  41,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 101, 112, 115,  32,  61, 
-     32,  49,  32,  45,  32,  49, 
-    101,  45,  54,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     77,  32,  61,  32, 109,  97, 
-    120,  40, 109,  97, 120,  40, 
-     97,  98, 115,  40, 118,  46, 
-    120,  41,  44,  32,  97,  98, 
-    115,  40, 118,  46, 121,  41, 
-     41,  44,  32,  97,  98, 115, 
-     40, 118,  46, 122,  41,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 115,  99,  97, 
-    108, 101,  32,  61,  32,  99, 
-    117,  98, 101,  83, 105, 122, 
-    101,  32,  62,  32,  49,  32, 
-     63,  32,  99, 117,  98, 101, 
-     83, 105, 122, 101,  32,  47, 
-     32,  40,  99, 117,  98, 101, 
-     83, 105, 122, 101,  32,  45, 
-     32,  49,  41,  32,  58,  32, 
-     49,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 118,  32, 
-     47,  61,  32,  77,  59,  13, 
-     10,  32,  32,  32,  32, 105, 
-    102,  32,  40,  97,  98, 115, 
-     40, 118,  46, 120,  41,  32, 
-     60,  61,  32, 101, 112, 115, 
-     41,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 118, 
-     46, 120,  32,  42,  61,  32, 
-    115,  99,  97, 108, 101,  59, 
-     13,  10,  32,  32,  32,  32, 
-    105, 102,  32,  40,  97,  98, 
-    115,  40, 118,  46, 121,  41, 
-     32,  60,  61,  32, 101, 112, 
-    115,  41,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    118,  46, 121,  32,  42,  61, 
-     32, 115,  99,  97, 108, 101, 
-     59,  13,  10,  32,  32,  32, 
-     32, 105, 102,  32,  40,  97, 
-     98, 115,  40, 118,  46, 122, 
-     41,  32,  60,  61,  32, 101, 
-    112, 115,  41,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 118,  46, 122,  32,  42, 
-     61,  32, 115,  99,  97, 108, 
-    101,  59,  13,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 118,  59,  13, 
-     10, 125,  13,  10,  13,  10, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  79, 
-    117, 116,  32, 112, 115,  40, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,  32, 112, 
-    115, 105,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  79, 
-    117, 116,  32, 111, 117, 116, 
-    112, 117, 116,  59,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-    111, 117, 116, 112, 117, 116, 
-     46,  99, 111, 108, 111, 114, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  52,  40, 112, 115, 
-    105,  46, 110, 111, 114, 109, 
-     97, 108,  32,  42,  32,  48, 
-     46,  53,  32,  43,  32,  48, 
-     46,  53,  44,  32,  49,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  47,  47, 111, 117, 116, 
-    112, 117, 116,  46,  99, 111, 
-    108, 111, 114,  32,  61,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 112, 115, 
-    105,  46, 110, 111, 114, 109, 
-     97, 108,  44,  32,  67, 117, 
-    114, 114, 101, 110, 116,  77, 
-    105, 112,  76, 101, 118, 101, 
-    108,  41,  59,  13,  10,  32, 
-     32,  32,  32,  47,  47, 114, 
-    101, 116, 117, 114, 110,  32, 
-    111, 117, 116, 112, 117, 116, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 117, 105, 110, 
-    116,  32, 119, 105, 100, 116, 
-    104,  44,  32, 104, 101, 105, 
-    103, 104, 116,  44,  32, 109, 
-    105, 112,  67, 111, 117, 110, 
-    116,  59,  13,  10,  32,  32, 
-     32,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  71, 101, 
-    116,  68, 105, 109, 101, 110, 
-    115, 105, 111, 110, 115,  40, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,  44,  32, 119, 
-    105, 100, 116, 104,  44,  32, 
-    104, 101, 105, 103, 104, 116, 
-     44,  32, 109, 105, 112,  67, 
-    111, 117, 110, 116,  41,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 111, 117, 116, 
-     67, 111, 108, 111, 114,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-    119, 105, 100, 116, 104,  32, 
-     60,  61,  32,  49,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-     49,  32,  61,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  40,  43,  49,  44, 
-     32,  48,  44,  32,  48,  41, 
-     44,  32,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99,  50,  32,  61,  32,  83, 
-    111, 117, 114,  99, 101,  67, 
-    117,  98, 101,  77,  97, 112, 
-     46,  83,  97, 109, 112, 108, 
-    101,  76, 101, 118, 101, 108, 
-     40, 105, 110, 112, 117, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  51,  40,  45,  49, 
-     44,  32,  48,  44,  32,  48, 
-     41,  44,  32,  67, 117, 114, 
-    114, 101, 110, 116,  77, 105, 
-    112,  76, 101, 118, 101, 108, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32,  99,  51,  32,  61,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40,  48, 
-     44,  32,  43,  49,  44,  32, 
-     48,  41,  44,  32,  67, 117, 
-    114, 114, 101, 110, 116,  77, 
-    105, 112,  76, 101, 118, 101, 
-    108,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32,  99,  52,  32,  61, 
-     32,  83, 111, 117, 114,  99, 
-    101,  67, 117,  98, 101,  77, 
-     97, 112,  46,  83,  97, 109, 
-    112, 108, 101,  76, 101, 118, 
-    101, 108,  40, 105, 110, 112, 
-    117, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  44,  32,  45,  49,  44, 
-     32,  48,  41,  44,  32,  67, 
-    117, 114, 114, 101, 110, 116, 
-     77, 105, 112,  76, 101, 118, 
-    101, 108,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32,  99,  53,  32, 
-     61,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  76, 101, 
-    118, 101, 108,  40, 105, 110, 
-    112, 117, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  48,  44,  32,  48,  44, 
-     32,  43,  49,  41,  44,  32, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32,  99,  54, 
-     32,  61,  32,  83, 111, 117, 
-    114,  99, 101,  67, 117,  98, 
-    101,  77,  97, 112,  46,  83, 
-     97, 109, 112, 108, 101,  76, 
-    101, 118, 101, 108,  40, 105, 
-    110, 112, 117, 116,  83,  97, 
-    109, 112, 108, 101, 114,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  48,  44,  32,  48, 
-     44,  32,  45,  49,  41,  44, 
-     32,  67, 117, 114, 114, 101, 
-    110, 116,  77, 105, 112,  76, 
-    101, 118, 101, 108,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 111, 117, 
-    116,  67, 111, 108, 111, 114, 
-     32,  61,  32,  40,  99,  49, 
-     32,  43,  32,  99,  50,  32, 
-     43,  32,  99,  51,  32,  43, 
-     32,  99,  52,  32,  43,  32, 
-     99,  53,  32,  43,  32,  99, 
-     54,  41,  32,  47,  32,  54, 
-     46,  48,  59,  13,  10,  32, 
-     32,  32,  32, 125,  13,  10, 
-     32,  32,  32,  32, 101, 108, 
-    115, 101,  13,  10,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 101, 110, 118,  68, 
-    105, 102, 102, 117, 115, 101, 
-     67, 111, 111, 114, 100,  32, 
-     61,  32, 102, 105, 120,  95, 
-     99, 117,  98, 101,  95, 108, 
-    111, 111, 107, 117, 112,  40, 
-    112, 115, 105,  46, 110, 111, 
-    114, 109,  97, 108,  44,  32, 
-    119, 105, 100, 116, 104,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 111, 
-    117, 116,  67, 111, 108, 111, 
-    114,  32,  61,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 101, 110, 118,  68, 
-    105, 102, 102, 117, 115, 101, 
-     67, 111, 111, 114, 100,  44, 
-     32,  67, 117, 114, 114, 101, 
-    110, 116,  77, 105, 112,  76, 
-    101, 118, 101, 108,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-     71,  97, 109, 109,  97,  32, 
-     99, 111, 114, 114, 101,  99, 
-    116,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32, 111, 117, 
-    116,  67, 111, 108, 111, 114, 
-     46, 114, 103,  98,  32,  61, 
-     32, 112, 111, 119,  40, 111, 
-    117, 116,  67, 111, 108, 111, 
-    114,  46, 114, 103,  98,  44, 
-     32,  49,  46,  48, 102,  32, 
-     47,  32,  50,  46,  50, 102, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 111, 117, 
-    116, 112, 117, 116,  46,  99, 
-    111, 108, 111, 114,  32,  61, 
-     32, 111, 117, 116,  67, 111, 
-    108, 111, 114,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 111, 117, 116, 112, 117, 
-    116,  59,  13,  10, 125,  13, 
-     10,   0,   7,   0,   0,   0, 
-     69,   0,   0,   0,  68,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    136,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     11, 202,  49,   1,  56,   0, 
-      0,   0,   0,  16,   0,   0, 
-      1,  16,   0,   0,  32,   0, 
-      0,   0,  11,   0, 255, 255, 
-      4,   0,   0,   0, 255, 255, 
-      3,   0,   0,   0,   0,   0, 
-      4,   0,   0,   0,   4,   0, 
-      0,   0,   8,   0,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   0,  30,   0,   1,  22, 
-      0,   0,   0,   0,  14,  16, 
-      0,   0, 103, 101, 116,  86, 
-    101, 114, 116, 101, 120,  68, 
-    105, 114, 101,  99, 116, 105, 
-    111, 110,   0, 241,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  68,  51,  68,  83, 
-     72,  68,  82,   0,  80,   4, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  32,   0,   0,  96, 
-      4,   0,   0,   0,   8,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0,  30,   0, 
-      1,  22,   0,   0,   0,   0, 
-     14,  16,   0,   0, 103, 101, 
-    116,  86, 101, 114, 116, 101, 
-    120,  68, 105, 114, 101,  99, 
-    116, 105, 111, 110,   0, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-      8,   0,   0,   0,   8,   2, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,  32,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  18,   0,  37,  17, 
-      0,   0,   0,   0, 128,   0, 
-      0,   0,   1,   0, 103, 115, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 119,   9, 
-     49,   1,   1,   0,   0,   0, 
-     13,   0,  10, 140,  14,   0, 
-    180, 156,  15,   0,  11,   0, 
-     72,   0,   0,   0,  32,   0, 
-      0,   0,  44,   0,   0,   0, 
-     80,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,   0,   0,  25,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,  80,   4, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   9,   0, 220,   7, 
-      0,   0,   0,   0,   0,   0, 
-     64,   6,   0,   0,   1,   0, 
-      0,   0,  16,  50, 197,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 103, 115,   0, 110, 
-    111, 110, 101,   0,  45, 186, 
-     46, 241,   1,   0,   0,   0, 
-      0,   0,   0,   0,  80,   4, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   2,   0,   7,   0, 
-      0,   0,   0,   0,   1,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,  80,   4,   0,   0, 
-      8,   2,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,  67,  58,  92, 100, 
-    101, 118,  92,  51, 114, 100, 
-     80,  97, 114, 116, 121,  92, 
-     68, 105, 114, 101,  99, 116, 
-     88,  84, 101, 120,  92,  76, 
-    101, 103,  97,  99, 121,  67, 
-    117,  98, 101,  77,  97, 112, 
-     69, 100, 103, 101,  70, 105, 
-    120, 101, 114,  92,  67, 117, 
-     98, 101,  83, 116, 114, 101, 
-    116,  99, 104, 101, 114,  46, 
-    102, 120,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   1, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255,  12,   0, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-     27,  69, 170,  91,   1,   0, 
-      0,   0,  93, 194, 233,  60, 
-    217,  26, 244,  67, 153, 168, 
-    246, 121, 190, 206, 150, 213, 
-    112,   0,   0,   0,  47,  76, 
-    105, 110, 107,  73, 110, 102, 
-    111,   0,  47, 110,  97, 109, 
-    101, 115,   0,  47, 115, 114, 
-     99,  47, 104, 101,  97, 100, 
-    101, 114,  98, 108, 111,  99, 
-    107,   0,  47, 115, 114,  99, 
-     47, 102, 105, 108, 101, 115, 
-     47,  99,  58,  92, 100, 101, 
-    118,  92,  51, 114, 100, 112, 
-     97, 114, 116, 121,  92, 100, 
-    105, 114, 101,  99, 116, 120, 
-    116, 101, 120,  92, 108, 101, 
-    103,  97,  99, 121,  99, 117, 
-     98, 101, 109,  97, 112, 101, 
-    100, 103, 101, 102, 105, 120, 
-    101, 114,  92,  99, 117,  98, 
-    101, 115, 116, 114, 101, 116, 
-     99, 104, 101, 114,  46, 102, 
-    120,   0,   4,   0,   0,   0, 
-      6,   0,   0,   0,   1,   0, 
-      0,   0,  30,   0,   0,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,   0,   7,   0,   0,   0, 
-     34,   0,   0,   0,   8,   0, 
-      0,   0,  10,   0,   0,   0, 
-      6,   0,   0,   0,   0,   0, 
-      0,   0,   5,   0,   0,   0, 
-      0,   0,   0,   0, 220,  81, 
-     51,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  16,   0, 
-      0,   0,  32,   0,   0,   0, 
-    204,   0,   0,   0, 156,   1, 
-      0,   0,  83,   1,   0,   0, 
-     88,   0,   0,   0,   0,   0, 
-      0,   0,  34,  14,   0,   0, 
-    128,   0,   0,   0, 105,  13, 
-      0,   0,  36,  14,   0,   0, 
-     68,   0,   0,   0,  12,   0, 
-      0,   0,  40,   0,   0,   0, 
-     32,   2,   0,   0,  44,   0, 
-      0,   0,  20,   0,   0,   0, 
-      3,   0,   0,   0,  40,   0, 
-      0,   0,  25,   0,   0,   0, 
-     39,   0,   0,   0,  33,   0, 
-      0,   0,  15,   0,   0,   0, 
-      6,   0,   0,   0,  27,   0, 
-      0,   0,  28,   0,   0,   0, 
-     29,   0,   0,   0,  30,   0, 
-      0,   0,  31,   0,   0,   0, 
-     32,   0,   0,   0,  16,   0, 
-      0,   0,   8,   0,   0,   0, 
-      9,   0,   0,   0,  10,   0, 
-      0,   0,  11,   0,   0,   0, 
-     12,   0,   0,   0,  13,   0, 
-      0,   0,  14,   0,   0,   0, 
-     17,   0,   0,   0,  18,   0, 
-      0,   0,  19,   0,   0,   0, 
-     20,   0,   0,   0,  21,   0, 
-      0,   0,  22,   0,   0,   0, 
-     23,   0,   0,   0,  24,   0, 
-      0,   0,   7,   0,   0,   0, 
-     26,   0,   0,   0,  34,   0, 
-      0,   0,  35,   0,   0,   0, 
-     36,   0,   0,   0,  38,   0, 
-      0,   0,  37,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     41,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  73,  76,  68,  78, 
-     44,   0,   0,   0,   0,   0, 
-     36,   0,  53,  97,  97,  99, 
-     52,  56, 101,  53,  98,  57, 
-     51,  52,  99,  52, 102,  56, 
-    100,  56, 100,  97,  57,  99, 
-     98,  54, 101,  56,  98,  51, 
-     48, 100,  53,  97,  46, 112, 
-    100,  98,   0,   0,   0,   0
-};
@@ -1,4700 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Buffer Definitions: 
-//
-// cbuffer PerEnvironmentMap
-// {
-//
-//   uint CurrentMipLevel;              // Offset:    0 Size:     4
-//
-// }
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// inputSampler                      sampler      NA          NA             s0      1 
-// SourceCubeMap                     texture  float4        cube             t0      1 
-// PerEnvironmentMap                 cbuffer      NA          NA            cb0      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_POSITION              0   xyzw        0      POS   float       
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// SV_RenderTargetArrayIndex     0   x           2  RTINDEX    uint       
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_TARGET                0   xyzw        0   TARGET   float   xyzw
-//
-// Debug name: 93000d1752840d7957c0973d44409b4e.pdb
-ps_5_0
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_constantbuffer CB0[1], immediateIndexed
-dcl_sampler s0, mode_default
-dcl_resource_texturecube (float,float,float,float) t0
-dcl_input_ps linear v1.xyz
-dcl_output o0.xyzw
-dcl_temps 7
-//
-// Initial variable locations:
-//   v0.x <- psi.position.x; v0.y <- psi.position.y; v0.z <- psi.position.z; v0.w <- psi.position.w; 
-//   v1.x <- psi.normal.x; v1.y <- psi.normal.y; v1.z <- psi.normal.z; 
-//   v2.x <- psi.RTIndex; 
-//   o0.x <- <ps return value>.color.x; o0.y <- <ps return value>.color.y; o0.z <- <ps return value>.color.z; o0.w <- <ps return value>.color.w
-//
-#line 100 "C:\dev\3rdParty\DirectXTex\LegacyCubeMapEdgeFixer\CubeStretcher.fx"
-resinfo_indexable(texturecube)(float,float,float,float)_uint r0.x, cb0[0].x, t0.xyzw
-mov r0.x, r0.x  // r0.x <- width
-
-#line 104
-mov r0.y, l(1)
-uge r0.y, r0.y, r0.x
-if_nz r0.y
-
-#line 106
-  itof r0.yzw, l(0, 1, 0, 0)
-  utof r1.x, cb0[0].x
-  sample_l_indexable(texturecube)(float,float,float,float) r1.xyzw, r0.yzwy, t0.xyzw, s0, r1.x  // r1.x <- c1.x; r1.y <- c1.y; r1.z <- c1.z; r1.w <- c1.w
-
-#line 107
-  itof r0.yzw, l(0, -1, 0, 0)
-  utof r2.x, cb0[0].x
-  sample_l_indexable(texturecube)(float,float,float,float) r2.xyzw, r0.yzwy, t0.xyzw, s0, r2.x  // r2.x <- c2.x; r2.y <- c2.y; r2.z <- c2.z; r2.w <- c2.w
-
-#line 108
-  itof r0.yzw, l(0, 0, 1, 0)
-  utof r3.x, cb0[0].x
-  sample_l_indexable(texturecube)(float,float,float,float) r3.xyzw, r0.yzwy, t0.xyzw, s0, r3.x  // r3.x <- c3.x; r3.y <- c3.y; r3.z <- c3.z; r3.w <- c3.w
-
-#line 109
-  itof r0.yzw, l(0, 0, -1, 0)
-  utof r4.x, cb0[0].x
-  sample_l_indexable(texturecube)(float,float,float,float) r4.xyzw, r0.yzwy, t0.xyzw, s0, r4.x  // r4.x <- c4.x; r4.y <- c4.y; r4.z <- c4.z; r4.w <- c4.w
-
-#line 110
-  itof r0.yzw, l(0, 0, 0, 1)
-  utof r5.x, cb0[0].x
-  sample_l_indexable(texturecube)(float,float,float,float) r5.xyzw, r0.yzwy, t0.xyzw, s0, r5.x  // r5.x <- c5.x; r5.y <- c5.y; r5.z <- c5.z; r5.w <- c5.w
-
-#line 111
-  itof r0.yzw, l(0, 0, 0, -1)
-  utof r6.x, cb0[0].x
-  sample_l_indexable(texturecube)(float,float,float,float) r6.xyzw, r0.yzwy, t0.xyzw, s0, r6.x  // r6.x <- c6.x; r6.y <- c6.y; r6.z <- c6.z; r6.w <- c6.w
-
-#line 112
-  add r1.xyzw, r1.xyzw, r2.xyzw
-  add r1.xyzw, r3.xyzw, r1.xyzw
-  add r1.xyzw, r4.xyzw, r1.xyzw
-  add r1.xyzw, r5.xyzw, r1.xyzw
-  add r1.xyzw, r6.xyzw, r1.xyzw
-  div r1.xyzw, r1.xyzw, l(6.000000, 6.000000, 6.000000, 6.000000)  // r1.x <- outColor.x; r1.y <- outColor.y; r1.z <- outColor.z; r1.w <- outColor.w
-
-#line 113
-else 
-
-#line 116
-  nop 
-  mov r0.yzw, v1.xxyz
-  utof r0.x, r0.x
-
-#line 76
-  mov r2.x, l(0.999999)  // r2.x <- eps
-
-#line 78
-  mov r2.y, -r0.y
-  max r2.y, r0.y, r2.y
-  mov r2.z, -r0.z
-  max r2.z, r0.z, r2.z
-  max r2.y, r2.z, r2.y
-  mov r2.z, -r0.w
-  max r2.z, r0.w, r2.z
-  max r2.y, r2.z, r2.y  // r2.y <- M
-
-#line 80
-  itof r2.z, l(1)
-  lt r2.z, r2.z, r0.x
-  itof r2.w, l(1)
-  mov r2.w, -r2.w
-  add r2.w, r0.x, r2.w
-  div r0.x, r0.x, r2.w
-  itof r2.w, l(1)
-  movc r0.x, r2.z, r0.x, r2.w  // r0.x <- scale
-
-#line 82
-  div r0.yzw, r0.yyzw, r2.yyyy
-
-#line 83
-  mov r2.y, -r0.y
-  max r2.y, r0.y, r2.y
-  ge r2.y, r2.x, r2.y
-  if_nz r2.y
-
-#line 84
-    mul r0.y, r0.x, r0.y
-  endif 
-
-#line 85
-  mov r2.y, -r0.z
-  max r2.y, r0.z, r2.y
-  ge r2.y, r2.x, r2.y
-  if_nz r2.y
-
-#line 86
-    mul r0.z, r0.x, r0.z
-  endif 
-
-#line 87
-  mov r2.y, -r0.w
-  max r2.y, r0.w, r2.y
-  ge r2.x, r2.x, r2.y
-  if_nz r2.x
-
-#line 88
-    mul r0.w, r0.x, r0.w
-  endif 
-
-#line 89
-  mov r0.y, r0.y  // r0.y <- <fix_cube_lookup return value>.x
-  mov r0.z, r0.z  // r0.z <- <fix_cube_lookup return value>.y
-  mov r0.w, r0.w  // r0.w <- <fix_cube_lookup return value>.z
-
-#line 116
-  mov r0.yzw, r0.yyzw  // r0.y <- envDiffuseCoord.x; r0.z <- envDiffuseCoord.y; r0.w <- envDiffuseCoord.z
-
-#line 117
-  utof r0.x, cb0[0].x
-  sample_l_indexable(texturecube)(float,float,float,float) r1.xyzw, r0.yzwy, t0.xyzw, s0, r0.x  // r1.x <- outColor.x; r1.y <- outColor.y; r1.z <- outColor.z; r1.w <- outColor.w
-
-#line 118
-endif 
-
-#line 123
-mov r1.xyzw, r1.xyzw  // r1.x <- output.color.x; r1.y <- output.color.y; r1.z <- output.color.z; r1.w <- output.color.w
-
-#line 125
-mov o0.xyzw, r1.xyzw
-ret 
-// Approximately 79 instruction slots used
-#endif
-
-const BYTE g_ps[] =
-{
-     68,  88,  66,  67,  35,   6, 
-    103,  91, 253, 128,   9,  92, 
-     49,  48, 230, 103, 218, 232, 
-     51,   5,   1,   0,   0,   0, 
-    156, 105,   0,   0,   7,   0, 
-      0,   0,  60,   0,   0,   0, 
-    180,   1,   0,   0,  60,   2, 
-      0,   0, 112,   2,   0,   0, 
-    196,  10,   0,   0,  96,  11, 
-      0,   0, 104, 105,   0,   0, 
-     82,  68,  69,  70, 112,   1, 
-      0,   0,   1,   0,   0,   0, 
-    204,   0,   0,   0,   3,   0, 
-      0,   0,  60,   0,   0,   0, 
-      0,   5, 255, 255,   5,   1, 
-     64,   0,  72,   1,   0,   0, 
-     82,  68,  49,  49,  60,   0, 
-      0,   0,  24,   0,   0,   0, 
-     32,   0,   0,   0,  40,   0, 
-      0,   0,  36,   0,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   0, 156,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0, 169,   0, 
-      0,   0,   2,   0,   0,   0, 
-      5,   0,   0,   0,   9,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,  13,   0,   0,   0, 
-    183,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,   0,  83, 111, 117, 
-    114,  99, 101,  67, 117,  98, 
-    101,  77,  97, 112,   0,  80, 
-    101, 114,  69, 110, 118, 105, 
-    114, 111, 110, 109, 101, 110, 
-    116,  77,  97, 112,   0, 171, 
-    171, 171, 183,   0,   0,   0, 
-      1,   0,   0,   0, 228,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  12,   1,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,   2,   0,   0,   0, 
-     36,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,   0, 100, 119, 
-    111, 114, 100,   0, 171, 171, 
-      0,   0,  19,   0,   1,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  28,   1,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  40,  82, 
-     41,  32,  72,  76,  83,  76, 
-     32,  83, 104,  97, 100, 101, 
-    114,  32,  67, 111, 109, 112, 
-    105, 108, 101, 114,  32,  49, 
-     48,  46,  49,   0,  73,  83, 
-     71,  78, 128,   0,   0,   0, 
-      3,   0,   0,   0,   8,   0, 
-      0,   0,  80,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,  15,   0, 
-      0,   0,  92,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   0,   0,   7,   7, 
-      0,   0,  99,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-      2,   0,   0,   0,   1,   0, 
-      0,   0,  83,  86,  95,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,   0,  78,  79,  82,  77, 
-     65,  76,   0,  83,  86,  95, 
-     82, 101, 110, 100, 101, 114, 
-     84,  97, 114, 103, 101, 116, 
-     65, 114, 114,  97, 121,  73, 
-    110, 100, 101, 120,   0, 171, 
-    171, 171,  79,  83,  71,  78, 
-     44,   0,   0,   0,   1,   0, 
-      0,   0,   8,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,  15,   0,   0,   0, 
-     83,  86,  95,  84,  65,  82, 
-     71,  69,  84,   0, 171, 171, 
-     83,  72,  69,  88,  76,   8, 
-      0,   0,  80,   0,   0,   0, 
-     19,   2,   0,   0, 106, 136, 
-      0,   1,  89,   0,   0,   4, 
-     70, 142,  32,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-     90,   0,   0,   3,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     88,  48,   0,   4,   0, 112, 
-     16,   0,   0,   0,   0,   0, 
-     85,  85,   0,   0,  98,  16, 
-      0,   3, 114,  16,  16,   0, 
-      1,   0,   0,   0, 101,   0, 
-      0,   3, 242,  32,  16,   0, 
-      0,   0,   0,   0, 104,   0, 
-      0,   2,   7,   0,   0,   0, 
-     61,  16,   0, 138, 130,   1, 
-      0, 128,  67,  85,  21,   0, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10, 128,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  70, 126,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   1,   0, 
-      0,   0,  80,   0,   0,   7, 
-     34,   0,  16,   0,   0,   0, 
-      0,   0,  26,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     31,   0,   4,   3,  26,   0, 
-     16,   0,   0,   0,   0,   0, 
-     43,   0,   0,   8, 226,   0, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  86,   0,   0,   6, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  10, 128,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  72,   0,   0, 141, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 242,   0,  16,   0, 
-      1,   0,   0,   0, 150,   7, 
-     16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     43,   0,   0,   8, 226,   0, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  86,   0,   0,   6, 
-     18,   0,  16,   0,   2,   0, 
-      0,   0,  10, 128,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  72,   0,   0, 141, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 242,   0,  16,   0, 
-      2,   0,   0,   0, 150,   7, 
-     16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   2,   0,   0,   0, 
-     43,   0,   0,   8, 226,   0, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  86,   0,   0,   6, 
-     18,   0,  16,   0,   3,   0, 
-      0,   0,  10, 128,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  72,   0,   0, 141, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 242,   0,  16,   0, 
-      3,   0,   0,   0, 150,   7, 
-     16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     43,   0,   0,   8, 226,   0, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,  86,   0,   0,   6, 
-     18,   0,  16,   0,   4,   0, 
-      0,   0,  10, 128,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  72,   0,   0, 141, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 242,   0,  16,   0, 
-      4,   0,   0,   0, 150,   7, 
-     16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   4,   0,   0,   0, 
-     43,   0,   0,   8, 226,   0, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,  86,   0,   0,   6, 
-     18,   0,  16,   0,   5,   0, 
-      0,   0,  10, 128,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  72,   0,   0, 141, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 242,   0,  16,   0, 
-      5,   0,   0,   0, 150,   7, 
-     16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   5,   0,   0,   0, 
-     43,   0,   0,   8, 226,   0, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  86,   0,   0,   6, 
-     18,   0,  16,   0,   6,   0, 
-      0,   0,  10, 128,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  72,   0,   0, 141, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 242,   0,  16,   0, 
-      6,   0,   0,   0, 150,   7, 
-     16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   6,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   1,   0, 
-      0,   0,  70,  14,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   1,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   5,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   6,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,  14,   0,   0,  10, 
-    242,   0,  16,   0,   1,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,   2,  64, 
-      0,   0,   0,   0, 192,  64, 
-      0,   0, 192,  64,   0,   0, 
-    192,  64,   0,   0, 192,  64, 
-     18,   0,   0,   1,  58,   0, 
-      0,   1,  54,   0,   0,   5, 
-    226,   0,  16,   0,   0,   0, 
-      0,   0,   6,  25,  16,   0, 
-      1,   0,   0,   0,  86,   0, 
-      0,   5,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   2,   0,   0,   0, 
-      1,  64,   0,   0, 239, 255, 
-    127,  63,  54,   0,   0,   6, 
-     34,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16, 128, 
-     65,   0,   0,   0,   0,   0, 
-      0,   0,  52,   0,   0,   7, 
-     34,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
-      0,   0,   0,   0,  26,   0, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   6,  66,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16, 128,  65,   0, 
-      0,   0,   0,   0,   0,   0, 
-     52,   0,   0,   7,  66,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   0,   0, 
-      0,   0,  42,   0,  16,   0, 
-      2,   0,   0,   0,  52,   0, 
-      0,   7,  34,   0,  16,   0, 
-      2,   0,   0,   0,  42,   0, 
-     16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  54,   0,   0,   6, 
-     66,   0,  16,   0,   2,   0, 
-      0,   0,  58,   0,  16, 128, 
-     65,   0,   0,   0,   0,   0, 
-      0,   0,  52,   0,   0,   7, 
-     66,   0,  16,   0,   2,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  42,   0, 
-     16,   0,   2,   0,   0,   0, 
-     52,   0,   0,   7,  34,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
-      2,   0,   0,   0,  43,   0, 
-      0,   5,  66,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     49,   0,   0,   7,  66,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  43,   0, 
-      0,   5, 130,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     54,   0,   0,   6, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-     58,   0,  16, 128,  65,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  14,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,  43,   0,   0,   5, 
-    130,   0,  16,   0,   2,   0, 
-      0,   0,   1,  64,   0,   0, 
-      1,   0,   0,   0,  55,   0, 
-      0,   9,  18,   0,  16,   0, 
-      0,   0,   0,   0,  42,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  14,   0, 
-      0,   7, 226,   0,  16,   0, 
-      0,   0,   0,   0,  86,  14, 
-     16,   0,   0,   0,   0,   0, 
-     86,   5,  16,   0,   2,   0, 
-      0,   0,  54,   0,   0,   6, 
-     34,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16, 128, 
-     65,   0,   0,   0,   0,   0, 
-      0,   0,  52,   0,   0,   7, 
-     34,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
-      0,   0,   0,   0,  26,   0, 
-     16,   0,   2,   0,   0,   0, 
-     29,   0,   0,   7,  34,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
-      2,   0,   0,   0,  31,   0, 
-      4,   3,  26,   0,  16,   0, 
-      2,   0,   0,   0,  56,   0, 
-      0,   7,  34,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     26,   0,  16,   0,   0,   0, 
-      0,   0,  21,   0,   0,   1, 
-     54,   0,   0,   6,  34,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16, 128,  65,   0, 
-      0,   0,   0,   0,   0,   0, 
-     52,   0,   0,   7,  34,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   0,   0, 
-      0,   0,  26,   0,  16,   0, 
-      2,   0,   0,   0,  29,   0, 
-      0,   7,  34,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
-     16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  31,   0,   4,   3, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  56,   0,   0,   7, 
-     66,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  42,   0, 
-     16,   0,   0,   0,   0,   0, 
-     21,   0,   0,   1,  54,   0, 
-      0,   6,  34,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,  52,   0, 
-      0,   7,  34,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  29,   0,   0,   7, 
-     18,   0,  16,   0,   2,   0, 
-      0,   0,  10,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
-     16,   0,   2,   0,   0,   0, 
-     31,   0,   4,   3,  10,   0, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  21,   0, 
-      0,   1,  54,   0,   0,   5, 
-     34,   0,  16,   0,   0,   0, 
-      0,   0,  26,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      0,   0,   0,   0,  42,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    226,   0,  16,   0,   0,   0, 
-      0,   0,  86,  14,  16,   0, 
-      0,   0,   0,   0,  86,   0, 
-      0,   6,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10, 128, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  72,   0, 
-      0, 141, 130,   1,   0, 128, 
-     67,  85,  21,   0, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-    150,   7,  16,   0,   0,   0, 
-      0,   0,  70, 126,  16,   0, 
-      0,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  21,   0,   0,   1, 
-     54,   0,   0,   5, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    242,  32,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  62,   0, 
-      0,   1,  83,  84,  65,  84, 
-    148,   0,   0,   0,  79,   0, 
-      0,   0,   7,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,  31,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   7,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  10,   0,   0,   0, 
-      1,   0,   0,   0,  17,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  83,  80,  68,  66, 
-      0,  94,   0,   0,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  67,  47,  67,  43, 
-     43,  32,  77,  83,  70,  32, 
-     55,  46,  48,  48,  13,  10, 
-     26,  68,  83,   0,   0,   0, 
-      0,   2,   0,   0,   2,   0, 
-      0,   0,  47,   0,   0,   0, 
-    220,   0,   0,   0,   0,   0, 
-      0,   0,  44,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    192, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255,  56,   0,   0,   0, 
-      0, 224, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,   5,   0, 
-      0,   0,  32,   0,   0,   0, 
-     60,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   6,   0, 
-      0,   0,   5,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-     27,  69, 170,  91,   1,   0, 
-      0,   0,  68,  34, 226, 194, 
-    128,  43, 218,  66, 157,  12, 
-     24, 253,  72,  35,  55, 210, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 220,  81, 
-     51,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 114,  97, 
-    121,  73, 110, 100, 101, 120, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10, 115, 116, 114, 
-    117,  99, 116,  32,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  79, 117, 116, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32,  99, 111, 
-    108, 111, 114,  32,  58,  32, 
-     83,  86,  95,  84,  65,  82, 
-     71,  69,  84,  48,  59,  13, 
-     10, 125,  59,  13,  10,  13, 
-     10,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  68,  97, 116,  97,  32, 
-    118, 115,  40,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  32, 100,  97, 116,  97, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 100, 
-     97, 116,  97,  59,  13,  10, 
-    125,  13,  10,  13,  10, 102, 
-    108, 111,  97, 116,  51,  32, 
-    103, 101, 116,  86, 101, 114, 
-    116, 101, 120,  68, 105, 114, 
-    101,  99, 116, 105, 111, 110, 
-     40, 105, 110, 116,  32, 102, 
-     97,  99, 101,  44,  32, 102, 
-    108, 111,  97, 116,  32, 117, 
-     44,  32, 102, 108, 111,  97, 
-    116,  32, 118,  41,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 115, 119, 105, 116,  99, 
-    104,  32,  40, 102,  97,  99, 
-    101,  41,  13,  10,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  99,  97, 115, 101,  32, 
-     48,  58,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     43,  49,  44,  32,  43, 118, 
-     44,  32,  45, 117,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  99,  97, 
-    115, 101,  32,  49,  58,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 102, 108, 111,  97, 
-    116,  51,  40,  45,  49,  44, 
-     32,  43, 118,  44,  32,  43, 
-    117,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  99,  97, 115, 101,  32, 
-     50,  58,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     43, 117,  44,  32,  43,  49, 
-     44,  32,  45, 118,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  99,  97, 
-    115, 101,  32,  51,  58,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 102, 108, 111,  97, 
-    116,  51,  40,  43, 117,  44, 
-     32,  45,  49,  44,  32,  43, 
-    118,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  99,  97, 115, 101,  32, 
-     52,  58,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     43, 117,  44,  32,  43, 118, 
-    198,  90,   0,   0,  76, 232, 
-      3,   0,  72, 155,   2,   0, 
-     47,  63,   0,   0,  38, 247, 
-      2,   0, 176, 206,   3,   0, 
-    226,  70,   3,   0,  49, 251, 
-      3,   0, 168, 209,   0,   0, 
-     33, 140,   1,   0, 233, 240, 
-      2,   0, 143,  69,   1,   0, 
-    109, 131,   1,   0,  90,  28, 
-      0,   0, 177, 197,   0,   0, 
-    214,   6,   3,   0, 125, 218, 
-      1,   0,  31, 229,   0,   0, 
-    184, 232,   1,   0, 140, 144, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  84, 101, 120, 116, 
-    117, 114, 101,  67, 117,  98, 
-    101,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 116,  48,  41, 
-     59,  13,  10,  13,  10,  99, 
-     98, 117, 102, 102, 101, 114, 
-     32,  80, 101, 114,  69, 110, 
-    118, 105, 114, 111, 110, 109, 
-    101, 110, 116,  77,  97, 112, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-     98,  48,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    117, 105, 110, 116,  32,  67, 
-    117, 114, 114, 101, 110, 116, 
-     77, 105, 112,  76, 101, 118, 
-    101, 108,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10,  83, 
-     97, 109, 112, 108, 101, 114, 
-     83, 116,  97, 116, 101,  32, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-    115,  48,  41,  59,  13,  10, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  58,  32,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10, 115, 116, 114, 
-    117,  99, 116,  32,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  58,  32,  83, 
-     86,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    110, 111, 114, 109,  97, 108, 
-     32,  58,  32,  78,  79,  82, 
-     77,  65,  76,  59,  13,  10, 
-     32,  32,  32,  32, 117, 105, 
-    110, 116,  32,  82,  84,  73, 
-    110, 100, 101, 120,  32,  58, 
-     32,  83,  86,  95,  82, 101, 
-    110, 100, 101, 114,  84,  97, 
-    114, 103, 101, 116,  65, 114, 
-    114,  97, 121,  73, 110, 100, 
-    101, 120,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  79, 
-    117, 116,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99, 111, 108, 111, 114,  32, 
-     58,  32,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84,  48, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  32, 118, 115,  40,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,  32, 100,  97, 
-    116,  97,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 100,  97, 116,  97,  59, 
-     13,  10, 125,  13,  10,  13, 
-     10, 102, 108, 111,  97, 116, 
-     51,  32, 103, 101, 116,  86, 
-    101, 114, 116, 101, 120,  68, 
-    105, 114, 101,  99, 116, 105, 
-    111, 110,  40, 105, 110, 116, 
-     32, 102,  97,  99, 101,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 117,  44,  32, 102, 108, 
-    111,  97, 116,  32, 118,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 115, 119, 105, 
-    116,  99, 104,  32,  40, 102, 
-     97,  99, 101,  41,  13,  10, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  99,  97, 115, 
-    101,  32,  48,  58,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  43,  49,  44,  32, 
-     43, 118,  44,  32,  45, 117, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     99,  97, 115, 101,  32,  49, 
-     58,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  51,  40,  45, 
-     49,  44,  32,  43, 118,  44, 
-     32,  43, 117,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  99,  97, 115, 
-    101,  32,  50,  58,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  43, 117,  44,  32, 
-     43,  49,  44,  32,  45, 118, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     99,  97, 115, 101,  32,  51, 
-     58,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  51,  40,  43, 
-    117,  44,  32,  45,  49,  44, 
-     32,  43, 118,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  99,  97, 115, 
-    101,  32,  52,  58,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  43, 117,  44,  32, 
-     43, 118,  44,  32,  43,  49, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     99,  97, 115, 101,  32,  53, 
-     58,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  51,  40,  45, 
-    117,  44,  32,  43, 118,  44, 
-     32,  45,  49,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 100, 101, 102, 
-     97, 117, 108, 116,  58,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32,  48,  59,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10, 125,  13,  10,  13,  10, 
-     91, 109,  97, 120, 118, 101, 
-    114, 116, 101, 120,  99, 111, 
-    117, 110, 116,  40,  49,  56, 
-     41,  93,  13,  10, 118, 111, 
-    105, 100,  32, 103, 115,  40, 
-    116, 114, 105,  97, 110, 103, 
-    108, 101,  32,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  32, 105, 110, 112, 117, 
-    116,  91,  51,  93,  44,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 105, 110, 
-    111, 117, 116,  32,  84, 114, 
-    105,  97, 110, 103, 108, 101, 
-     83, 116, 114, 101,  97, 109, 
-     60,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-     73, 110, 112, 117, 116,  62, 
-     32, 111, 117, 116,  83, 116, 
-    114, 101,  97, 109,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 102, 111, 114,  32, 
-     40, 105, 110, 116,  32, 102, 
-     32,  61,  32,  48,  59,  32, 
-    102,  32,  60,  32,  54,  59, 
-     32,  43,  43, 102,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,  32, 111, 117, 116, 
-    112, 117, 116,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 111, 117, 116, 112, 
-    117, 116,  46,  82,  84,  73, 
-    110, 100, 101, 120,  32,  61, 
-     32, 102,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 111, 114,  32,  40, 
-    105, 110, 116,  32, 118,  32, 
-     61,  32,  48,  59,  32, 118, 
-     32,  60,  32,  51,  59,  32, 
-    118,  43,  43,  41,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112,  32,  61,  32, 105, 110, 
-    112, 117, 116,  91, 118,  93, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47, 111, 117, 116, 112, 
-    117, 116,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  32, 
-     61,  32, 109, 117, 108,  40, 
-    105, 110, 112, 117, 116,  91, 
-    118,  93,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  44, 
-     32,  67, 117,  98, 101,  70, 
-     97,  99, 101,  86, 105, 101, 
-    119,  80, 114, 111, 106,  91, 
-    102,  93,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47, 111, 117, 116, 112, 
-    117, 116,  46, 110, 111, 114, 
-    109,  97, 108,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40,  48, 
-     44,  32,  48,  44,  32,  49, 
-     44,  32,  48,  41,  44,  32, 
-     67, 117,  98, 101,  70,  97, 
-     99, 101,  86, 105, 101, 119, 
-     80, 114, 111, 106,  91, 102, 
-     93,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 111, 
-    117, 116, 112, 117, 116,  46, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  61,  32, 112, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 111, 117, 116, 
-    112, 117, 116,  46, 110, 111, 
-    114, 109,  97, 108,  32,  61, 
-     32, 103, 101, 116,  86, 101, 
-    114, 116, 101, 120,  68, 105, 
-    114, 101,  99, 116, 105, 111, 
-    110,  40, 102,  44,  32, 112, 
-     46, 120,  44,  32, 112,  46, 
-    121,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 111, 
-    117, 116,  83, 116, 114, 101, 
-     97, 109,  46,  65, 112, 112, 
-    101, 110, 100,  40, 111, 117, 
-    116, 112, 117, 116,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 125,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 111, 117, 116, 
-     83, 116, 114, 101,  97, 109, 
-     46,  82, 101, 115, 116,  97, 
-    114, 116,  83, 116, 114, 105, 
-    112,  40,  41,  59,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10, 125,  13,  10,  13,  10, 
-    102, 108, 111,  97, 116,  51, 
-     32, 102, 105, 120,  95,  99, 
-    117,  98, 101,  95, 108, 111, 
-    111, 107, 117, 112,  40, 102, 
-    108, 111,  97, 116,  51,  32, 
-    118,  44,  32, 102, 108, 111, 
-     97, 116,  32,  99, 117,  98, 
-    101,  83, 105, 122, 101,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 101, 112, 115, 
-     32,  61,  32,  49,  32,  45, 
-     32,  49, 101,  45,  54,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  77,  32,  61,  32, 
-    109,  97, 120,  40, 109,  97, 
-    120,  40,  97,  98, 115,  40, 
-    118,  46, 120,  41,  44,  32, 
-     97,  98, 115,  40, 118,  46, 
-    121,  41,  41,  44,  32,  97, 
-     98, 115,  40, 118,  46, 122, 
-     41,  41,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 115, 
-     99,  97, 108, 101,  32,  61, 
-     32,  99, 117,  98, 101,  83, 
-    105, 122, 101,  32,  62,  32, 
-     49,  32,  63,  32,  99, 117, 
-     98, 101,  83, 105, 122, 101, 
-     32,  47,  32,  40,  99, 117, 
-     98, 101,  83, 105, 122, 101, 
-     32,  45,  32,  49,  41,  32, 
-     58,  32,  49,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    118,  32,  47,  61,  32,  77, 
-     59,  13,  10,  32,  32,  32, 
-     32, 105, 102,  32,  40,  97, 
-     98, 115,  40, 118,  46, 120, 
-     41,  32,  60,  61,  32, 101, 
-    112, 115,  41,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 118,  46, 120,  32,  42, 
-     61,  32, 115,  99,  97, 108, 
-    101,  59,  13,  10,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-     97,  98, 115,  40, 118,  46, 
-    121,  41,  32,  60,  61,  32, 
-    101, 112, 115,  41,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 118,  46, 121,  32, 
-     42,  61,  32, 115,  99,  97, 
-    108, 101,  59,  13,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40,  97,  98, 115,  40, 118, 
-     46, 122,  41,  32,  60,  61, 
-     32, 101, 112, 115,  41,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 118,  46, 122, 
-     32,  42,  61,  32, 115,  99, 
-     97, 108, 101,  59,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  79, 117, 116,  32, 112, 
-    115,  40,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-     32, 112, 115, 105,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  79, 117, 116,  32, 111, 
-    117, 116, 112, 117, 116,  59, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 111, 117, 116, 112, 
-    117, 116,  46,  99, 111, 108, 
-    111, 114,  32,  61,  32, 102, 
-    108, 111,  97, 116,  52,  40, 
-    112, 115, 105,  46, 110, 111, 
-    114, 109,  97, 108,  32,  42, 
-     32,  48,  46,  53,  32,  43, 
-     32,  48,  46,  53,  44,  32, 
-     49,  41,  59,  13,  10,  32, 
-     32,  32,  32,  47,  47, 111, 
-    117, 116, 112, 117, 116,  46, 
-     99, 111, 108, 111, 114,  32, 
-     61,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  76, 101, 
-    118, 101, 108,  40, 105, 110, 
-    112, 117, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    112, 115, 105,  46, 110, 111, 
-    114, 109,  97, 108,  44,  32, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,  41,  59,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47, 114, 101, 116, 117, 114, 
-    110,  32, 111, 117, 116, 112, 
-    117, 116,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32, 117, 
-    105, 110, 116,  32, 119, 105, 
-    100, 116, 104,  44,  32, 104, 
-    101, 105, 103, 104, 116,  44, 
-     32, 109, 105, 112,  67, 111, 
-    117, 110, 116,  59,  13,  10, 
-     32,  32,  32,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     71, 101, 116,  68, 105, 109, 
-    101, 110, 115, 105, 111, 110, 
-    115,  40,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,  44, 
-     32, 119, 105, 100, 116, 104, 
-     44,  32, 104, 101, 105, 103, 
-    104, 116,  44,  32, 109, 105, 
-    112,  67, 111, 117, 110, 116, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32, 111, 
-    117, 116,  67, 111, 108, 111, 
-    114,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40, 119, 105, 100, 116, 
-    104,  32,  60,  61,  32,  49, 
-     41,  13,  10,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32,  99,  49,  32,  61,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40,  43, 
-     49,  44,  32,  48,  44,  32, 
-     48,  41,  44,  32,  67, 117, 
-    114, 114, 101, 110, 116,  77, 
-    105, 112,  76, 101, 118, 101, 
-    108,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32,  99,  50,  32,  61, 
-     32,  83, 111, 117, 114,  99, 
-    101,  67, 117,  98, 101,  77, 
-     97, 112,  46,  83,  97, 109, 
-    112, 108, 101,  76, 101, 118, 
-    101, 108,  40, 105, 110, 112, 
-    117, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     45,  49,  44,  32,  48,  44, 
-     32,  48,  41,  44,  32,  67, 
-    117, 114, 114, 101, 110, 116, 
-     77, 105, 112,  76, 101, 118, 
-    101, 108,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32,  99,  51,  32, 
-     61,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  76, 101, 
-    118, 101, 108,  40, 105, 110, 
-    112, 117, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  48,  44,  32,  43,  49, 
-     44,  32,  48,  41,  44,  32, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32,  99,  52, 
-     32,  61,  32,  83, 111, 117, 
-    114,  99, 101,  67, 117,  98, 
-    101,  77,  97, 112,  46,  83, 
-     97, 109, 112, 108, 101,  76, 
-    101, 118, 101, 108,  40, 105, 
-    110, 112, 117, 116,  83,  97, 
-    109, 112, 108, 101, 114,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  48,  44,  32,  45, 
-     49,  44,  32,  48,  41,  44, 
-     32,  67, 117, 114, 114, 101, 
-    110, 116,  77, 105, 112,  76, 
-    101, 118, 101, 108,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-     53,  32,  61,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  40,  48,  44,  32, 
-     48,  44,  32,  43,  49,  41, 
-     44,  32,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99,  54,  32,  61,  32,  83, 
-    111, 117, 114,  99, 101,  67, 
-    117,  98, 101,  77,  97, 112, 
-     46,  83,  97, 109, 112, 108, 
-    101,  76, 101, 118, 101, 108, 
-     40, 105, 110, 112, 117, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  51,  40,  48,  44, 
-     32,  48,  44,  32,  45,  49, 
-     41,  44,  32,  67, 117, 114, 
-    114, 101, 110, 116,  77, 105, 
-    112,  76, 101, 118, 101, 108, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    111, 117, 116,  67, 111, 108, 
-    111, 114,  32,  61,  32,  40, 
-     99,  49,  32,  43,  32,  99, 
-     50,  32,  43,  32,  99,  51, 
-     32,  43,  32,  99,  52,  32, 
-     43,  32,  99,  53,  32,  43, 
-     32,  99,  54,  41,  32,  47, 
-     32,  54,  46,  48,  59,  13, 
-     10,  32,  32,  32,  32, 125, 
-     13,  10,  32,  32,  32,  32, 
-    101, 108, 115, 101,  13,  10, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 101, 110, 
-    118,  68, 105, 102, 102, 117, 
-    115, 101,  67, 111, 111, 114, 
-    100,  32,  61,  32, 102, 105, 
-    120,  95,  99, 117,  98, 101, 
-     95, 108, 111, 111, 107, 117, 
-    112,  40, 112, 115, 105,  46, 
-    110, 111, 114, 109,  97, 108, 
-     44,  32, 119, 105, 100, 116, 
-    104,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 111, 117, 116,  67, 111, 
-    108, 111, 114,  32,  61,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 101, 110, 
-    118,  68, 105, 102, 102, 117, 
-    115, 101,  67, 111, 111, 114, 
-    100,  44,  32,  67, 117, 114, 
-    114, 101, 110, 116,  77, 105, 
-    112,  76, 101, 118, 101, 108, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  71,  97, 109, 109, 
-     97,  32,  99, 111, 114, 114, 
-    101,  99, 116,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-    111, 117, 116,  67, 111, 108, 
-    111, 114,  46, 114, 103,  98, 
-     32,  61,  32, 112, 111, 119, 
-     40, 111, 117, 116,  67, 111, 
-    108, 111, 114,  46, 114, 103, 
-     98,  44,  32,  49,  46,  48, 
-    102,  32,  47,  32,  50,  46, 
-     50, 102,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    111, 117, 116, 112, 117, 116, 
-     46,  99, 111, 108, 111, 114, 
-     32,  61,  32, 111, 117, 116, 
-     67, 111, 108, 111, 114,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 111, 117, 116, 
-    112, 117, 116,  59,  13,  10, 
-    125,  13,  10,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-    242,  13,   0,   0,   0,  67, 
-     58,  92, 100, 101, 118,  92, 
-     51, 114, 100,  80,  97, 114, 
-    116, 121,  92,  68, 105, 114, 
-    101,  99, 116,  88,  84, 101, 
-    120,  92,  76, 101, 103,  97, 
-     99, 121,  67, 117,  98, 101, 
-     77,  97, 112,  69, 100, 103, 
-    101,  70, 105, 120, 101, 114, 
-     92,  67, 117,  98, 101,  83, 
-    116, 114, 101, 116,  99, 104, 
-    101, 114,  46, 102, 120,   0, 
-      0,  99,  58,  92, 100, 101, 
-    118,  92,  51, 114, 100, 112, 
-     97, 114, 116, 121,  92, 100, 
-    105, 114, 101,  99, 116, 120, 
-    116, 101, 120,  92, 108, 101, 
-    103,  97,  99, 121,  99, 117, 
-     98, 101, 109,  97, 112, 101, 
-    100, 103, 101, 102, 105, 120, 
-    101, 114,  92,  99, 117,  98, 
-    101, 115, 116, 114, 101, 116, 
-     99, 104, 101, 114,  46, 102, 
-    120,   0,  84, 101, 120, 116, 
-    117, 114, 101,  67, 117,  98, 
-    101,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 116,  48,  41, 
-     59,  13,  10,  13,  10,  99, 
-     98, 117, 102, 102, 101, 114, 
-     32,  80, 101, 114,  69, 110, 
-    118, 105, 114, 111, 110, 109, 
-    101, 110, 116,  77,  97, 112, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-     98,  48,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    117, 105, 110, 116,  32,  67, 
-    117, 114, 114, 101, 110, 116, 
-     77, 105, 112,  76, 101, 118, 
-    101, 108,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10,  83, 
-     97, 109, 112, 108, 101, 114, 
-     83, 116,  97, 116, 101,  32, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-    115,  48,  41,  59,  13,  10, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  58,  32,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10, 115, 116, 114, 
-    117,  99, 116,  32,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  58,  32,  83, 
-     86,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    110, 111, 114, 109,  97, 108, 
-     32,  58,  32,  78,  79,  82, 
-     77,  65,  76,  59,  13,  10, 
-     32,  32,  32,  32, 117, 105, 
-    110, 116,  32,  82,  84,  73, 
-    110, 100, 101, 120,  32,  58, 
-     32,  83,  86,  95,  82, 101, 
-    110, 100, 101, 114,  84,  97, 
-    114, 103, 101, 116,  65, 114, 
-     27, 226,  48,   1, 128,   0, 
-      0,   0, 151,  54,  33, 119, 
-    219,  84, 212,   1,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-     69,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-    128,  80,  96,  86, 105,  13, 
-      0,   0,   1,   0,   0,   0, 
-     68,   0,   0,   0,  69,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-     66,   0,  60,  17,  16,   1, 
-      0,   0,   0,   1,  10,   0, 
-      1,   0,  12,   0, 238,  66, 
-     10,   0,   1,   0,  12,   0, 
-    238,  66,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-      0,   0,  54,   0,  61,  17, 
-      1, 104, 108, 115, 108,  70, 
-    108,  97, 103, 115,   0,  48, 
-    120,  52,  48,  48,  48,  48, 
-     53,   0, 104, 108, 115, 108, 
-     84,  97, 114, 103, 101, 116, 
-      0, 112, 115,  95,  53,  95, 
-     48,   0, 104, 108, 115, 108, 
-     69, 110, 116, 114, 121,   0, 
-    112, 115,   0,   0,  42,   0, 
-     16,  17,   0,   0,   0,   0, 
-    176,  10,   0,   0,   0,   0, 
-      0,   0, 244,   7,   0,   0, 
-      0,   0,   0,   0, 244,   7, 
-      0,   0,   8,  16,   0,   0, 
-     88,   0,   0,   0,   1,   0, 
-    160, 112, 115,   0,   0,   0, 
-     42,   0,  62,  17,   3,  16, 
-      0,   0,   9,   0, 112, 115, 
-    105,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   0,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   4,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   8,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  12,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,  12,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  16,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  20,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  24,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  28,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,  32,   0, 
-      0,   0,  58,   0,  62,  17, 
-      7,  16,   0,   0, 136,   0, 
-     60, 112, 115,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     97, 108, 117, 101,  62,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   0,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   4,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   8,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  12,   0, 
-      4,   0,  88,   0,   0,   0, 
-      1,   0, 244,   7,  12,   0, 
-      0,   0,  46,   0,  62,  17, 
-      6,  16,   0,   0,   8,   0, 
-    111, 117, 116, 112, 117, 116, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  52,   8,   0,   0, 
-      1,   0,  24,   0,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  52,   8,   0,   0, 
-      1,   0,  24,   0,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  52,   8,   0,   0, 
-      1,   0,  24,   0,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0,  52,   8,   0,   0, 
-      1,   0,  24,   0,  28,   0, 
-      0,   0,  46,   0,  62,  17, 
-    117,   0,   0,   0,   0,   0, 
-    119, 105, 100, 116, 104,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 168,   3,   0,   0, 
-      0,   0,  46,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    111, 117, 116,  67, 111, 108, 
-    111, 114,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  12,   4,   0,   0, 
-      1,   0,  64,   4,   4,   0, 
-     12,   4,  16,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     12,   4,   0,   0,   1,   0, 
-     64,   4,   4,   0,  12,   4, 
-     20,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  12,   4, 
-      0,   0,   1,   0,  64,   4, 
-      4,   0,  12,   4,  24,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0,  12,   4,   0,   0, 
-      1,   0,  64,   4,   4,   0, 
-     12,   4,  28,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  99,  49, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  60,   1,   0,   0, 
-      1,   0,  56,   2,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  60,   1,   0,   0, 
-      1,   0,  56,   2,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  60,   1,   0,   0, 
-      1,   0,  56,   2,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0,  60,   1,   0,   0, 
-      1,   0,  56,   2,  28,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-     99,  50,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 168,   1, 
-      0,   0,   1,   0, 104,   2, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 168,   1, 
-      0,   0,   1,   0, 104,   2, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 168,   1, 
-      0,   0,   1,   0, 104,   2, 
-     40,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     12,   0,   4,   0, 168,   1, 
-      0,   0,   1,   0, 104,   2, 
-     44,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  99,  51,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     20,   2,   0,   0,   1,   0, 
-    252,   1,  48,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     20,   2,   0,   0,   1,   0, 
-    252,   1,  52,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     20,   2,   0,   0,   1,   0, 
-    252,   1,  56,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  12,   0,   4,   0, 
-     20,   2,   0,   0,   1,   0, 
-    252,   1,  60,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  99,  52, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 128,   2,   0,   0, 
-      1,   0, 144,   1,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 128,   2,   0,   0, 
-      1,   0, 144,   1,  68,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 128,   2,   0,   0, 
-      1,   0, 144,   1,  72,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0, 128,   2,   0,   0, 
-      1,   0, 144,   1,  76,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-     99,  53,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 236,   2, 
-      0,   0,   1,   0,  36,   1, 
-     80,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 236,   2, 
-      0,   0,   1,   0,  36,   1, 
-     84,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 236,   2, 
-      0,   0,   1,   0,  36,   1, 
-     88,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     12,   0,   4,   0, 236,   2, 
-      0,   0,   1,   0,  36,   1, 
-     92,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  99,  54,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     88,   3,   0,   0,   1,   0, 
-    184,   0,  96,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     88,   3,   0,   0,   1,   0, 
-    184,   0, 100,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     88,   3,   0,   0,   1,   0, 
-    184,   0, 104,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  12,   0,   4,   0, 
-     88,   3,   0,   0,   1,   0, 
-    184,   0, 108,   0,   0,   0, 
-     54,   0,  62,  17,   1,  16, 
-      0,   0,   8,   0, 101, 110, 
-    118,  68, 105, 102, 102, 117, 
-    115, 101,  67, 111, 111, 114, 
-    100,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 208,   7,   0,   0, 
-      1,   0,  76,   0,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 208,   7,   0,   0, 
-      1,   0,  76,   0,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 208,   7,   0,   0, 
-      1,   0,  76,   0,  12,   0, 
-      0,   0,  26,   1,  77,  17, 
-    128,   0,   0,   0, 172,  10, 
-      0,   0,   0,  16,   0,   0, 
-      7,   0,   9,   5,  13,  25, 
-      6,   2,   3, 131, 228,  13, 
-     53,   6,   4,   3,  20,  13, 
-     63,   6,   4,   3, 128, 212, 
-     13,  11,   6,   4,   3, 128, 
-    204,  13,  24,   6,   2,   3, 
-     28,   9,   9,  13,  21,   6, 
-      2,   3,  92,   9,  21,   3, 
-     28,   9,   5,  13,  24,  11, 
-     36,   9,   9,  13,  21,   6, 
-      2,   3,  92,   9,  21,   3, 
-     28,   9,   5,  13,  24,  11, 
-     36,   9,   9,  13,  21,   6, 
-      2,   3,  92,   9,  21,   3, 
-     28,   9,   5,  13,  13,  11, 
-     36,   4,  60,   8,   0,   9, 
-     11,  13,  24,   1, 132,  60, 
-      6,  27,   3,   0,   9,  23, 
-     13,  30,   6,   4,   3,  20, 
-      9,  33,  13,  40,   3,  52, 
-      9,  19,  13,  41,   3,  52, 
-      9,  44,  13,  51,   3,  28, 
-      9,  15,  13,  52,   3,  52, 
-      9,  19,  13,  30,   6,   4, 
-      3,  28,   9,  46,  13,  57, 
-      3,  48,   9,  34,  13,  58, 
-      3,  72,   9,  19,  13,  62, 
-      3,  28,   9,   5,  13,  10, 
-      6,   4,   3,  56,   9,   9, 
-     13,  16,   6,   2,   3,  28, 
-     13,  23,   3,  52,   9,   5, 
-     13,  24,   3,  28,   9,   9, 
-     13,  20,  11,  44,   9,  21, 
-     13,  21,   3,  28,   9,   9, 
-     13,  16,  11,  36,  13,  23, 
-      3,  52,   9,   5,  13,  24, 
-      3,  28,   9,   9,  13,  20, 
-     11,  44,   9,  21,  13,  21, 
-      3,  28,   9,   9,  13,  16, 
-     11,  36,  13,  23,   3,  52, 
-      9,   5,  13,  24,   3,  28, 
-      9,   9,  13,  20,  11,  44, 
-      9,  21,  13,  21,   3,  28, 
-      9,   5,  13,  13,  11,  36, 
-      4,  60,   0,   0,  70,   0, 
-     62,  17,  10,  16,   0,   0, 
-    136,   0,  60, 102, 105, 120, 
-     95,  99, 117,  98, 101,  95, 
-    108, 111, 111, 107, 117, 112, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 118,  97, 108, 117, 
-    101,  62,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 148,   7, 
-      0,   0,   1,   0,  60,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 168,   7, 
-      0,   0,   1,   0,  40,   0, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 188,   7, 
-      0,   0,   1,   0,  20,   0, 
-     12,   0,   0,   0,  42,   0, 
-     62,  17,   1,  16,   0,   0, 
-      9,   0, 118,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     60,   4,   0,   0,   1,   0, 
-    148,   3,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     60,   4,   0,   0,   1,   0, 
-    148,   3,   8,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     60,   4,   0,   0,   1,   0, 
-    148,   3,  12,   0,   0,   0, 
-     46,   0,  62,  17,  64,   0, 
-      0,   0,   1,   0,  99, 117, 
-     98, 101,  83, 105, 122, 101, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     60,   4,   0,   0,   1,   0, 
-    124,   1,   0,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 101, 112, 
-    115,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  80,   4,   0,   0, 
-      1,   0,   4,   3,  32,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-     77,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  36,   5, 
-      0,   0,   1,   0,   0,   1, 
-     36,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 115,  99,  97, 108, 
-    101,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 240,   5, 
-      0,   0,   1,   0, 224,   1, 
-      0,   0,   0,   0,   2,   0, 
-     78,  17,   2,   0,   6,   0, 
-    244,   0,   0,   0,  24,   0, 
-      0,   0,   1,   0,   0,   0, 
-     16,   1,   2,  28, 101,  54, 
-    199, 147, 181, 238,  44, 149, 
-    145, 117, 112, 209, 193,  82, 
-      0,   0, 242,   0,   0,   0, 
-    128,   7,   0,   0,   0,   0, 
-      0,   0,   1,   0,   1,   0, 
-     76,   8,   0,   0,   0,   0, 
-      0,   0, 158,   0,   0,   0, 
-    116,   7,   0,   0,  88,   0, 
-      0,   0, 100,   0,   0, 128, 
-     88,   0,   0,   0, 100,   0, 
-      0,   0, 128,   0,   0,   0, 
-    100,   0,   0, 128, 128,   0, 
-      0,   0, 100,   0,   0,   0, 
-    148,   0,   0,   0, 104,   0, 
-      0, 128, 148,   0,   0,   0, 
-    104,   0,   0,   0, 168,   0, 
-      0,   0, 104,   0,   0, 128, 
-    168,   0,   0,   0, 104,   0, 
-      0,   0, 196,   0,   0,   0, 
-    104,   0,   0, 128, 196,   0, 
-      0,   0, 104,   0,   0,   0, 
-    208,   0,   0,   0, 106,   0, 
-      0, 128, 208,   0,   0,   0, 
-    106,   0,   0,   0, 240,   0, 
-      0,   0, 106,   0,   0, 128, 
-    240,   0,   0,   0, 106,   0, 
-      0,   0,   8,   1,   0,   0, 
-    106,   0,   0, 128,   8,   1, 
-      0,   0, 106,   0,   0,   0, 
-     60,   1,   0,   0, 107,   0, 
-      0, 128,  60,   1,   0,   0, 
-    107,   0,   0,   0,  92,   1, 
-      0,   0, 107,   0,   0, 128, 
-     92,   1,   0,   0, 107,   0, 
-      0,   0, 116,   1,   0,   0, 
-    107,   0,   0, 128, 116,   1, 
-      0,   0, 107,   0,   0,   0, 
-    168,   1,   0,   0, 108,   0, 
-      0, 128, 168,   1,   0,   0, 
-    108,   0,   0,   0, 200,   1, 
-      0,   0, 108,   0,   0, 128, 
-    200,   1,   0,   0, 108,   0, 
-      0,   0, 224,   1,   0,   0, 
-    108,   0,   0, 128, 224,   1, 
-      0,   0, 108,   0,   0,   0, 
-     20,   2,   0,   0, 109,   0, 
-      0, 128,  20,   2,   0,   0, 
-    109,   0,   0,   0,  52,   2, 
-      0,   0, 109,   0,   0, 128, 
-     52,   2,   0,   0, 109,   0, 
-      0,   0,  76,   2,   0,   0, 
-    109,   0,   0, 128,  76,   2, 
-      0,   0, 109,   0,   0,   0, 
-    128,   2,   0,   0, 110,   0, 
-      0, 128, 128,   2,   0,   0, 
-    110,   0,   0,   0, 160,   2, 
-      0,   0, 110,   0,   0, 128, 
-    160,   2,   0,   0, 110,   0, 
-      0,   0, 184,   2,   0,   0, 
-    110,   0,   0, 128, 184,   2, 
-      0,   0, 110,   0,   0,   0, 
-    236,   2,   0,   0, 111,   0, 
-      0, 128, 236,   2,   0,   0, 
-    111,   0,   0,   0,  12,   3, 
-      0,   0, 111,   0,   0, 128, 
-     12,   3,   0,   0, 111,   0, 
-      0,   0,  36,   3,   0,   0, 
-    111,   0,   0, 128,  36,   3, 
-      0,   0, 111,   0,   0,   0, 
-     88,   3,   0,   0, 112,   0, 
-      0, 128,  88,   3,   0,   0, 
-    112,   0,   0,   0, 116,   3, 
-      0,   0, 112,   0,   0, 128, 
-    116,   3,   0,   0, 112,   0, 
-      0,   0, 144,   3,   0,   0, 
-    112,   0,   0, 128, 144,   3, 
-      0,   0, 112,   0,   0,   0, 
-    172,   3,   0,   0, 112,   0, 
-      0, 128, 172,   3,   0,   0, 
-    112,   0,   0,   0, 200,   3, 
-      0,   0, 112,   0,   0, 128, 
-    200,   3,   0,   0, 112,   0, 
-      0,   0, 228,   3,   0,   0, 
-    112,   0,   0, 128, 228,   3, 
-      0,   0, 112,   0,   0,   0, 
-     12,   4,   0,   0, 113,   0, 
-      0, 128,  12,   4,   0,   0, 
-    113,   0,   0,   0,  16,   4, 
-      0,   0, 116,   0,   0, 128, 
-     16,   4,   0,   0, 116,   0, 
-      0,   0,  20,   4,   0,   0, 
-    116,   0,   0, 128,  20,   4, 
-      0,   0, 116,   0,   0,   0, 
-     40,   4,   0,   0, 116,   0, 
-      0, 128,  40,   4,   0,   0, 
-    116,   0,   0,   0,  60,   4, 
-      0,   0, 116,   0,   0, 128, 
-     60,   4,   0,   0, 116,   0, 
-      0,   0,  80,   4,   0,   0, 
-    116,   0,   0, 128,  80,   4, 
-      0,   0, 116,   0,   0,   0, 
-    104,   4,   0,   0, 116,   0, 
-      0, 128, 104,   4,   0,   0, 
-    116,   0,   0,   0, 132,   4, 
-      0,   0, 116,   0,   0, 128, 
-    132,   4,   0,   0, 116,   0, 
-      0,   0, 156,   4,   0,   0, 
-    116,   0,   0, 128, 156,   4, 
-      0,   0, 116,   0,   0,   0, 
-    184,   4,   0,   0, 116,   0, 
-      0, 128, 184,   4,   0,   0, 
-    116,   0,   0,   0, 212,   4, 
-      0,   0, 116,   0,   0, 128, 
-    212,   4,   0,   0, 116,   0, 
-      0,   0, 236,   4,   0,   0, 
-    116,   0,   0, 128, 236,   4, 
-      0,   0, 116,   0,   0,   0, 
-      8,   5,   0,   0, 116,   0, 
-      0, 128,   8,   5,   0,   0, 
-    116,   0,   0,   0,  36,   5, 
-      0,   0, 116,   0,   0, 128, 
-     36,   5,   0,   0, 116,   0, 
-      0,   0,  56,   5,   0,   0, 
-    116,   0,   0, 128,  56,   5, 
-      0,   0, 116,   0,   0,   0, 
-     84,   5,   0,   0, 116,   0, 
-      0, 128,  84,   5,   0,   0, 
-    116,   0,   0,   0, 104,   5, 
-      0,   0, 116,   0,   0, 128, 
-    104,   5,   0,   0, 116,   0, 
-      0,   0, 128,   5,   0,   0, 
-    116,   0,   0, 128, 128,   5, 
-      0,   0, 116,   0,   0,   0, 
-    156,   5,   0,   0, 116,   0, 
-      0, 128, 156,   5,   0,   0, 
-    116,   0,   0,   0, 184,   5, 
-      0,   0, 116,   0,   0, 128, 
-    184,   5,   0,   0, 116,   0, 
-      0,   0, 204,   5,   0,   0, 
-    116,   0,   0, 128, 204,   5, 
-      0,   0, 116,   0,   0,   0, 
-    240,   5,   0,   0, 116,   0, 
-      0, 128, 240,   5,   0,   0, 
-    116,   0,   0,   0,  12,   6, 
-      0,   0, 116,   0,   0, 128, 
-     12,   6,   0,   0, 116,   0, 
-      0,   0,  36,   6,   0,   0, 
-    116,   0,   0, 128,  36,   6, 
-      0,   0, 116,   0,   0,   0, 
-     64,   6,   0,   0, 116,   0, 
-      0, 128,  64,   6,   0,   0, 
-    116,   0,   0,   0,  92,   6, 
-      0,   0, 116,   0,   0, 128, 
-     92,   6,   0,   0, 116,   0, 
-      0,   0, 104,   6,   0,   0, 
-    116,   0,   0, 128, 104,   6, 
-      0,   0, 116,   0,   0,   0, 
-    132,   6,   0,   0, 116,   0, 
-      0, 128, 132,   6,   0,   0, 
-    116,   0,   0,   0, 136,   6, 
-      0,   0, 116,   0,   0, 128, 
-    136,   6,   0,   0, 116,   0, 
-      0,   0, 160,   6,   0,   0, 
-    116,   0,   0, 128, 160,   6, 
-      0,   0, 116,   0,   0,   0, 
-    188,   6,   0,   0, 116,   0, 
-      0, 128, 188,   6,   0,   0, 
-    116,   0,   0,   0, 216,   6, 
-      0,   0, 116,   0,   0, 128, 
-    216,   6,   0,   0, 116,   0, 
-      0,   0, 228,   6,   0,   0, 
-    116,   0,   0, 128, 228,   6, 
-      0,   0, 116,   0,   0,   0, 
-      0,   7,   0,   0, 116,   0, 
-      0, 128,   0,   7,   0,   0, 
-    116,   0,   0,   0,   4,   7, 
-      0,   0, 116,   0,   0, 128, 
-      4,   7,   0,   0, 116,   0, 
-      0,   0,  28,   7,   0,   0, 
-    116,   0,   0, 128,  28,   7, 
-      0,   0, 116,   0,   0,   0, 
-     56,   7,   0,   0, 116,   0, 
-      0, 128,  56,   7,   0,   0, 
-    116,   0,   0,   0,  84,   7, 
-      0,   0, 116,   0,   0, 128, 
-     84,   7,   0,   0, 116,   0, 
-      0,   0,  96,   7,   0,   0, 
-    116,   0,   0, 128,  96,   7, 
-      0,   0, 116,   0,   0,   0, 
-    124,   7,   0,   0, 116,   0, 
-      0, 128, 124,   7,   0,   0, 
-    116,   0,   0,   0, 128,   7, 
-      0,   0, 116,   0,   0, 128, 
-    128,   7,   0,   0, 116,   0, 
-      0,   0, 148,   7,   0,   0, 
-    116,   0,   0, 128, 148,   7, 
-      0,   0, 116,   0,   0,   0, 
-    168,   7,   0,   0, 116,   0, 
-      0, 128, 168,   7,   0,   0, 
-    116,   0,   0,   0, 188,   7, 
-      0,   0, 116,   0,   0, 128, 
-    188,   7,   0,   0, 116,   0, 
-      0,   0, 208,   7,   0,   0, 
-    117,   0,   0, 128, 208,   7, 
-      0,   0, 117,   0,   0,   0, 
-    232,   7,   0,   0, 117,   0, 
-      0, 128, 232,   7,   0,   0, 
-    117,   0,   0,   0,  28,   8, 
-      0,   0, 118,   0,   0, 128, 
-     28,   8,   0,   0, 118,   0, 
-      0,   0,  32,   8,   0,   0, 
-    123,   0,   0, 128,  32,   8, 
-      0,   0, 123,   0,   0,   0, 
-     52,   8,   0,   0, 125,   0, 
-      0, 128,  52,   8,   0,   0, 
-    125,   0,   0,   0,  72,   8, 
-      0,   0, 125,   0,   0, 128, 
-     72,   8,   0,   0, 125,   0, 
-      0,   0,   5,   0,  74,   0, 
-      5,   0,  73,   0,   5,   0, 
-     74,   0,   5,   0,  73,   0, 
-      5,   0,  19,   0,   9,   0, 
-     18,   0,   5,   0,  19,   0, 
-      9,   0,  18,   0,   5,   0, 
-     19,   0,   5,   0,  19,   0, 
-      9,   0,  95,   0,  61,   0, 
-     76,   0,   9,   0,  95,   0, 
-     21,   0,  94,   0,   9,   0, 
-     95,   0,  21,   0,  94,   0, 
-      9,   0,  95,   0,  61,   0, 
-     76,   0,   9,   0,  95,   0, 
-     21,   0,  94,   0,   9,   0, 
-     95,   0,  21,   0,  94,   0, 
-      9,   0,  95,   0,  61,   0, 
-     76,   0,   9,   0,  95,   0, 
-     21,   0,  94,   0,   9,   0, 
-     95,   0,  21,   0,  94,   0, 
-      9,   0,  95,   0,  61,   0, 
-     76,   0,   9,   0,  95,   0, 
-     21,   0,  94,   0,   9,   0, 
-     95,   0,  21,   0,  94,   0, 
-      9,   0,  95,   0,  61,   0, 
-     76,   0,   9,   0,  95,   0, 
-     21,   0,  94,   0,   9,   0, 
-     95,   0,  21,   0,  94,   0, 
-      9,   0,  95,   0,  61,   0, 
-     76,   0,   9,   0,  95,   0, 
-     21,   0,  94,   0,   9,   0, 
-     95,   0,  21,   0,  94,   0, 
-      9,   0,  55,   0,  21,   0, 
-     27,   0,   9,   0,  55,   0, 
-     21,   0,  32,   0,   9,   0, 
-     55,   0,  21,   0,  37,   0, 
-      9,   0,  55,   0,  21,   0, 
-     42,   0,   9,   0,  55,   0, 
-     21,   0,  47,   0,   9,   0, 
-     55,   0,  20,   0,  54,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     34,   0,  67,   0,   9,   0, 
-     68,   0,  34,   0,  67,   0, 
-      9,   0,  68,   0,  34,   0, 
-     67,   0,   9,   0,  68,   0, 
-     16,   0,  67,   0,   9,   0, 
-     93,   0,  20,   0,  92,   0, 
-      9,   0,  93,   0,  20,   0, 
-     92,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-     28,   0,   5,   0,  27,   0, 
-      5,   0,  18,   0,   5,   0, 
-     18,   0,   5,   0,  18,   0, 
-      5,   0,  18,   0, 246,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     75,   0,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-     20,   0,   0,   0,  56,   0, 
-      0,   0,  92,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,  20,  16, 
-      0,   0, 144,   1,   0,   0, 
-     10,   0, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0,  80,   0, 
-      0,   0,  80,   0,   0,   0, 
-      8,   0,   0,   0,  88,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   4,   0,   0,   0, 
-     16,   0, 102, 108, 111,  97, 
-    116,  52,   0, 243, 242, 241, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   3,   0,   0,   0, 
-     12,   0, 102, 108, 111,  97, 
-    116,  51,   0, 243, 242, 241, 
-     62,   0,   3,  18,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0, 112, 111, 115, 105, 
-    116, 105, 111, 110,   0, 241, 
-     13,  21,   3,   0,   1,  16, 
-      0,   0,  16,   0, 110, 111, 
-    114, 109,  97, 108,   0, 243, 
-    242, 241,  13,  21,   3,   0, 
-    117,   0,   0,   0,  28,   0, 
-     82,  84,  73, 110, 100, 101, 
-    120,   0, 242, 241,  38,   0, 
-      5,  21,   3,   0,   0,   0, 
-      2,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-      0, 241,  10,   0,   1,  18, 
-      1,   0,   0,   0,   3,  16, 
-      0,   0,  18,   0,   3,  18, 
-     13,  21,   3,   0,   0,  16, 
-      0,   0,   0,   0,  99, 111, 
-    108, 111, 114,   0,  38,   0, 
-      5,  21,   1,   0,   0,   0, 
-      5,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  79, 117, 116,   0, 243, 
-    242, 241,  10,   0,  24,  21, 
-      6,  16,   0,   0,   1,   0, 
-      1,   0,  14,   0,   8,  16, 
-      7,  16,   0,   0,  23,   0, 
-      1,   0,   4,  16,   0,   0, 
-     14,   0,   1,  18,   2,   0, 
-      0,   0,   1,  16,   0,   0, 
-     64,   0,   0,   0,  10,   0, 
-     24,  21,   1,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,  10,  16,   0,   0, 
-     23,   0,   2,   0,   9,  16, 
-      0,   0,  14,   0,  23,  21, 
-      0,  16,   0,   0,   6,   2, 
-     16,  15,   0,   0, 242, 241, 
-     10,   0,  24,  21,  12,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,  13,  16, 
-      0,   0,   1,   0,   0,   2, 
-     10,   0,  24,  21, 117,   0, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,  15,  16, 
-      0,   0,   1,   0,   0,   2, 
-     14,   0,  23,  21,   0,   0, 
-      0,   0,  10,   2,  16,  15, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,  17,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  18,  16,   0,   0, 
-      1,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,  89,   3,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  44,  32,  43,  49, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     99,  97, 115, 101,  32,  53, 
-     58,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  51,  40,  45, 
-    117,  44,  32,  43, 118,  44, 
-     32,  45,  49,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 100, 101, 102, 
-     97, 117, 108, 116,  58,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32,  48,  59,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10, 125,  13,  10,  13,  10, 
-     91, 109,  97, 120, 118, 101, 
-    114, 116, 101, 120,  99, 111, 
-    117, 110, 116,  40,  49,  56, 
-     41,  93,  13,  10, 118, 111, 
-    105, 100,  32, 103, 115,  40, 
-    116, 114, 105,  97, 110, 103, 
-    108, 101,  32,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  32, 105, 110, 112, 117, 
-    116,  91,  51,  93,  44,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 105, 110, 
-    111, 117, 116,  32,  84, 114, 
-    105,  97, 110, 103, 108, 101, 
-     83, 116, 114, 101,  97, 109, 
-     60,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-     73, 110, 112, 117, 116,  62, 
-     32, 111, 117, 116,  83, 116, 
-    114, 101,  97, 109,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 102, 111, 114,  32, 
-     40, 105, 110, 116,  32, 102, 
-     32,  61,  32,  48,  59,  32, 
-    102,  32,  60,  32,  54,  59, 
-     32,  43,  43, 102,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,  32, 111, 117, 116, 
-    112, 117, 116,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 111, 117, 116, 112, 
-    117, 116,  46,  82,  84,  73, 
-    110, 100, 101, 120,  32,  61, 
-     32, 102,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 111, 114,  32,  40, 
-    105, 110, 116,  32, 118,  32, 
-     61,  32,  48,  59,  32, 118, 
-     32,  60,  32,  51,  59,  32, 
-    118,  43,  43,  41,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112,  32,  61,  32, 105, 110, 
-    112, 117, 116,  91, 118,  93, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47, 111, 117, 116, 112, 
-    117, 116,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  32, 
-     61,  32, 109, 117, 108,  40, 
-    105, 110, 112, 117, 116,  91, 
-    118,  93,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  44, 
-     32,  67, 117,  98, 101,  70, 
-     97,  99, 101,  86, 105, 101, 
-    119,  80, 114, 111, 106,  91, 
-    102,  93,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47, 111, 117, 116, 112, 
-    117, 116,  46, 110, 111, 114, 
-    109,  97, 108,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40,  48, 
-     44,  32,  48,  44,  32,  49, 
-     44,  32,  48,  41,  44,  32, 
-     67, 117,  98, 101,  70,  97, 
-     99, 101,  86, 105, 101, 119, 
-     80, 114, 111, 106,  91, 102, 
-     93,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 111, 
-    117, 116, 112, 117, 116,  46, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  61,  32, 112, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 111, 117, 116, 
-    112, 117, 116,  46, 110, 111, 
-    114, 109,  97, 108,  32,  61, 
-     32, 103, 101, 116,  86, 101, 
-    114, 116, 101, 120,  68, 105, 
-    114, 101,  99, 116, 105, 111, 
-    110,  40, 102,  44,  32, 112, 
-     46, 120,  44,  32, 112,  46, 
-    121,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 111, 
-    117, 116,  83, 116, 114, 101, 
-     97, 109,  46,  65, 112, 112, 
-    101, 110, 100,  40, 111, 117, 
-    116, 112, 117, 116,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 125,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 111, 117, 116, 
-     83, 116, 114, 101,  97, 109, 
-     46,  82, 101, 115, 116,  97, 
-    114, 116,  83, 116, 114, 105, 
-    112,  40,  41,  59,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10, 125,  13,  10,  13,  10, 
-    102, 108, 111,  97, 116,  51, 
-     32, 102, 105, 120,  95,  99, 
-    117,  98, 101,  95, 108, 111, 
-    111, 107, 117, 112,  40, 102, 
-    108, 111,  97, 116,  51,  32, 
-    118,  44,  32, 102, 108, 111, 
-     97, 116,  32,  99, 117,  98, 
-    101,  83, 105, 122, 101,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 101, 112, 115, 
-     32,  61,  32,  49,  32,  45, 
-     32,  49, 101,  45,  54,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  77,  32,  61,  32, 
-    109,  97, 120,  40, 109,  97, 
-    120,  40,  97,  98, 115,  40, 
-    118,  46, 120,  41,  44,  32, 
-     97,  98, 115,  40, 118,  46, 
-    121,  41,  41,  44,  32,  97, 
-     98, 115,  40, 118,  46, 122, 
-     41,  41,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 115, 
-     99,  97, 108, 101,  32,  61, 
-     32,  99, 117,  98, 101,  83, 
-    105, 122, 101,  32,  62,  32, 
-     49,  32,  63,  32,  99, 117, 
-     98, 101,  83, 105, 122, 101, 
-     32,  47,  32,  40,  99, 117, 
-     98, 101,  83, 105, 122, 101, 
-     32,  45,  32,  49,  41,  32, 
-     58,  32,  49,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    118,  32,  47,  61,  32,  77, 
-     59,  13,  10,  32,  32,  32, 
-     32, 105, 102,  32,  40,  97, 
-     98, 115,  40, 118,  46, 120, 
-     41,  32,  60,  61,  32, 101, 
-    112, 115,  41,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 118,  46, 120,  32,  42, 
-     61,  32, 115,  99,  97, 108, 
-    101,  59,  13,  10,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-     97,  98, 115,  40, 118,  46, 
-    121,  41,  32,  60,  61,  32, 
-    101, 112, 115,  41,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 118,  46, 121,  32, 
-     42,  61,  32, 115,  99,  97, 
-    108, 101,  59,  13,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40,  97,  98, 115,  40, 118, 
-     46, 122,  41,  32,  60,  61, 
-     32, 101, 112, 115,  41,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 118,  46, 122, 
-     32,  42,  61,  32, 115,  99, 
-     97, 108, 101,  59,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  79, 117, 116,  32, 112, 
-    115,  40,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-     32, 112, 115, 105,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  79, 117, 116,  32, 111, 
-    117, 116, 112, 117, 116,  59, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 111, 117, 116, 112, 
-    117, 116,  46,  99, 111, 108, 
-    111, 114,  32,  61,  32, 102, 
-    108, 111,  97, 116,  52,  40, 
-    112, 115, 105,  46, 110, 111, 
-    114, 109,  97, 108,  32,  42, 
-     32,  48,  46,  53,  32,  43, 
-     32,  48,  46,  53,  44,  32, 
-     49,  41,  59,  13,  10,  32, 
-     32,  32,  32,  47,  47, 111, 
-    117, 116, 112, 117, 116,  46, 
-     99, 111, 108, 111, 114,  32, 
-     61,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  76, 101, 
-    118, 101, 108,  40, 105, 110, 
-    112, 117, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    112, 115, 105,  46, 110, 111, 
-    114, 109,  97, 108,  44,  32, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,  41,  59,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47, 114, 101, 116, 117, 114, 
-    110,  32, 111, 117, 116, 112, 
-    117, 116,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32, 117, 
-    105, 110, 116,  32, 119, 105, 
-    100, 116, 104,  44,  32, 104, 
-    101, 105, 103, 104, 116,  44, 
-     32, 109, 105, 112,  67, 111, 
-    117, 110, 116,  59,  13,  10, 
-     32,  32,  32,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     71, 101, 116,  68, 105, 109, 
-    101, 110, 115, 105, 111, 110, 
-    115,  40,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,  44, 
-     32, 119, 105, 100, 116, 104, 
-     44,  32, 104, 101, 105, 103, 
-    104, 116,  44,  32, 109, 105, 
-    112,  67, 111, 117, 110, 116, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32, 111, 
-    117, 116,  67, 111, 108, 111, 
-    114,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40, 119, 105, 100, 116, 
-    104,  32,  60,  61,  32,  49, 
-     41,  13,  10,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32,  99,  49,  32,  61,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40,  43, 
-     49,  44,  32,  48,  44,  32, 
-     48,  41,  44,  32,  67, 117, 
-    114, 114, 101, 110, 116,  77, 
-    105, 112,  76, 101, 118, 101, 
-    108,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32,  99,  50,  32,  61, 
-     32,  83, 111, 117, 114,  99, 
-    101,  67, 117,  98, 101,  77, 
-     97, 112,  46,  83,  97, 109, 
-    112, 108, 101,  76, 101, 118, 
-    101, 108,  40, 105, 110, 112, 
-    117, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     45,  49,  44,  32,  48,  44, 
-     32,  48,  41,  44,  32,  67, 
-    117, 114, 114, 101, 110, 116, 
-     77, 105, 112,  76, 101, 118, 
-    101, 108,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32,  99,  51,  32, 
-     61,  32,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  76, 101, 
-    118, 101, 108,  40, 105, 110, 
-    112, 117, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  48,  44,  32,  43,  49, 
-     44,  32,  48,  41,  44,  32, 
-     67, 117, 114, 114, 101, 110, 
-    116,  77, 105, 112,  76, 101, 
-    118, 101, 108,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32,  99,  52, 
-     32,  61,  32,  83, 111, 117, 
-    114,  99, 101,  67, 117,  98, 
-    101,  77,  97, 112,  46,  83, 
-     97, 109, 112, 108, 101,  76, 
-    101, 118, 101, 108,  40, 105, 
-    110, 112, 117, 116,  83,  97, 
-    109, 112, 108, 101, 114,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  48,  44,  32,  45, 
-     49,  44,  32,  48,  41,  44, 
-     32,  67, 117, 114, 114, 101, 
-    110, 116,  77, 105, 112,  76, 
-    101, 118, 101, 108,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-     53,  32,  61,  32,  83, 111, 
-    117, 114,  99, 101,  67, 117, 
-     98, 101,  77,  97, 112,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-    105, 110, 112, 117, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  40,  48,  44,  32, 
-     48,  44,  32,  43,  49,  41, 
-     44,  32,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99,  54,  32,  61,  32,  83, 
-    111, 117, 114,  99, 101,  67, 
-    117,  98, 101,  77,  97, 112, 
-     46,  83,  97, 109, 112, 108, 
-    101,  76, 101, 118, 101, 108, 
-     40, 105, 110, 112, 117, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  51,  40,  48,  44, 
-     32,  48,  44,  32,  45,  49, 
-     41,  44,  32,  67, 117, 114, 
-    114, 101, 110, 116,  77, 105, 
-    112,  76, 101, 118, 101, 108, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    111, 117, 116,  67, 111, 108, 
-    111, 114,  32,  61,  32,  40, 
-     99,  49,  32,  43,  32,  99, 
-     50,  32,  43,  32,  99,  51, 
-     32,  43,  32,  99,  52,  32, 
-     43,  32,  99,  53,  32,  43, 
-     32,  99,  54,  41,  32,  47, 
-     32,  54,  46,  48,  59,  13, 
-     10,  32,  32,  32,  32, 125, 
-     13,  10,  32,  32,  32,  32, 
-    101, 108, 115, 101,  13,  10, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 101, 110, 
-    118,  68, 105, 102, 102, 117, 
-    115, 101,  67, 111, 111, 114, 
-    100,  32,  61,  32, 102, 105, 
-    120,  95,  99, 117,  98, 101, 
-     95, 108, 111, 111, 107, 117, 
-    112,  40, 112, 115, 105,  46, 
-    110, 111, 114, 109,  97, 108, 
-     44,  32, 119, 105, 100, 116, 
-    104,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 111, 117, 116,  67, 111, 
-    108, 111, 114,  32,  61,  32, 
-     83, 111, 117, 114,  99, 101, 
-     67, 117,  98, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 101, 110, 
-    118,  68, 105, 102, 102, 117, 
-    115, 101,  67, 111, 111, 114, 
-    100,  44,  32,  67, 117, 114, 
-    114, 101, 110, 116,  77, 105, 
-    112,  76, 101, 118, 101, 108, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  71,  97, 109, 109, 
-     97,  32,  99, 111, 114, 114, 
-    101,  99, 116,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-    111, 117, 116,  67, 111, 108, 
-    111, 114,  46, 114, 103,  98, 
-     32,  61,  32, 112, 111, 119, 
-     40, 111, 117, 116,  67, 111, 
-    108, 111, 114,  46, 114, 103, 
-     98,  44,  32,  49,  46,  48, 
-    102,  32,  47,  32,  50,  46, 
-     50, 102,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    111, 117, 116, 112, 117, 116, 
-     46,  99, 111, 108, 111, 114, 
-     32,  61,  32, 111, 117, 116, 
-     67, 111, 108, 111, 114,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 111, 117, 116, 
-    112, 117, 116,  59,  13,  10, 
-    125,  13,  10,   0,   7,   0, 
-      0,   0,  69,   0,   0,   0, 
-     68,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 136,   0,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,   1,  16,   0,   0, 
-     28,   0,   0,   0,  11,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-      4,   0,   0,   0,   8,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-      1,  22,   0,   0,   0,   0, 
-     11,  16,   0,   0, 102, 105, 
-    120,  95,  99, 117,  98, 101, 
-     95, 108, 111, 111, 107, 117, 
-    112,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  68,  51, 
-     68,  83,  72,  68,  82,   0, 
-     76,   8,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,  96,   4,   0,   0,   0, 
-      8,   0,   0,   0,  12,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,   1,  22,   0,   0, 
-      0,   0,  11,  16,   0,   0, 
-    102, 105, 120,  95,  99, 117, 
-     98, 101,  95, 108, 111, 111, 
-    107, 117, 112,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,  32,   0,   0,   0, 
-     20,   2,   0,   0,  93,   0, 
-      0,   0,   1,   0,   0,   0, 
-     21,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  57,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   4, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   4,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  12,   0, 
-      0,   0,  24,   0,   0,   0, 
-     36,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  18,   0, 
-     37,  17,   0,   0,   0,   0, 
-    128,   0,   0,   0,   1,   0, 
-    112, 115,   0,   0,   0,   0, 
-     34,   0,  81,  17,  14,  16, 
-      0,   0,   7,   0, 255, 255, 
-    255, 255,   0,   0, 255, 255, 
-    255, 255,  83, 111, 117, 114, 
-     99, 101,  67, 117,  98, 101, 
-     77,  97, 112,   0,   0,   0, 
-     34,   0,  81,  17,  16,  16, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255,  67, 117, 114, 114, 
-    101, 110, 116,  77, 105, 112, 
-     76, 101, 118, 101, 108,   0, 
-     34,   0,  81,  17,  19,  16, 
-      0,   0,   6,   0, 255, 255, 
-    255, 255, 255, 255,   0,   0, 
-    255, 255, 105, 110, 112, 117, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    119,   9,  49,   1,   1,   0, 
-      0,   0,  13,   0,  10, 140, 
-     14,   0, 180, 156,  15,   0, 
-     11,   0,  72,   0,   0,   0, 
-     32,   0,   0,   0,  44,   0, 
-      0,   0,  80,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,   0,   0, 
-     25,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     76,   8,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   9,   0, 
-    180,  10,   0,   0,   0,   0, 
-      0,   0, 192,   7,   0,   0, 
-      1,   0,   0,   0, 160,  50, 
-     20,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0, 112, 115, 
-      0, 110, 111, 110, 101,   0, 
-     45, 186,  46, 241,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     76,   8,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   2,   0, 
-      7,   0,   0,   0,   0,   0, 
-      1,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  76,   8, 
-      0,   0,   8,   2,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,  67,  58, 
-     92, 100, 101, 118,  92,  51, 
-    114, 100,  80,  97, 114, 116, 
-    121,  92,  68, 105, 114, 101, 
-     99, 116,  88,  84, 101, 120, 
-     92,  76, 101, 103,  97,  99, 
-    121,  67, 117,  98, 101,  77, 
-     97, 112,  69, 100, 103, 101, 
-     70, 105, 120, 101, 114,  92, 
-     67, 117,  98, 101,  83, 116, 
-    114, 101, 116,  99, 104, 101, 
-    114,  46, 102, 120,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  12, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1,  27,  69, 170,  91, 
-      1,   0,   0,   0,  68,  34, 
-    226, 194, 128,  43, 218,  66, 
-    157,  12,  24, 253,  72,  35, 
-     55, 210, 112,   0,   0,   0, 
-     47,  76, 105, 110, 107,  73, 
-    110, 102, 111,   0,  47, 110, 
-     97, 109, 101, 115,   0,  47, 
-    115, 114,  99,  47, 104, 101, 
-     97, 100, 101, 114,  98, 108, 
-    111,  99, 107,   0,  47, 115, 
-    114,  99,  47, 102, 105, 108, 
-    101, 115,  47,  99,  58,  92, 
-    100, 101, 118,  92,  51, 114, 
-    100, 112,  97, 114, 116, 121, 
-     92, 100, 105, 114, 101,  99, 
-    116, 120, 116, 101, 120,  92, 
-    108, 101, 103,  97,  99, 121, 
-     99, 117,  98, 101, 109,  97, 
-    112, 101, 100, 103, 101, 102, 
-    105, 120, 101, 114,  92,  99, 
-    117,  98, 101, 115, 116, 114, 
-    101, 116,  99, 104, 101, 114, 
-     46, 102, 120,   0,   4,   0, 
-      0,   0,   6,   0,   0,   0, 
-      1,   0,   0,   0,  30,   0, 
-      0,   0,   0,   0,   0,   0, 
-     17,   0,   0,   0,   7,   0, 
-      0,   0,  34,   0,   0,   0, 
-      8,   0,   0,   0,  10,   0, 
-      0,   0,   6,   0,   0,   0, 
-      0,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,  32,   0, 
-      0,   0, 204,   0,   0,   0, 
-    200,   1,   0,   0,  83,   1, 
-      0,   0,  84,   0,   0,   0, 
-      0,   0,   0,   0,  34,  14, 
-      0,   0, 128,   0,   0,   0, 
-    105,  13,   0,   0, 136,  18, 
-      0,   0,  88,   0,   0,   0, 
-     12,   0,   0,   0,  40,   0, 
-      0,   0,  68,   2,   0,   0, 
-     44,   0,   0,   0, 128,   0, 
-      0,   0,   3,   0,   0,   0, 
-     42,   0,   0,   0,  27,   0, 
-      0,   0,  41,   0,   0,   0, 
-     35,   0,   0,   0,  15,   0, 
-      0,   0,   6,   0,   0,   0, 
-     29,   0,   0,   0,  30,   0, 
-      0,   0,  31,   0,   0,   0, 
-     32,   0,   0,   0,  33,   0, 
-      0,   0,  34,   0,   0,   0, 
-     16,   0,   0,   0,   8,   0, 
-      0,   0,   9,   0,   0,   0, 
-     10,   0,   0,   0,  11,   0, 
-      0,   0,  12,   0,   0,   0, 
-     13,   0,   0,   0,  14,   0, 
-      0,   0,  17,   0,   0,   0, 
-     18,   0,   0,   0,  19,   0, 
-      0,   0,  20,   0,   0,   0, 
-     21,   0,   0,   0,  22,   0, 
-      0,   0,  23,   0,   0,   0, 
-     24,   0,   0,   0,  25,   0, 
-      0,   0,  26,   0,   0,   0, 
-      7,   0,   0,   0,  28,   0, 
-      0,   0,  36,   0,   0,   0, 
-     37,   0,   0,   0,  38,   0, 
-      0,   0,  40,   0,   0,   0, 
-     39,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  43,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  73,  76,  68,  78, 
-     44,   0,   0,   0,   0,   0, 
-     36,   0,  57,  51,  48,  48, 
-     48, 100,  49,  55,  53,  50, 
-     56,  52,  48, 100,  55,  57, 
-     53,  55,  99,  48,  57,  55, 
-     51, 100,  52,  52,  52,  48, 
-     57,  98,  52, 101,  46, 112, 
-    100,  98,   0,   0,   0,   0
-};
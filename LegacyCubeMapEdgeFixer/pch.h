@@ -8,7 +8,6 @@
 #include <assert.h>
 #include <stdio.h>
 #include <dxgiformat.h>
-#include <d3d11.h>
 #include <iostream>
 
 #include <algorithm>
@@ -62,6 +62,8 @@ enum COMMANDS
     CMD_V_STRIP,
     CMD_MERGE,
     CMD_GIF,
+    CMD_CUBE_FROM_EQUIRECT,
+    CMD_EQUIRECT,
     CMD_MAX
 };
 
@@ -119,6 +121,8 @@ const SValue g_pCommands[] =
     { L"v-strip",   CMD_V_STRIP },
     { L"merge",     CMD_MERGE },
     { L"gif",       CMD_GIF },
+    { L"cube-from-equirect", CMD_CUBE_FROM_EQUIRECT },
+    { L"equirect",  CMD_EQUIRECT },
     { nullptr,      0 }
 };
 
@@ -511,7 +515,9 @@ namespace
         wprintf(L"   h-cross or v-cross  create a cross image from a cubemap\n");
         wprintf(L"   h-strip or v-strip  create a strip image from a cubemap\n");
         wprintf(L"   merge               create texture from rgb image and alpha image\n");
-        wprintf(L"   gif                 create array from animated gif\n\n");
+        wprintf(L"   gif                 create array from animated gif\n");
+        wprintf(L"   cube-from-equirect  create cubemap from a latitude-longitude panorama\n");
+        wprintf(L"   equirect            create a latitude-longitude panorama from a cubemap\n\n");
         wprintf(L"   -r                  wildcard filename search is recursive\n");
         wprintf(L"   -w <n>              width\n");
         wprintf(L"   -h <n>              height\n");
@@ -958,10 +964,12 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
     case CMD_V_STRIP:
     case CMD_MERGE:
     case CMD_GIF:
+    case CMD_CUBE_FROM_EQUIRECT:
+    case CMD_EQUIRECT:
         break;
 
     default:
-        wprintf(L"Must use one of: cube, volume, array, cubearray,\n   h-cross, v-cross, h-strip, v-strip\n   merge, gif\n\n");
+        wprintf(L"Must use one of: cube, volume, array, cubearray,\n   h-cross, v-cross, h-strip, v-strip\n   merge, gif, cube-from-equirect, equirect\n\n");
         return 1;
     }
 
@@ -1090,6 +1098,7 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
                 case CMD_H_STRIP:
                 case CMD_V_STRIP:
                 case CMD_MERGE:
+                case CMD_EQUIRECT:
                     break;
 
                 default:
@@ -1208,9 +1217,11 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
     case CMD_H_STRIP:
     case CMD_V_STRIP:
     case CMD_GIF:
+    case CMD_CUBE_FROM_EQUIRECT:
+    case CMD_EQUIRECT:
         if (conversion.size() > 1)
         {
-            wprintf(L"ERROR: cross/strip/gif output only accepts 1 input file\n");
+            wprintf(L"ERROR: cross/strip/gif/equirect output only accepts 1 input file\n");
             return 1;
         }
         break;
@@ -1272,6 +1283,10 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
                     _wmakepath_s(szOutputFile, nullptr, nullptr, fname, L".bmp");
                     break;
 
+                case CMD_EQUIRECT:
+                    wprintf(L"ERROR: Need to specify output file via -o\n");
+                    return 1;
+
                 default:
                     if (_wcsicmp(ext, L".dds") == 0)
                     {
@@ -1301,6 +1316,7 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
             case CMD_V_CROSS:
             case CMD_H_STRIP:
             case CMD_V_STRIP:
+            case CMD_EQUIRECT:
                 if (_wcsicmp(ext, L".dds") == 0)
                 {
                     hr = LoadFromDDSFile(pConv->szSrc, DDS_FLAGS_NONE, &info, *image);
@@ -1317,7 +1333,7 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
                     }
                     else if (info.arraySize != 6)
                     {
-                        wprintf(L"\nWARNING: Only the first cubemap in an array is written out as a cross/strip\n");
+                        wprintf(L"\nWARNING: Only the first cubemap in an array is written out as a cross/strip/equirect\n");
                     }
                 }
                 else
@@ -1520,15 +1536,17 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
             }
 
             // --- Resize ------------------------------------------------------------------
-            if (!width)
+            // Projections use -w and -h for the size of the result instead
+            const bool projection = (dwCommand == CMD_CUBE_FROM_EQUIRECT || dwCommand == CMD_EQUIRECT);
+            if (!width && !projection)
             {
                 width = info.width;
             }
-            if (!height)
+            if (!height && !projection)
             {
                 height = info.height;
             }
-            if (info.width != width || info.height != height)
+            if (!projection && (info.width != width || info.height != height))
             {
                 std::unique_ptr<ScratchImage> timage(new (std::nothrow) ScratchImage);
                 if (!timage)
@@ -1704,6 +1722,8 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
     case CMD_H_STRIP:
     case CMD_V_STRIP:
     case CMD_GIF:
+    case CMD_CUBE_FROM_EQUIRECT:
+    case CMD_EQUIRECT:
         break;
 
     default:
@@ -1856,6 +1876,64 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
         break;
     }
 
+    case CMD_CUBE_FROM_EQUIRECT:
+    case CMD_EQUIRECT:
+    {
+        auto src = loadedImages.cbegin();
+
+        DWORD projFilter = dwFilter | dwFilterOpts;
+#ifdef _OPENMP
+        projFilter |= TEX_FILTER_PARALLEL;
+#endif
+
+        ScratchImage result;
+        if (dwCommand == CMD_CUBE_FROM_EQUIRECT)
+        {
+            hr = EquirectToCubeMap(*(*src)->GetImage(0, 0, 0), projFilter, width, result);
+        }
+        else
+        {
+            hr = CubeMapToEquirect((*src)->GetImages(), (*src)->GetImageCount(), (*src)->GetMetadata(), projFilter, width, height, result);
+        }
+        if (FAILED(hr))
+        {
+            wprintf(L"FAILED building result image (%x)\n", hr);
+            return 1;
+        }
+
+        // Write cubemap/panorama
+        wprintf(L"\nWriting %ls ", szOutputFile);
+        PrintInfo(result.GetMetadata());
+        wprintf(L"\n");
+        fflush(stdout);
+
+        if (~dwOptions & (1 << OPT_OVERWRITE))
+        {
+            if (GetFileAttributesW(szOutputFile) != INVALID_FILE_ATTRIBUTES)
+            {
+                wprintf(L"\nERROR: Output file already exists, use -y to overwrite\n");
+                return 1;
+            }
+        }
+
+        if (dwCommand == CMD_CUBE_FROM_EQUIRECT)
+        {
+            hr = SaveToDDSFile(result.GetImages(), result.GetImageCount(), result.GetMetadata(),
+                (dwOptions & (1 << OPT_USE_DX10)) ? (DDS_FLAGS_FORCE_DX10_EXT | DDS_FLAGS_FORCE_DX10_EXT_MISC2) : DDS_FLAGS_NONE,
+                szOutputFile);
+        }
+        else
+        {
+            hr = SaveImageFile(*result.GetImage(0, 0, 0), fileType, szOutputFile);
+        }
+        if (FAILED(hr))
+        {
+            wprintf(L" FAILED (%x)\n", hr);
+            return 1;
+        }
+        break;
+    }
+
     case CMD_MERGE:
     {
         // Capture alpha from source image (the second input filename)
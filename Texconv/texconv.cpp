@@ -104,6 +104,9 @@ enum OPTIONS
     OPT_FILELIST,
     OPT_ROTATE_COLOR,
     OPT_PAPER_WHITE_NITS,
+    OPT_PRESERVE_ALPHA_COVERAGE,
+    OPT_FIX_CUBE_EDGES,
+    OPT_SPECULAR_IBL,
     OPT_MAX
 };
 
@@ -189,6 +192,9 @@ const SValue g_pOptions[] =
     { L"flist",         OPT_FILELIST },
     { L"rotatecolor",   OPT_ROTATE_COLOR },
     { L"nits",          OPT_PAPER_WHITE_NITS },
+    { L"keepcoverage",  OPT_PRESERVE_ALPHA_COVERAGE },
+    { L"fixcubeedges",  OPT_FIX_CUBE_EDGES },
+    { L"specularibl",   OPT_SPECULAR_IBL },
     { nullptr,          0 }
 };
 
@@ -714,6 +720,9 @@ namespace
         wprintf(L"   -pmalpha            convert final texture to use premultiplied alpha\n");
         wprintf(L"   -alpha              convert premultiplied alpha to straight alpha\n");
         wprintf(L"   -pow2               resize to fit a power-of-2, respecting aspect ratio\n");
+        wprintf(L"   -keepcoverage <ref> Preserve alpha coverage in mips for alpha test ref\n");
+        wprintf(L"   -fixcubeedges       stretch cubemap faces for non-seamless cubemap filtering\n");
+        wprintf(L"   -specularibl <n>    GGX prefilter cubemap mips by roughness using n samples\n");
         wprintf(
             L"   -nmap <options>     converts height-map to normal-map\n"
             L"                       options must be one or more of\n"
@@ -1113,6 +1122,8 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
     DWORD colorKey = 0;
     DWORD dwRotateColor = 0;
     float paperWhiteNits = 200.f;
+    float preserveAlphaCoverageRef = 0.0f;
+    int specularIBLSamples = 0;
 
     wchar_t szPrefix[MAX_PATH];
     wchar_t szSuffix[MAX_PATH];
@@ -1180,6 +1191,8 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
             case OPT_FILELIST:
             case OPT_ROTATE_COLOR:
             case OPT_PAPER_WHITE_NITS:
+            case OPT_PRESERVE_ALPHA_COVERAGE:
+            case OPT_SPECULAR_IBL:
                 if (!*pValue)
                 {
                     if ((iArg + 1 >= argc))
@@ -1578,6 +1591,38 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
                     return 1;
                 }
                 break;
+
+            case OPT_PRESERVE_ALPHA_COVERAGE:
+                if (swscanf_s(pValue, L"%f", &preserveAlphaCoverageRef) != 1)
+                {
+                    wprintf(L"Invalid value specified for alpha ref (%ls)\n", pValue);
+                    wprintf(L"\n");
+                    PrintUsage();
+                    return 1;
+                }
+                else if (preserveAlphaCoverageRef <= 0.0f || preserveAlphaCoverageRef >= 1.0f)
+                {
+                    wprintf(L"-keepcoverage (%ls) parameter must be between 0.0 and 1.0 (exclusive)\n", pValue);
+                    wprintf(L"\n");
+                    return 1;
+                }
+                break;
+
+            case OPT_SPECULAR_IBL:
+                if (swscanf_s(pValue, L"%d", &specularIBLSamples) != 1)
+                {
+                    wprintf(L"Invalid value specified for sample count (%ls)\n", pValue);
+                    wprintf(L"\n");
+                    PrintUsage();
+                    return 1;
+                }
+                else if (specularIBLSamples <= 0)
+                {
+                    wprintf(L"-specularibl (%ls) parameter must be a positive sample count\n", pValue);
+                    wprintf(L"\n");
+                    return 1;
+                }
+                break;
             }
         }
         else if (wcspbrk(pArg, L"?*") != nullptr)
@@ -2619,6 +2664,136 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
             cimage.reset();
         }
 
+        // --- Preserve mipmap alpha coverage (if requested) ---------------------------
+        if ((dwOptions & (DWORD64(1) << OPT_PRESERVE_ALPHA_COVERAGE))
+            && info.mipLevels != 1
+            && HasAlpha(info.format)
+            && info.dimension != TEX_DIMENSION_TEXTURE3D)
+        {
+            std::unique_ptr<ScratchImage> timage(new (std::nothrow) ScratchImage);
+            if (!timage)
+            {
+                wprintf(L"\nERROR: Memory allocation failed\n");
+                return 1;
+            }
+
+            hr = timage->Initialize(image->GetMetadata());
+            if (FAILED(hr))
+            {
+                wprintf(L" FAILED [keepcoverage] (%x)\n", hr);
+                return 1;
+            }
+
+            const size_t items = image->GetMetadata().arraySize;
+            for (size_t item = 0; item < items; ++item)
+            {
+                auto img = image->GetImage(0, item, 0);
+                assert(img);
+
+                hr = ScaleMipMapsAlphaForCoverage(img, info.mipLevels, info, item, preserveAlphaCoverageRef, *timage);
+                if (FAILED(hr))
+                {
+                    wprintf(L" FAILED [keepcoverage] (%x)\n", hr);
+                    return 1;
+                }
+            }
+
+            auto& tinfo = timage->GetMetadata();
+            tinfo;
+
+            assert(info.width == tinfo.width);
+            assert(info.height == tinfo.height);
+            assert(info.depth == tinfo.depth);
+            assert(info.arraySize == tinfo.arraySize);
+            assert(info.mipLevels == tinfo.mipLevels);
+            assert(info.miscFlags == tinfo.miscFlags);
+            assert(info.dimension == tinfo.dimension);
+
+            image.swap(timage);
+            cimage.reset();
+        }
+
+        // --- GGX prefiltered specular cubemap (if requested) -------------------------
+        if ((dwOptions & (DWORD64(1) << OPT_SPECULAR_IBL))
+            && info.IsCubemap())
+        {
+            std::unique_ptr<ScratchImage> timage(new (std::nothrow) ScratchImage);
+            if (!timage)
+            {
+                wprintf(L"\nERROR: Memory allocation failed\n");
+                return 1;
+            }
+
+            DWORD iblFilter = dwFilter | dwFilterOpts;
+#ifdef _OPENMP
+            if (!(dwOptions & (DWORD64(1) << OPT_FORCE_SINGLEPROC)))
+            {
+                iblFilter |= TEX_FILTER_PARALLEL;
+            }
+#endif
+
+            hr = PrefilterSpecularCubeMap(image->GetImages(), image->GetImageCount(), image->GetMetadata(), iblFilter,
+                static_cast<size_t>(specularIBLSamples), info.mipLevels, *timage);
+            if (FAILED(hr))
+            {
+                wprintf(L" FAILED [specularibl] (%x)\n", hr);
+                return 1;
+            }
+
+            auto& tinfo = timage->GetMetadata();
+            tinfo;
+
+            assert(info.width == tinfo.width);
+            assert(info.height == tinfo.height);
+            assert(info.arraySize == tinfo.arraySize);
+            assert(info.mipLevels == tinfo.mipLevels);
+            assert(info.miscFlags == tinfo.miscFlags);
+            assert(info.format == tinfo.format);
+
+            image.swap(timage);
+            cimage.reset();
+        }
+
+        // --- Fix cubemap edges (if requested) ----------------------------------------
+        if ((dwOptions & (DWORD64(1) << OPT_FIX_CUBE_EDGES))
+            && info.IsCubemap())
+        {
+            std::unique_ptr<ScratchImage> timage(new (std::nothrow) ScratchImage);
+            if (!timage)
+            {
+                wprintf(L"\nERROR: Memory allocation failed\n");
+                return 1;
+            }
+
+            DWORD cubeFilter = dwFilter | dwFilterOpts;
+#ifdef _OPENMP
+            if (!(dwOptions & (DWORD64(1) << OPT_FORCE_SINGLEPROC)))
+            {
+                cubeFilter |= TEX_FILTER_PARALLEL;
+            }
+#endif
+
+            hr = FixCubeMapEdges(image->GetImages(), image->GetImageCount(), image->GetMetadata(), cubeFilter, info.mipLevels, *timage);
+            if (FAILED(hr))
+            {
+                wprintf(L" FAILED [fixcubeedges] (%x)\n", hr);
+                return 1;
+            }
+
+            auto& tinfo = timage->GetMetadata();
+            tinfo;
+
+            assert(info.width == tinfo.width);
+            assert(info.height == tinfo.height);
+            assert(info.arraySize == tinfo.arraySize);
+            assert(info.mipLevels == tinfo.mipLevels);
+            assert(info.miscFlags == tinfo.miscFlags);
+            assert(info.format == tinfo.format);
+
+            image.swap(timage);
+            cimage.reset();
+        }
+
         // --- Premultiplied alpha (if requested) --------------------------------------
         if ((dwOptions & (DWORD64(1) << OPT_PREMUL_ALPHA))
             && HasAlpha(info.format)